@@ -0,0 +1,588 @@
+// ct2palette-bench: drives the portable translation core of CTranslate2Wrapper on the
+// shipped opus-mt models and prints the results as JSON.
+//
+//   ct2palette-bench [--en-zh DIR] [--mul-en DIR] [--clients N] [--seconds S]
+//                    [--repetitions R] [--output FILE]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <nlohmann/json.hpp>
+
+#include "CTranslate2WrapperImpl.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		std::string enZhPath = "TranslateCommandPalette/Models/opus_en_zh_ct2_int8";
+		std::string mulEnPath = "TranslateCommandPalette/Models/opus_mul_en_ct2_int8";
+		size_t clients = 4;
+		double seconds = 10;
+		size_t repetitions = 3;
+		std::string output;
+	};
+
+	// Palette-like English input, from single words to long sentences.
+	const char* const englishCorpus[] = {
+		"hello",
+		"open file",
+		"keyboard shortcut",
+		"translate this sentence",
+		"Where is the nearest train station?",
+		"The meeting has been moved to Thursday afternoon.",
+		"Please send me the report before the end of the day.",
+		"This function returns the number of elements in the list.",
+		"Could you explain how the new scheduling system works in practice?",
+		"We need to update the documentation before the release, otherwise users will be confused by the new options.",
+		"The results of the experiment were better than expected, but the team still wants to repeat the measurements on a larger data set next month.",
+		"Command Palette extensions run out of process, so every translation request crosses a COM boundary before it reaches the native translation engine and its model replicas.",
+	};
+
+	// Non-English input for the mul->en model.
+	const char* const multilingualCorpus[] = {
+		"bonjour",
+		"guten Morgen",
+		"¿Dónde está la estación de tren?",
+		"La réunion a été déplacée à jeudi après-midi.",
+		"Bitte schicken Sie mir den Bericht bis heute Abend.",
+		"Questa funzione restituisce il numero di elementi nella lista.",
+		"Os resultados da experiência foram melhores do que o esperado.",
+		"Deze functie geeft het aantal elementen in de lijst terug.",
+		"Мы должны обновить документацию до выпуска новой версии.",
+		"会議は木曜日の午後に変更されました。",
+	};
+
+	// Upper bounds of the input token count buckets; the last one is open.
+	const size_t tokenBuckets[] = { 8, 16, 32, 64 };
+
+	std::string bucketName(size_t tokens)
+	{
+		size_t lower = 1;
+		for (const size_t upper : tokenBuckets)
+		{
+			if (tokens <= upper)
+			{
+				return std::to_string(lower) + "-" + std::to_string(upper);
+			}
+			lower = upper + 1;
+		}
+		return std::to_string(lower) + "+";
+	}
+
+	double percentile(std::vector<double> values, double fraction)
+	{
+		if (values.empty())
+		{
+			return 0;
+		}
+		std::sort(values.begin(), values.end());
+		const size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+		return values[std::min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+	}
+
+	double millisecondsSince(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// Peak resident set size of the process so far, in KiB.
+	long peakRssKilobytes()
+	{
+		rusage usage{};
+		getrusage(RUSAGE_SELF, &usage);
+		return usage.ru_maxrss;
+	}
+
+	Options parseArguments(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (i + 1 >= argc)
+			{
+				throw std::invalid_argument("Missing value for " + argument);
+			}
+			const std::string value = argv[++i];
+			if (argument == "--en-zh")
+				options.enZhPath = value;
+			else if (argument == "--mul-en")
+				options.mulEnPath = value;
+			else if (argument == "--clients")
+				options.clients = std::max(1, std::stoi(value));
+			else if (argument == "--seconds")
+				options.seconds = std::stod(value);
+			else if (argument == "--repetitions")
+				options.repetitions = std::max(1, std::stoi(value));
+			else if (argument == "--output")
+				options.output = value;
+			else
+				throw std::invalid_argument("Unknown option " + argument);
+		}
+		return options;
+	}
+
+	nlohmann::json benchmarkModel(const std::string& name,
+	                              const std::string& modelPath,
+	                              const std::vector<std::string>& corpus,
+	                              const Options& options)
+	{
+		nlohmann::json result;
+		result["model"] = name;
+		result["path"] = modelPath;
+
+		// 1. Cold load: weights, SentencePiece models and replica start-up. Caching is off
+		//    so every query below runs the model.
+		TranslatorConfig config;
+		config.cacheCapacityBytes = 0;
+		config.useTunedProfile = false;
+
+		const auto loadStart = Clock::now();
+		CTranslate2WrapperImpl translator(modelPath, config);
+		result["load_ms"] = millisecondsSince(loadStart);
+		result["load_model_ms"] = translator.loadTimings().model;
+		result["load_tokenizer_ms"] = translator.loadTimings().tokenizer;
+		result["config"] = translator.config.toString();
+
+		// 2. First query: includes first-use allocations in the replica.
+		const auto firstStart = Clock::now();
+		translator.translate(corpus.front());
+		result["first_query_ms"] = millisecondsSince(firstStart);
+
+		// 3. Single-client latency per input token count.
+		std::map<std::string, std::vector<double>> latencies;
+		for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+		{
+			for (const std::string& text : corpus)
+			{
+				const size_t tokens = translator.tokenizer->encode(text).size() + 1; // + </s>
+				const auto start = Clock::now();
+				translator.translate(text);
+				latencies[bucketName(tokens)].push_back(millisecondsSince(start));
+			}
+		}
+
+		nlohmann::json buckets = nlohmann::json::array();
+		for (const auto& [bucket, values] : latencies)
+		{
+			buckets.push_back({
+				{ "tokens", bucket },
+				{ "count", values.size() },
+				{ "p50_ms", percentile(values, 0.50) },
+				{ "p90_ms", percentile(values, 0.90) },
+				{ "p99_ms", percentile(values, 0.99) },
+			});
+		}
+		result["latency_by_tokens"] = buckets;
+
+		// 4. Sustained throughput: N clients issuing back-to-back queries.
+		std::atomic<size_t> completed{ 0 };
+		std::atomic<bool> failed{ false };
+		const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.seconds));
+		const auto throughputStart = Clock::now();
+		std::vector<std::thread> clients;
+		for (size_t client = 0; client < options.clients; ++client)
+		{
+			clients.emplace_back([&, client]
+				{
+					try
+					{
+						for (size_t i = client; Clock::now() < deadline; ++i)
+						{
+							translator.translate(corpus[i % corpus.size()]);
+							completed.fetch_add(1, std::memory_order_relaxed);
+						}
+					}
+					catch (const std::exception& e)
+					{
+						std::cerr << name << " client " << client << ": " << e.what() << std::endl;
+						failed = true;
+					}
+				});
+		}
+		for (std::thread& client : clients)
+		{
+			client.join();
+		}
+		const double elapsed = millisecondsSince(throughputStart) / 1000.0;
+		result["throughput"] = {
+			{ "clients", options.clients },
+			{ "seconds", elapsed },
+			{ "translations", completed.load() },
+			{ "translations_per_second", elapsed > 0 ? completed.load() / elapsed : 0.0 },
+			{ "failed", failed.load() },
+		};
+
+		// 5. Adaptive decoding: thresholds calibrated on the corpus, then latency and
+		//    output against plain beam search.
+		const ConfidenceThresholds thresholds = translator.calibrateAdaptiveDecoding(corpus);
+		std::vector<double> beamLatencies;
+		std::vector<double> adaptiveLatencies;
+		size_t identical = 0;
+		for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+		{
+			for (const std::string& text : corpus)
+			{
+				translator.adaptiveDecoding = false;
+				auto start = Clock::now();
+				const std::string beam = translator.translate(text);
+				beamLatencies.push_back(millisecondsSince(start));
+
+				translator.adaptiveDecoding = true;
+				start = Clock::now();
+				const std::string adaptive = translator.translate(text);
+				adaptiveLatencies.push_back(millisecondsSince(start));
+				identical += beam == adaptive ? 1 : 0;
+			}
+		}
+		translator.adaptiveDecoding = false;
+		const AdaptiveDecodingStatistics adaptiveStatistics = translator.escalation.statistics();
+		result["adaptive"] = {
+			{ "min_token_log_prob", thresholds.minTokenLogProb },
+			{ "min_mean_log_prob", thresholds.minMeanLogProb },
+			{ "requests", adaptiveStatistics.requests },
+			{ "escalations", adaptiveStatistics.escalations },
+			{ "identical_rate", beamLatencies.empty() ? 0.0 : static_cast<double>(identical) / beamLatencies.size() },
+			{ "beam_p50_ms", percentile(beamLatencies, 0.50) },
+			{ "beam_p99_ms", percentile(beamLatencies, 0.99) },
+			{ "adaptive_p50_ms", percentile(adaptiveLatencies, 0.50) },
+			{ "adaptive_p99_ms", percentile(adaptiveLatencies, 0.99) },
+		};
+
+		// 6. Keystroke latency while another client keeps the replicas busy with
+		//    batches, and how long each request class waited for a replica.
+		std::atomic<bool> bulkRunning{ true };
+		std::thread bulkClient([&]
+			{
+				try
+				{
+					while (bulkRunning)
+					{
+						translator.translateBatch(corpus);
+					}
+				}
+				catch (const std::exception& e)
+				{
+					std::cerr << name << " bulk client: " << e.what() << std::endl;
+				}
+			});
+		std::vector<double> mixedLatencies;
+		for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+		{
+			for (const std::string& text : corpus)
+			{
+				const auto start = Clock::now();
+				translator.translate(text);
+				mixedLatencies.push_back(millisecondsSince(start));
+			}
+		}
+		bulkRunning = false;
+		bulkClient.join();
+
+		nlohmann::json queues = nlohmann::json::object();
+		for (size_t index = 0; index < static_cast<size_t>(RequestClass::Count); ++index)
+		{
+			const RequestClassStatistics statistics = translator.scheduler->statistics(static_cast<RequestClass>(index));
+			queues[requestClassName(static_cast<RequestClass>(index))] = {
+				{ "submitted", statistics.submitted },
+				{ "expired", statistics.expired },
+				{ "wait_p50_us", statistics.wait.percentile(0.50) },
+				{ "wait_p99_us", statistics.wait.percentile(0.99) },
+			};
+		}
+		result["mixed"] = {
+			{ "scheduling", schedulingModeName(translator.scheduler->mode()) },
+			{ "interactive_p50_ms", percentile(mixedLatencies, 0.50) },
+			{ "interactive_p99_ms", percentile(mixedLatencies, 0.99) },
+			{ "queues", queues },
+		};
+
+		// 7. Continuous batching against one decoding run per request, both greedy, with
+		//    every client translating the corpus at the same time.
+		const size_t beamSize = translator.translationOptions.beam_size;
+		translator.translationOptions.beam_size = 1;
+		nlohmann::json continuous = nlohmann::json::object();
+		std::map<std::string, std::string> greedyOutputs;
+		size_t sameOutput = 0;
+		for (const bool enabled : { false, true })
+		{
+			translator.continuousBatching = enabled;
+			for (const std::string& text : corpus)
+			{
+				const std::string output = translator.translate(text);
+				if (!enabled)
+					greedyOutputs[text] = output;
+				else
+					sameOutput += greedyOutputs[text] == output ? 1 : 0;
+			}
+
+			std::mutex latenciesMutex;
+			std::vector<double> concurrentLatencies;
+			const auto concurrentStart = Clock::now();
+			std::vector<std::thread> workers;
+			for (size_t client = 0; client < options.clients; ++client)
+			{
+				workers.emplace_back([&, client]
+					{
+						std::vector<double> own;
+						for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+						{
+							for (size_t i = 0; i < corpus.size(); ++i)
+							{
+								const auto start = Clock::now();
+								translator.translate(corpus[(i + client) % corpus.size()]);
+								own.push_back(millisecondsSince(start));
+							}
+						}
+						std::lock_guard<std::mutex> lock(latenciesMutex);
+						concurrentLatencies.insert(concurrentLatencies.end(), own.begin(), own.end());
+					});
+			}
+			for (std::thread& worker : workers)
+			{
+				worker.join();
+			}
+			const double seconds = millisecondsSince(concurrentStart) / 1000.0;
+			continuous[enabled ? "continuous" : "per_request"] = {
+				{ "p50_ms", percentile(concurrentLatencies, 0.50) },
+				{ "p99_ms", percentile(concurrentLatencies, 0.99) },
+				{ "translations_per_second", seconds > 0 ? concurrentLatencies.size() / seconds : 0.0 },
+			};
+		}
+		translator.continuousBatching = false;
+		translator.translationOptions.beam_size = beamSize;
+		const ContinuousBatchingStatistics batching = translator.batcher->statistics();
+		continuous["identical_rate"] = corpus.empty() ? 0.0 : static_cast<double>(sameOutput) / corpus.size();
+		continuous["mean_rows_per_step"] = batching.steps ? static_cast<double>(batching.rows) / batching.steps : 0.0;
+		result["continuous_batching"] = continuous;
+
+		// 8. Self-speculative decoding with 1 to 3 draft layers against plain greedy
+		//    search, one client.
+		translator.translationOptions.beam_size = 1;
+		nlohmann::json selfSpeculative = nlohmann::json::object();
+		for (const size_t layers : { 0, 1, 2, 3 })
+		{
+			translator.selfSpeculativeLayers = layers;
+			const SelfSpeculativeStatistics before = translator.selfSpeculation.statistics();
+			std::vector<double> speculativeLatencies;
+			size_t sameGreedy = 0;
+			for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+			{
+				for (const std::string& text : corpus)
+				{
+					const auto start = Clock::now();
+					const std::string output = translator.translate(text);
+					speculativeLatencies.push_back(millisecondsSince(start));
+					if (layers == 0)
+						greedyOutputs[text] = output;
+					else
+						sameGreedy += greedyOutputs[text] == output ? 1 : 0;
+				}
+			}
+
+			nlohmann::json entry = {
+				{ "p50_ms", percentile(speculativeLatencies, 0.50) },
+				{ "p99_ms", percentile(speculativeLatencies, 0.99) },
+			};
+			if (layers > 0)
+			{
+				const SelfSpeculativeStatistics after = translator.selfSpeculation.statistics();
+				const size_t drafted = after.draftTokens - before.draftTokens;
+				const size_t passes = after.rounds - before.rounds;
+				entry["identical_rate"] = speculativeLatencies.empty() ? 0.0 : static_cast<double>(sameGreedy) / speculativeLatencies.size();
+				entry["acceptance_rate"] = drafted ? static_cast<double>(after.acceptedTokens - before.acceptedTokens) / drafted : 0.0;
+				entry["tokens_per_pass"] = passes ? static_cast<double>(after.tokens - before.tokens) / passes : 0.0;
+			}
+			selfSpeculative[layers == 0 ? std::string("greedy") : "layers_" + std::to_string(layers)] = entry;
+		}
+		translator.selfSpeculativeLayers = 0;
+		translator.translationOptions.beam_size = beamSize;
+		selfSpeculative["draft_tokens"] = translator.selfSpeculativeDraftTokens.load();
+		result["self_speculative"] = selfSpeculative;
+
+		// 9. Translation memory holding the corpus translations: exact hits, and near
+		//    hits (one character dropped) used as drafts, against running the model.
+		const std::filesystem::path memoryPath = std::filesystem::temp_directory_path() / ("ct2palette-bench-" + name + TranslationMemory::extension);
+		std::filesystem::remove(memoryPath);
+		translator.openTranslationMemory(memoryPath.u8string());
+		std::vector<std::string> nearTexts;
+		for (const std::string& text : corpus)
+		{
+			translator.memory()->add(text, translator.translate(text));
+			nearTexts.push_back(text.size() > 1 ? text.substr(0, text.size() - 1) : text);
+		}
+		translator.memory()->save();
+		translator.openTranslationMemory(memoryPath.u8string());
+
+		const auto timeTranslations = [&](const std::vector<std::string>& texts)
+		{
+			std::vector<double> values;
+			for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+			{
+				for (const std::string& text : texts)
+				{
+					const auto start = Clock::now();
+					translator.translate(text);
+					values.push_back(millisecondsSince(start));
+				}
+			}
+			return values;
+		};
+		const std::vector<double> exactLatencies = timeTranslations(corpus);
+		const std::vector<double> hintedLatencies = timeTranslations(nearTexts);
+		const float hintScore = translator.memoryHintScore;
+		translator.memoryHintScore = 1.0f;
+		const std::vector<double> unhintedLatencies = timeTranslations(nearTexts);
+		translator.memoryHintScore = hintScore;
+
+		std::vector<double> lookupMicroseconds;
+		for (const std::string& text : nearTexts)
+		{
+			const auto start = Clock::now();
+			translator.memory()->find(text, translator.memoryHintScore);
+			lookupMicroseconds.push_back(millisecondsSince(start) * 1000.0);
+		}
+		const TranslationMemoryStatistics memoryStatistics = translator.memory()->statistics();
+		result["translation_memory"] = {
+			{ "entries", memoryStatistics.entries },
+			{ "file_bytes", std::filesystem::file_size(memoryPath) },
+			{ "exact_hit_p50_ms", percentile(exactLatencies, 0.50) },
+			{ "exact_hit_p99_ms", percentile(exactLatencies, 0.99) },
+			{ "near_hinted_p50_ms", percentile(hintedLatencies, 0.50) },
+			{ "near_hinted_p99_ms", percentile(hintedLatencies, 0.99) },
+			{ "near_model_p50_ms", percentile(unhintedLatencies, 0.50) },
+			{ "near_model_p99_ms", percentile(unhintedLatencies, 0.99) },
+			{ "near_lookup_p50_us", percentile(lookupMicroseconds, 0.50) },
+			{ "near_lookup_p99_us", percentile(lookupMicroseconds, 0.99) },
+		};
+		translator.closeTranslationMemory();
+		std::filesystem::remove(memoryPath);
+
+		// 10. Scheduling overhead: empty requests from every client, through the pool
+		//    directly and through a scheduler in each mode (nanoseconds per request).
+		constexpr size_t emptyRequests = 20000;
+		const auto timePerRequest = [&](const std::function<std::future<bool>()>& post)
+		{
+			const auto start = Clock::now();
+			std::vector<std::thread> submitters;
+			for (size_t client = 0; client < options.clients; ++client)
+			{
+				submitters.emplace_back([&]
+					{
+						std::vector<std::future<bool>> futures;
+						futures.reserve(emptyRequests);
+						for (size_t i = 0; i < emptyRequests; ++i)
+						{
+							futures.push_back(post());
+						}
+						for (auto& future : futures)
+						{
+							future.get();
+						}
+					});
+			}
+			for (std::thread& submitter : submitters)
+			{
+				submitter.join();
+			}
+			return millisecondsSince(start) * 1e6 / (emptyRequests * options.clients);
+		};
+		using Replica = RequestScheduler::Replica;
+		nlohmann::json overhead = {
+			{ "replicas", translator.config.replicas },
+			{ "pool_ns", timePerRequest([&] { return translator.translator->post<bool>([](Replica&) { return true; }); }) },
+		};
+		for (const SchedulingMode mode : { SchedulingMode::Fifo, SchedulingMode::Priority, SchedulingMode::WorkStealing })
+		{
+			RequestScheduler scheduler(*translator.translator, mode, translator.config.maxQueuedBatches);
+			overhead[std::string(schedulingModeName(mode)) + "_ns"] = timePerRequest(
+				[&] { return scheduler.post<bool>(RequestClass::Bulk, [](Replica&) { return true; }); });
+			// Pull jobs may still be finishing after the last request; they use the scheduler.
+			while (translator.translator->num_active_batches() > 0)
+			{
+				std::this_thread::yield();
+			}
+		}
+		result["scheduler_overhead"] = overhead;
+
+		// 11. Where the time went, over every query above (microseconds, decode steps).
+		nlohmann::json stages = nlohmann::json::object();
+		const auto addStage = [&stages](const char* stage, const LatencyHistogram::Snapshot& snapshot)
+		{
+			if (snapshot.count > 0)
+			{
+				stages[stage] = {
+					{ "count", snapshot.count },
+					{ "mean", snapshot.mean() },
+					{ "p50", snapshot.percentile(0.50) },
+					{ "p99", snapshot.percentile(0.99) },
+					{ "max", snapshot.max },
+				};
+			}
+		};
+		for (size_t stage = 0; stage < StageMetrics::stageCount; ++stage)
+		{
+			addStage(stageName(static_cast<Stage>(stage)), translator.metrics.snapshot(static_cast<Stage>(stage)));
+		}
+		addStage("decode_steps", translator.metrics.decodeSteps());
+		result["stages"] = stages;
+
+		// Cumulative: includes every model benchmarked so far.
+		result["peak_rss_kb"] = peakRssKilobytes();
+		return result;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const Options options = parseArguments(argc, argv);
+
+		nlohmann::json report;
+		report["cores"] = TranslatorConfig::detectedCores();
+		report["models"] = nlohmann::json::array();
+		report["models"].push_back(benchmarkModel("en-zh", options.enZhPath,
+			std::vector<std::string>(std::begin(englishCorpus), std::end(englishCorpus)), options));
+		report["models"].push_back(benchmarkModel("mul-en", options.mulEnPath,
+			std::vector<std::string>(std::begin(multilingualCorpus), std::end(multilingualCorpus)), options));
+		report["peak_rss_kb"] = peakRssKilobytes();
+
+		const std::string json = report.dump(2);
+		if (options.output.empty())
+		{
+			std::cout << json << std::endl;
+		}
+		else
+		{
+			std::ofstream(options.output) << json << std::endl;
+		}
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "ct2palette-bench: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,214 @@
+// ct2palette-langid: trains the Latin-script language models of LanguageIdentifier from
+// running text and writes them as LanguageProfiles.h.
+//
+//   ct2palette-langid --corpus DIR [--languages en,fr,...] [--top N] [--output FILE]
+//
+// DIR holds one UTF-8 text file per language, <code>.txt. Benchmark/langid has the
+// preamble and first twenty articles of the Universal Declaration of Human Rights in
+// each language; regenerate the header with
+//
+//   ./build-bench/ct2palette-langid --corpus Benchmark/langid
+//       --output CTranslate2Wrapper/LanguageProfiles.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "LanguageIdentifier.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	struct Options
+	{
+		std::string corpus;
+		std::vector<std::string> languages{ "en", "fr", "de", "es", "it", "pt", "nl" };
+		// Most frequent trigrams kept per language.
+		size_t top = 2000;
+		std::string output;
+	};
+
+	Options parseArguments(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (i + 1 >= argc)
+			{
+				throw std::invalid_argument("Missing value for " + argument);
+			}
+			const std::string value = argv[++i];
+			if (argument == "--corpus")
+				options.corpus = value;
+			else if (argument == "--languages")
+			{
+				options.languages.clear();
+				std::stringstream list(value);
+				for (std::string language; std::getline(list, language, ',');)
+					options.languages.push_back(language);
+			}
+			else if (argument == "--top")
+				options.top = std::stoul(value);
+			else if (argument == "--output")
+				options.output = value;
+			else
+				throw std::invalid_argument("Unknown option " + argument);
+		}
+		if (options.corpus.empty())
+		{
+			throw std::invalid_argument("--corpus is required.");
+		}
+		if (options.languages.empty() || options.languages.size() > 32)
+		{
+			throw std::invalid_argument("--languages takes 1 to 32 languages.");
+		}
+		return options;
+	}
+
+	std::string readFile(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			throw std::runtime_error("Failed to open '" + path + "'.");
+		}
+		std::stringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	// Add-half smoothed log probabilities of one language's trigrams.
+	struct LanguageModel
+	{
+		std::map<uint32_t, double> logProbabilities;
+		double unseen = 0;
+	};
+
+	LanguageModel train(const std::string& text, size_t top)
+	{
+		std::map<uint32_t, size_t> counts;
+		size_t total = 0;
+		std::stringstream lines(text);
+		for (std::string line; std::getline(lines, line);)
+		{
+			for (const uint32_t trigram : LanguageIdentifier::latinTrigrams(line))
+			{
+				++counts[trigram];
+				++total;
+			}
+		}
+		if (total == 0)
+		{
+			throw std::runtime_error("The corpus has no Latin text.");
+		}
+
+		std::vector<std::pair<uint32_t, size_t>> ranked(counts.begin(), counts.end());
+		std::stable_sort(ranked.begin(), ranked.end(),
+			[](const auto& a, const auto& b) { return a.second > b.second; });
+		const double denominator = static_cast<double>(total) + 0.5 * static_cast<double>(counts.size());
+
+		LanguageModel model;
+		model.unseen = std::log(0.5 / denominator);
+		for (size_t i = 0; i < std::min(top, ranked.size()); ++i)
+		{
+			model.logProbabilities[ranked[i].first] = std::log((ranked[i].second + 0.5) / denominator);
+		}
+		return model;
+	}
+
+	void writeHeader(std::ostream& out, const Options& options, const std::vector<LanguageModel>& models)
+	{
+		std::map<uint32_t, std::vector<double>> rows;
+		for (size_t language = 0; language < models.size(); ++language)
+		{
+			for (const auto& [trigram, logProbability] : models[language].logProbabilities)
+			{
+				auto row = rows.find(trigram);
+				if (row == rows.end())
+				{
+					std::vector<double> unseen;
+					for (const LanguageModel& model : models)
+						unseen.push_back(model.unseen);
+					row = rows.emplace(trigram, std::move(unseen)).first;
+				}
+				row->second[language] = logProbability;
+			}
+		}
+
+		out << "#pragma once\n\n"
+			<< "// Generated by ct2palette-langid (Benchmark/ct2palette_langid.cpp) from the corpus in\n"
+			<< "// Benchmark/langid, " << options.top << " trigrams per language. Do not edit.\n\n"
+			<< "#include <cstddef>\n#include <cstdint>\n\n"
+			<< "namespace CTranslate2Wrapper::Native::LanguageProfiles {\n\n"
+			<< "    constexpr size_t languageCount = " << models.size() << ";\n\n"
+			<< "    constexpr const char* languages[languageCount] = {";
+		for (size_t language = 0; language < options.languages.size(); ++language)
+		{
+			out << (language == 0 ? " " : ", ") << '"' << options.languages[language] << '"';
+		}
+		out << " };\n\n"
+			<< "    struct TrigramWeights\n    {\n"
+			<< "        uint32_t trigram;\n"
+			<< "        // Log probability of the trigram in each language; a language that does not\n"
+			<< "        // keep the trigram gets the probability of an unseen one.\n"
+			<< "        float logProbability[languageCount];\n"
+			<< "    };\n\n"
+			<< "    // Sorted by trigram, as packed by LanguageIdentifier::latinTrigrams.\n"
+			<< "    constexpr TrigramWeights trigrams[] = {\n";
+		char buffer[32];
+		for (const auto& [trigram, logProbabilities] : rows)
+		{
+			std::snprintf(buffer, sizeof(buffer), "0x%06X", trigram);
+			out << "        { " << buffer << ", {";
+			for (size_t language = 0; language < logProbabilities.size(); ++language)
+			{
+				std::snprintf(buffer, sizeof(buffer), "%.2ff", logProbabilities[language]);
+				out << (language == 0 ? " " : ", ") << buffer;
+			}
+			out << " } },\n";
+		}
+		out << "    };\n\n}\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const Options options = parseArguments(argc, argv);
+		std::vector<LanguageModel> models;
+		for (const std::string& language : options.languages)
+		{
+			models.push_back(train(readFile(options.corpus + "/" + language + ".txt"), options.top));
+		}
+
+		if (options.output.empty())
+		{
+			writeHeader(std::cout, options, models);
+		}
+		else
+		{
+			std::ofstream file(options.output, std::ios::binary);
+			if (!file)
+			{
+				throw std::runtime_error("Failed to open '" + options.output + "'.");
+			}
+			writeHeader(file, options, models);
+		}
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "ct2palette-langid: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,326 @@
+// ct2palette-vmap: builds the vocabulary map (vmap.txt) of a model directory from a
+// sentence-aligned parallel corpus, installs it, and reports how decoding with it
+// compares to decoding over the full vocabulary on held-out sentences, as JSON.
+//
+//   ct2palette-vmap --model DIR --source FILE --target FILE [--holdout N]
+//                   [--max-ngram N] [--unigram-candidates N] [--ngram-candidates N]
+//                   [--frequent N] [--min-count N] [--output FILE]
+//
+// FILE pairs are plain text, one sentence per line, line i of --source translating to
+// line i of --target. The last --holdout pairs are not used to build the map.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "CTranslate2WrapperImpl.h"
+#include "VocabularyMapBuilder.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		std::string modelPath;
+		std::string sourcePath;
+		std::string targetPath;
+		size_t holdout = 200;
+		std::string output;
+		VocabularyMapOptions map;
+	};
+
+	Options parseArguments(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			if (i + 1 >= argc)
+			{
+				throw std::invalid_argument("Missing value for " + argument);
+			}
+			const std::string value = argv[++i];
+			if (argument == "--model")
+				options.modelPath = value;
+			else if (argument == "--source")
+				options.sourcePath = value;
+			else if (argument == "--target")
+				options.targetPath = value;
+			else if (argument == "--holdout")
+				options.holdout = std::stoul(value);
+			else if (argument == "--max-ngram")
+				options.map.maxNgram = std::stoul(value);
+			else if (argument == "--unigram-candidates")
+				options.map.candidatesPerUnigram = std::stoul(value);
+			else if (argument == "--ngram-candidates")
+				options.map.candidatesPerNgram = std::stoul(value);
+			else if (argument == "--frequent")
+				options.map.frequentTargets = std::stoul(value);
+			else if (argument == "--min-count")
+				options.map.minCooccurrences = static_cast<uint32_t>(std::stoul(value));
+			else if (argument == "--output")
+				options.output = value;
+			else
+				throw std::invalid_argument("Unknown option " + argument);
+		}
+		if (options.modelPath.empty() || options.sourcePath.empty() || options.targetPath.empty())
+		{
+			throw std::invalid_argument("--model, --source and --target are required.");
+		}
+		return options;
+	}
+
+	std::vector<std::string> readLines(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+		{
+			throw std::runtime_error("Failed to open '" + path + "'.");
+		}
+		std::vector<std::string> lines;
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.pop_back();
+			}
+			lines.push_back(std::move(line));
+		}
+		return lines;
+	}
+
+	double percentile(std::vector<double> values, double fraction)
+	{
+		if (values.empty())
+		{
+			return 0;
+		}
+		std::sort(values.begin(), values.end());
+		const size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+		return values[std::min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+	}
+
+	// UTF-8 code points of text, whitespace left out.
+	std::vector<std::string> characters(const std::string& text)
+	{
+		std::vector<std::string> result;
+		for (size_t i = 0; i < text.size();)
+		{
+			const unsigned char lead = static_cast<unsigned char>(text[i]);
+			const size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : 4;
+			if (lead != ' ' && lead != '\t')
+			{
+				result.push_back(text.substr(i, length));
+			}
+			i += length;
+		}
+		return result;
+	}
+
+	// Sentence-level chrF (character n-grams 1..6, beta 2), in [0, 100]. Works the same
+	// for Chinese and for space-separated languages, unlike word-based metrics.
+	double chrF(const std::string& hypothesis, const std::string& reference)
+	{
+		const std::vector<std::string> hyp = characters(hypothesis);
+		const std::vector<std::string> ref = characters(reference);
+		constexpr size_t maxOrder = 6;
+		constexpr double beta = 2;
+
+		double precisionSum = 0;
+		double recallSum = 0;
+		size_t orders = 0;
+		for (size_t n = 1; n <= maxOrder; ++n)
+		{
+			const auto count = [n](const std::vector<std::string>& chars)
+			{
+				std::map<std::string, size_t> ngrams;
+				for (size_t i = 0; i + n <= chars.size(); ++i)
+				{
+					std::string ngram;
+					for (size_t j = i; j < i + n; ++j)
+						ngram += chars[j];
+					++ngrams[ngram];
+				}
+				return ngrams;
+			};
+			const auto hypNgrams = count(hyp);
+			const auto refNgrams = count(ref);
+			if (hypNgrams.empty() || refNgrams.empty())
+			{
+				continue;
+			}
+
+			size_t matches = 0;
+			size_t hypTotal = 0;
+			size_t refTotal = 0;
+			for (const auto& [ngram, hypCount] : hypNgrams)
+			{
+				hypTotal += hypCount;
+				const auto it = refNgrams.find(ngram);
+				if (it != refNgrams.end())
+					matches += std::min(hypCount, it->second);
+			}
+			for (const auto& [ngram, refCount] : refNgrams)
+			{
+				refTotal += refCount;
+			}
+			precisionSum += static_cast<double>(matches) / hypTotal;
+			recallSum += static_cast<double>(matches) / refTotal;
+			++orders;
+		}
+		if (orders == 0)
+		{
+			return hypothesis == reference ? 100.0 : 0.0;
+		}
+
+		const double precision = precisionSum / orders;
+		const double recall = recallSum / orders;
+		if (precision + recall == 0)
+		{
+			return 0;
+		}
+		return 100 * (1 + beta * beta) * precision * recall / (beta * beta * precision + recall);
+	}
+
+	struct Pass
+	{
+		std::vector<std::string> translations;
+		std::vector<double> latencies;
+	};
+
+	Pass translateAll(CTranslate2WrapperImpl& translator, const std::vector<std::string>& sources, bool useVocabularyMap)
+	{
+		translator.translationOptions.use_vmap = useVocabularyMap;
+		// Warm-up, so neither pass pays first-use allocations.
+		translator.translate(sources.front());
+
+		Pass pass;
+		for (const std::string& source : sources)
+		{
+			const auto start = Clock::now();
+			pass.translations.push_back(translator.translate(source));
+			pass.latencies.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+		}
+		return pass;
+	}
+
+	nlohmann::json summarize(const Pass& pass, const std::vector<std::string>& references)
+	{
+		double quality = 0;
+		double total = 0;
+		for (size_t i = 0; i < pass.translations.size(); ++i)
+		{
+			quality += chrF(pass.translations[i], references[i]);
+			total += pass.latencies[i];
+		}
+		const double sentences = static_cast<double>(pass.translations.size());
+		return {
+			{ "chrf", quality / sentences },
+			{ "mean_ms", total / sentences },
+			{ "p50_ms", percentile(pass.latencies, 0.50) },
+			{ "p99_ms", percentile(pass.latencies, 0.99) },
+		};
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const Options options = parseArguments(argc, argv);
+		const std::vector<std::string> sources = readLines(options.sourcePath);
+		const std::vector<std::string> targets = readLines(options.targetPath);
+		if (sources.size() != targets.size())
+		{
+			throw std::runtime_error("The source and target files do not have the same number of lines.");
+		}
+		const size_t holdout = std::min(options.holdout, sources.size() / 2);
+		const size_t trainingPairs = sources.size() - holdout;
+
+		// 1. Build the map from the training part and install it in the model directory.
+		const auto buildStart = Clock::now();
+		VocabularyMapBuilder builder(TokenizerService::forModel(options.modelPath), options.map);
+		for (size_t i = 0; i < trainingPairs; ++i)
+		{
+			builder.addPair(sources[i], targets[i]);
+		}
+		builder.install(options.modelPath);
+
+		nlohmann::json report;
+		report["model"] = options.modelPath;
+		report["training_pairs"] = builder.pairs();
+		report["build_ms"] = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+		// 2. Translate the held-out sentences with and without the map. The model is
+		//    loaded after installing, so it picks vmap.txt up.
+		if (holdout > 0)
+		{
+			TranslatorConfig config;
+			config.cacheCapacityBytes = 0;
+			config.useTunedProfile = false;
+			config.useVocabularyMap = true;
+			CTranslate2WrapperImpl translator(options.modelPath, config);
+			if (!translator.hasVocabularyMap())
+			{
+				throw std::runtime_error("The model did not load the installed vocabulary map.");
+			}
+
+			const std::vector<std::string> heldOutSources(sources.begin() + trainingPairs, sources.end());
+			const std::vector<std::string> references(targets.begin() + trainingPairs, targets.end());
+
+			// Average output layer size per sentence, against the full vocabulary.
+			double candidates = 0;
+			const ctranslate2::VocabularyMap& vocabularyMap = *translator.model->get_vocabulary_map();
+			for (const std::string& source : heldOutSources)
+			{
+				std::vector<std::string> tokens = translator.tokenizer->encode(source);
+				tokens.push_back("</s>");
+				candidates += vocabularyMap.get_candidates({ tokens }, { std::vector<size_t>() }).size();
+			}
+
+			const Pass full = translateAll(translator, heldOutSources, false);
+			const Pass mapped = translateAll(translator, heldOutSources, true);
+
+			size_t identical = 0;
+			for (size_t i = 0; i < full.translations.size(); ++i)
+			{
+				identical += full.translations[i] == mapped.translations[i];
+			}
+
+			report["held_out_pairs"] = holdout;
+			report["target_vocabulary"] = translator.model->get_target_vocabulary().size();
+			report["mean_candidates"] = candidates / holdout;
+			report["full_vocabulary"] = summarize(full, references);
+			report["vocabulary_map"] = summarize(mapped, references);
+			report["identical_outputs"] = static_cast<double>(identical) / holdout;
+		}
+
+		const std::string json = report.dump(2);
+		if (options.output.empty())
+		{
+			std::cout << json << std::endl;
+		}
+		else
+		{
+			std::ofstream(options.output) << json << std::endl;
+		}
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "ct2palette-vmap: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// Minimal assertions for the native core tests. A failed CHECK prints the expression,
+// its location and an optional message, and the test keeps going; main returns
+// checkResult() so CTest sees every failure of a run at once.
+
+#include <cstdlib>
+#include <iostream>
+
+namespace CheckState {
+    inline int failures = 0;
+}
+
+#define CHECK_MESSAGE(condition, message)                                                  \
+    do                                                                                     \
+    {                                                                                      \
+        if (!(condition))                                                                  \
+        {                                                                                  \
+            ++CheckState::failures;                                                        \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed: " \
+                      << message << std::endl;                                             \
+        }                                                                                  \
+    } while (false)
+
+#define CHECK(condition) CHECK_MESSAGE(condition, "")
+
+inline int checkResult()
+{
+    if (CheckState::failures != 0)
+    {
+        std::cerr << CheckState::failures << " check(s) failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
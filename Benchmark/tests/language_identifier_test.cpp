@@ -0,0 +1,110 @@
+// LanguageIdentifier: palette-sized English must keep the direct route, while text that
+// clearly is another language is still identified with enough confidence to pivot.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "LanguageIdentifier.h"
+#include "check.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	// Mirrors Translate.GetTranslation: only a confident identification leaves the
+	// direct en->zh route.
+	bool routesDirectly(const LanguageIdentification& identification)
+	{
+		return identification.confidence < LanguageIdentifier::confidenceThreshold
+			|| std::strcmp(identification.language, "en") == 0
+			|| std::strcmp(identification.language, "und") == 0;
+	}
+
+	void checkDirect(const std::vector<std::string>& texts)
+	{
+		for (const std::string& text : texts)
+		{
+			const LanguageIdentification identification = LanguageIdentifier::identify(text);
+			CHECK_MESSAGE(routesDirectly(identification),
+				'"' << text << "\" -> " << identification.language << " (" << identification.confidence << ")");
+		}
+	}
+
+	void checkIdentified(const char* language, const std::vector<std::string>& texts)
+	{
+		for (const std::string& text : texts)
+		{
+			const LanguageIdentification identification = LanguageIdentifier::identify(text);
+			CHECK_MESSAGE(std::strcmp(identification.language, language) == 0
+				&& identification.confidence >= LanguageIdentifier::confidenceThreshold,
+				'"' << text << "\" -> " << identification.language << " (" << identification.confidence
+				<< "), expected " << language);
+		}
+	}
+}
+
+int main()
+{
+	// 1. Palette input: single words, commands and short phrases.
+	checkDirect({
+		"hello", "hello world", "computer", "download", "dog", "delete", "cancel", "save as",
+		"password", "open file", "Hola amigo", "settings", "copy link", "print preview",
+		"new folder", "undo", "the", "a cat", "OK", "Windows Terminal", "café latte",
+		"turn on dark mode", "take a screenshot", "check for updates", "empty the recycle bin",
+	});
+
+	// 2. Longer English, including text that shares no words with the training corpus.
+	checkDirect({
+		"Please open the file and save it as a new document.",
+		"How do I change the default browser on my computer?",
+		"The quick brown fox jumps over the lazy dog.",
+		"Download the latest version of the application from the website.",
+		"Everyone has the right to education.",
+	});
+	checkIdentified("en", {
+		"Everyone has the right to freedom of thought and to the protection of the law.",
+		"Please make sure that all of the changes are saved before you close the window.",
+	});
+
+	// 3. Other languages, sentence length.
+	checkIdentified("fr", {
+		"Je voudrais ouvrir le fichier et enregistrer les modifications.",
+		"Où est la gare la plus proche, s'il vous plaît ?",
+		"Nous avons besoin de plus de temps pour terminer le projet.",
+	});
+	checkIdentified("de", {
+		"Ich möchte die Datei öffnen und die Änderungen speichern.",
+		"Wir müssen die Datei heute noch an den Kunden schicken.",
+		"Wir brauchen mehr Zeit, um das Projekt abzuschließen.",
+	});
+	checkIdentified("es", {
+		"Quiero abrir el archivo y guardar los cambios.",
+		"¿Dónde está la estación de tren más cercana?",
+		"Necesitamos más tiempo para terminar el proyecto.",
+	});
+	checkIdentified("it", {
+		"Vorrei aprire il file e salvare le modifiche.",
+		"Dove si trova la stazione più vicina?",
+		"Abbiamo bisogno di più tempo per finire il progetto.",
+	});
+	checkIdentified("pt", {
+		"Eu quero abrir o arquivo e guardar as alterações.",
+		"Onde fica a estação de comboios mais próxima?",
+		"Precisamos de mais tempo para terminar o projeto.",
+	});
+	checkIdentified("nl", {
+		"Ik wil het bestand openen en de wijzigingen opslaan.",
+		"Waar is het dichtstbijzijnde station?",
+		"We hebben meer tijd nodig om het project af te ronden.",
+	});
+
+	// 4. Scripts that name their language, and text without letters.
+	checkIdentified("zh", { "你好，世界" });
+	checkIdentified("ja", { "こんにちは世界" });
+	checkIdentified("ko", { "안녕하세요" });
+	checkIdentified("ru", { "Привет, мир" });
+	CHECK(std::strcmp(LanguageIdentifier::identify("12345 !?").language, "und") == 0);
+	CHECK(std::strcmp(LanguageIdentifier::identify("").language, "und") == 0);
+
+	return checkResult();
+}
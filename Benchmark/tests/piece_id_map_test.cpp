@@ -0,0 +1,78 @@
+// PieceIdMap: decoding model target ids through SentencePiece ids gives the text the
+// piece path (toTargetPieces + TokenizerService::decode) gives, for every token of the
+// target vocabulary on its own and next to its neighbours.
+//
+//   ct2palette-test-piece_id_map MODEL_DIR
+//
+// Needs a converted opus-mt model; CTest passes CT2PALETTE_TEST_MODEL.
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CTranslate2WrapperImpl.h"
+#include "ReplicaRunner.h"
+#include "check.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	// CTest reports the test as skipped (SKIP_RETURN_CODE).
+	constexpr int skipped = 77;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "usage: ct2palette-test-piece_id_map MODEL_DIR" << std::endl;
+		return skipped;
+	}
+
+	TranslatorConfig config;
+	config.replicas = 1;
+	config.threadsPerReplica = 1;
+	config.cacheCapacityBytes = 0;
+	config.useTunedProfile = false;
+	CTranslate2WrapperImpl translator(argv[1], config);
+	if (!translator.pieceIds)
+	{
+		std::cerr << "The model adds source start or end tokens; it always decodes piece strings." << std::endl;
+		return skipped;
+	}
+
+	const PieceIdMap& pieceIds = *translator.pieceIds;
+	const TokenizerService& tokenizer = *translator.tokenizer;
+	const auto decodePieces = [&](const std::vector<size_t>& ids)
+	{
+		return tokenizer.decode(toTargetPieces(*translator.model, ids));
+	};
+
+	// 1. Every target token alone, including the ones target.spm does not have.
+	const size_t vocabularySize = translator.model->get_target_vocabulary().size();
+	for (size_t id = 0; id < vocabularySize; ++id)
+	{
+		const std::vector<size_t> ids{ id };
+		const std::string expected = decodePieces(ids);
+		const std::string actual = pieceIds.decode(ids);
+		CHECK_MESSAGE(actual == expected, "token " << id << ": \"" << actual << "\" instead of \"" << expected << '"');
+	}
+
+	// 2. Runs of neighbouring ids, so word boundaries and byte pieces are joined too.
+	constexpr size_t run = 8;
+	for (size_t first = 0; first < vocabularySize; first += run / 2)
+	{
+		std::vector<size_t> ids;
+		for (size_t id = first; id < std::min(first + run, vocabularySize); ++id)
+		{
+			ids.push_back(id);
+		}
+		const std::string expected = decodePieces(ids);
+		const std::string actual = pieceIds.decode(ids);
+		CHECK_MESSAGE(actual == expected, "tokens " << first << ".." << ids.back() << ": \"" << actual
+			<< "\" instead of \"" << expected << '"');
+	}
+
+	return checkResult();
+}
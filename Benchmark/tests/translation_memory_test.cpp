@@ -0,0 +1,149 @@
+// TranslationMemory: compiled files open and answer exact and near lookups, added pairs
+// shadow stored ones before and after save(), and a damaged or hostile file is rejected
+// with std::runtime_error instead of sending a lookup out of the mapping.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "TranslationMemory.h"
+#include "check.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	// Mirrors the file header defined in TranslationMemory.cpp.
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t entryCount;
+		uint32_t gramCount;
+		uint32_t reserved;
+		uint64_t postingCount;
+		uint64_t stringBytes;
+	};
+
+	const std::string memoryPath = (std::filesystem::temp_directory_path() / "ct2palette-test.ct2tm").u8string();
+
+	void writeFile(const std::string& bytes)
+	{
+		std::ofstream(memoryPath, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	// Whether the file opens; a lookup then also has to stay inside the mapping.
+	bool opens(const std::string& bytes)
+	{
+		writeFile(bytes);
+		try
+		{
+			TranslationMemory memory(memoryPath);
+			memory.find("hello world", 0.5f);
+			return true;
+		}
+		catch (const std::runtime_error&)
+		{
+			return false;
+		}
+	}
+
+	template <typename T>
+	std::string patched(std::string bytes, size_t offset, T value)
+	{
+		std::memcpy(&bytes[offset], &value, sizeof(value));
+		return bytes;
+	}
+
+	const std::string compiled = TranslationMemory::compile({
+		{ "hello world", "first" },
+		{ "hello there", "second" },
+		{ "good bye", "third" },
+	});
+
+	// 1. Exact and near lookups on a compiled file.
+	void checkFind()
+	{
+		writeFile(compiled);
+		const TranslationMemory memory(memoryPath);
+		CHECK(memory.statistics().entries == 3);
+
+		const auto exact = memory.find("hello there", 1.0f);
+		CHECK(exact && exact->target == "second" && exact->score == 1.0f);
+		CHECK(!memory.find("hello there!", 1.0f));
+
+		const auto near = memory.find("hello world!", 0.8f);
+		CHECK_MESSAGE(near && near->source == "hello world" && near->score < 1.0f && near->score >= 0.8f,
+			"near match " << (near ? near->source : "(none)") << " scored " << (near ? near->score : 0.0f));
+		CHECK(!memory.find("something else entirely", 0.8f));
+	}
+
+	// 2. An added pair shadows the stored one, and save() keeps it.
+	void checkAdd()
+	{
+		writeFile(compiled);
+		{
+			TranslationMemory memory(memoryPath);
+			memory.add("hello world", "replaced");
+			memory.add("see you", "fourth");
+			CHECK(memory.statistics().entries == 4);
+			const auto shadowed = memory.find("hello world", 1.0f);
+			CHECK(shadowed && shadowed->target == "replaced");
+			memory.save();
+			CHECK(memory.statistics().entries == 4);
+		}
+
+		const TranslationMemory reopened(memoryPath);
+		CHECK(reopened.statistics().entries == 4);
+		const auto shadowed = reopened.find("hello world", 1.0f);
+		CHECK(shadowed && shadowed->target == "replaced");
+		const auto added = reopened.find("see you", 1.0f);
+		CHECK(added && added->target == "fourth");
+	}
+
+	// 3. Damaged files, each differing from a valid one in a single field.
+	void checkCorrupt()
+	{
+		Header header;
+		std::memcpy(&header, compiled.data(), sizeof(header));
+		const size_t entries = header.entryCount;
+		const size_t exact = sizeof(Header);
+		const size_t grams = exact + entries * 16 + entries * 2 * sizeof(uint32_t);
+		const size_t postings = grams + (size_t(header.gramCount) + 1) * 8;
+		const size_t offsets = postings + (header.postingCount + 1) / 2 * 2 * sizeof(uint32_t);
+
+		CHECK(opens(compiled));
+		CHECK_MESSAGE(!opens(patched<uint32_t>(compiled, exact + 8, 7)), "exact slot naming no entry");
+		CHECK_MESSAGE(!opens(patched<uint32_t>(compiled, postings, 9)), "posting naming no entry");
+		CHECK_MESSAGE(!opens(patched<uint32_t>(compiled, grams + 4, 1000)), "trigram postings past the list");
+		CHECK_MESSAGE(!opens(patched<uint64_t>(compiled, offsets, 1)), "strings not starting at 0");
+		CHECK_MESSAGE(!opens(patched<uint64_t>(compiled, offsets + 8, 1000)), "offset past the strings");
+		CHECK_MESSAGE(!opens(patched<uint64_t>(compiled, offsetof(Header, postingCount), ~uint64_t(0))), "posting count");
+		CHECK_MESSAGE(!opens(compiled.substr(0, compiled.size() - 1)), "truncated file");
+
+		// A header whose gram count wraps gramCount + 1 to 0: with one offset, these 48
+		// bytes are exactly the size a 32-bit sum would expect.
+		Header hostile = header;
+		hostile.entryCount = 0;
+		hostile.gramCount = 0xFFFFFFFFu;
+		hostile.postingCount = 0;
+		hostile.stringBytes = 0;
+		std::string bytes(reinterpret_cast<const char*>(&hostile), sizeof(hostile));
+		bytes.append(sizeof(uint64_t), '\0');
+		CHECK(bytes.size() == 48);
+		CHECK_MESSAGE(!opens(bytes), "gram count wrapping to 0");
+	}
+}
+
+int main()
+{
+	checkFind();
+	checkAdd();
+	checkCorrupt();
+	std::error_code error;
+	std::filesystem::remove(memoryPath, error);
+	return checkResult();
+}
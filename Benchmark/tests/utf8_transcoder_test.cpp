@@ -0,0 +1,209 @@
+// Utf8Transcoder: every scalar value survives UTF-16 -> UTF-8 -> UTF-16, on and off the
+// SSE2 ASCII path, and invalid input is replaced by U+FFFD once per maximal invalid
+// subpart: lone surrogates, overlong forms, encoded surrogates, values above U+10FFFF
+// and truncated sequences.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utf8Transcoder.h"
+#include "check.h"
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	// Reference encoders, one code point at a time.
+	void appendUtf16(std::u16string& out, uint32_t codePoint)
+	{
+		if (codePoint >= 0x10000)
+		{
+			codePoint -= 0x10000;
+			out += static_cast<char16_t>(0xD800 + (codePoint >> 10));
+			out += static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+		}
+		else
+		{
+			out += static_cast<char16_t>(codePoint);
+		}
+	}
+
+	void appendUtf8(std::string& out, uint32_t codePoint)
+	{
+		if (codePoint < 0x80)
+		{
+			out += static_cast<char>(codePoint);
+		}
+		else if (codePoint < 0x800)
+		{
+			out += static_cast<char>(0xC0 | (codePoint >> 6));
+			out += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else if (codePoint < 0x10000)
+		{
+			out += static_cast<char>(0xE0 | (codePoint >> 12));
+			out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			out += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else
+		{
+			out += static_cast<char>(0xF0 | (codePoint >> 18));
+			out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			out += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+	}
+
+	std::string toUtf8(const std::u16string& in, bool& valid)
+	{
+		std::string out(maxUtf8Length(in.size()), '\0');
+		const TranscodeResult result = utf16ToUtf8(in.data(), in.size(), out.data());
+		out.resize(result.length);
+		valid = result.valid;
+		return out;
+	}
+
+	std::u16string toUtf16(const std::string& in, bool& valid)
+	{
+		std::u16string out(maxUtf16Length(in.size()), u'\0');
+		const TranscodeResult result = utf8ToUtf16(in.data(), in.size(), out.data());
+		out.resize(result.length);
+		valid = result.valid;
+		return out;
+	}
+
+	std::string hex(const std::string& bytes)
+	{
+		static const char digits[] = "0123456789ABCDEF";
+		std::string text;
+		for (const unsigned char byte : bytes)
+		{
+			text += digits[byte >> 4];
+			text += digits[byte & 0xF];
+			text += ' ';
+		}
+		return text;
+	}
+
+	// 1. All scalar values, in blocks preceded by ASCII runs of every length up to 33,
+	// so each block starts at a different offset from the 16-unit SIMD loop.
+	void checkRoundTrip()
+	{
+		constexpr uint32_t blockSize = 61;
+		size_t asciiRun = 0;
+		for (uint32_t first = 0; first <= 0x10FFFF; first += blockSize)
+		{
+			std::u16string utf16;
+			std::string utf8;
+			for (size_t i = 0; i < asciiRun; ++i)
+			{
+				appendUtf16(utf16, 'a' + i % 26);
+				appendUtf8(utf8, 'a' + i % 26);
+			}
+			asciiRun = (asciiRun + 1) % 34;
+			for (uint32_t codePoint = first; codePoint < first + blockSize && codePoint <= 0x10FFFF; ++codePoint)
+			{
+				if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+				{
+					continue;
+				}
+				appendUtf16(utf16, codePoint);
+				appendUtf8(utf8, codePoint);
+			}
+
+			bool valid = false;
+			const std::string encoded = toUtf8(utf16, valid);
+			CHECK_MESSAGE(valid && encoded == utf8, "UTF-16 -> UTF-8 of U+" << std::hex << first << std::dec);
+			const std::u16string decoded = toUtf16(utf8, valid);
+			CHECK_MESSAGE(valid && decoded == utf16, "UTF-8 -> UTF-16 of U+" << std::hex << first << std::dec);
+		}
+	}
+
+	void checkUtf16(const std::u16string& in, const std::string& expected)
+	{
+		bool valid = true;
+		const std::string actual = toUtf8(in, valid);
+		CHECK_MESSAGE(!valid && actual == expected, "got " << hex(actual) << "instead of " << hex(expected));
+	}
+
+	void checkUtf8(const std::string& in, const std::u16string& expected)
+	{
+		bool valid = true;
+		const std::u16string actual = toUtf16(in, valid);
+		CHECK_MESSAGE(!valid && actual == expected, "input " << hex(in) << "gave " << actual.size()
+			<< " code units instead of " << expected.size());
+	}
+
+	// 2. Unpaired surrogates in UTF-16 become one replacement each.
+	void checkLoneSurrogates()
+	{
+		const std::string replacement = "\xEF\xBF\xBD";
+		checkUtf16(u"\xD800", replacement);
+		checkUtf16(u"\xDC00", replacement);
+		checkUtf16(u"a\xDBFF", "a" + replacement);
+		checkUtf16(u"\xDFFFz", replacement + "z");
+		checkUtf16(std::u16string(u"\xD83D") + u"a", replacement + "a");
+		checkUtf16(std::u16string(u"\xDE00") + u"\xD83D", replacement + replacement);
+		checkUtf16(std::u16string(u"\xD83D") + u"\xD83D\xDE00", replacement + "\xF0\x9F\x98\x80");
+		// Behind a full SIMD block and at its last code unit.
+		checkUtf16(std::u16string(16, u'x') + u"\xD800", std::string(16, 'x') + replacement);
+		checkUtf16(std::u16string(15, u'x') + u"\xDC00" + std::u16string(16, u'y'),
+			std::string(15, 'x') + replacement + std::string(16, 'y'));
+	}
+
+	// 3. Malformed UTF-8: one replacement per maximal subpart (Unicode 3.9, U+FFFD
+	// substitution of maximal subparts).
+	void checkInvalidUtf8()
+	{
+		const std::u16string r = u"\xFFFD";
+		// Overlong encodings: the lead byte already rules them out.
+		checkUtf8("\xC0\x80", r + r);
+		checkUtf8("\xC1\xBF", r + r);
+		checkUtf8("\xE0\x80\x80", r + r + r);
+		checkUtf8("\xE0\x9F\xBF", r + r + r);
+		checkUtf8("\xF0\x80\x80\x80", r + r + r + r);
+		checkUtf8("\xF0\x8F\xBF\xBF", r + r + r + r);
+		// Surrogates encoded in UTF-8 and values above U+10FFFF.
+		checkUtf8("\xED\xA0\x80", r + r + r);
+		checkUtf8("\xED\xBF\xBF", r + r + r);
+		checkUtf8("\xF4\x90\x80\x80", r + r + r + r);
+		checkUtf8("\xF5\x80\x80\x80", r + r + r + r);
+		checkUtf8("\xFF", r);
+		// Stray continuation bytes.
+		checkUtf8("\x80", r);
+		checkUtf8("a\xBF" "b", u"a" + r + u"b");
+		// Truncated sequences, at the end of the input and before another character.
+		checkUtf8("\xC3", r);
+		checkUtf8("\xE4\xB8", r);
+		checkUtf8("\xF0\x9F\x98", r);
+		checkUtf8("\xE4\xB8" "a", r + u"a");
+		checkUtf8("\xF0\x9F\x98\xE4\xB8\xAD", r + u"\x4E2D");
+		checkUtf8(std::string(16, 'x') + "\xF0\x9F", std::u16string(16, u'x') + r);
+		checkUtf8(std::string(15, 'x') + "\xE4" + std::string(16, 'y'),
+			std::u16string(15, u'x') + r + std::u16string(16, u'y'));
+	}
+
+	// 4. The scratch variants return the same text, also after a longer string grew the buffer.
+	void checkScratch()
+	{
+		const std::u16string longText = std::u16string(40, u'a') + u"\x4E2D\x6587";
+		const std::u16string shortText = u"\x00E9t\x00E9";
+		bool valid = false;
+		CHECK(utf16ToUtf8Scratch(longText.data(), longText.size()) == toUtf8(longText, valid));
+		CHECK(utf16ToUtf8Scratch(shortText.data(), shortText.size()) == toUtf8(shortText, valid));
+		const std::string longUtf8 = toUtf8(longText, valid);
+		const std::string shortUtf8 = toUtf8(shortText, valid);
+		CHECK(utf8ToUtf16Scratch(longUtf8) == longText);
+		CHECK(utf8ToUtf16Scratch(shortUtf8) == shortText);
+		CHECK(utf8ToUtf16Scratch(std::string_view()).empty());
+	}
+}
+
+int main()
+{
+	checkRoundTrip();
+	checkLoneSurrogates();
+	checkInvalidUtf8();
+	checkScratch();
+	return checkResult();
+}
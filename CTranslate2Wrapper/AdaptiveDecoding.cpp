@@ -0,0 +1,163 @@
+#include "AdaptiveDecoding.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// Up to count values spread over the sorted distinct values, lowest first, plus
+		// one below all of them that disables the check.
+		std::vector<float> candidateThresholds(std::vector<float> values, size_t count)
+		{
+			std::sort(values.begin(), values.end());
+			values.erase(std::unique(values.begin(), values.end()), values.end());
+
+			std::vector<float> candidates = { std::numeric_limits<float>::lowest() };
+			for (size_t i = 0; i < count && !values.empty(); ++i)
+			{
+				const float value = values[i * values.size() / count];
+				if (value != candidates.back())
+				{
+					candidates.push_back(value);
+				}
+			}
+			return candidates;
+		}
+	}
+
+	bool GreedyConfidence::confident(const ConfidenceThresholds& thresholds) const
+	{
+		return finished
+			&& tokens > 0
+			&& minTokenLogProb >= thresholds.minTokenLogProb
+			&& meanLogProb >= thresholds.minMeanLogProb;
+	}
+
+	void GreedyConfidenceProbe::attach(ctranslate2::DecodingOptions& options)
+	{
+		options.return_scores = true;
+		auto previous = std::move(options.callback);
+		options.callback = [this, previous = std::move(previous)](ctranslate2::DecodingStepResult step)
+		{
+			// Greedy search reports the log-probability of each selected token, end token excluded.
+			if (step.score)
+			{
+				m_minLogProb = m_steps == 0 ? *step.score : std::min(m_minLogProb, *step.score);
+				m_sumLogProb += *step.score;
+				++m_steps;
+			}
+			return previous ? previous(std::move(step)) : false;
+		};
+	}
+
+	GreedyConfidence GreedyConfidenceProbe::confidence(const ctranslate2::DecodingResult& result, size_t maxLength) const
+	{
+		GreedyConfidence confidence;
+		if (result.hypotheses.empty())
+		{
+			return confidence;
+		}
+
+		confidence.tokens = result.hypotheses[0].size();
+		confidence.finished = maxLength == 0 || confidence.tokens < maxLength;
+		confidence.minTokenLogProb = m_minLogProb;
+		// The final score also counts the tokens of a forced prefix, which the steps do not.
+		if (!result.scores.empty() && confidence.tokens > 0)
+		{
+			confidence.meanLogProb = result.scores[0] / static_cast<float>(confidence.tokens);
+		}
+		else if (m_steps > 0)
+		{
+			confidence.meanLogProb = m_sumLogProb / static_cast<float>(m_steps);
+		}
+		return confidence;
+	}
+
+	ConfidenceThresholds EscalationPolicy::thresholds() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_thresholds;
+	}
+
+	void EscalationPolicy::setThresholds(const ConfidenceThresholds& thresholds)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_thresholds = thresholds;
+	}
+
+	bool EscalationPolicy::shouldEscalate(const GreedyConfidence& confidence) const
+	{
+		return !confidence.confident(thresholds());
+	}
+
+	void EscalationPolicy::recordRequest(bool escalated)
+	{
+		m_requests.fetch_add(1, std::memory_order_relaxed);
+		if (escalated)
+		{
+			m_escalations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	AdaptiveDecodingStatistics EscalationPolicy::statistics() const
+	{
+		AdaptiveDecodingStatistics statistics;
+		statistics.requests = m_requests.load(std::memory_order_relaxed);
+		statistics.escalations = m_escalations.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	ConfidenceThresholds EscalationPolicy::calibrate(const std::vector<CalibrationSample>& samples, double targetAgreement)
+	{
+		if (samples.empty())
+		{
+			return ConfidenceThresholds();
+		}
+
+		// 1. Candidate values: quantiles of what the samples scored.
+		constexpr size_t candidatesPerAxis = 32;
+		std::vector<float> tokenValues;
+		std::vector<float> meanValues;
+		for (const CalibrationSample& sample : samples)
+		{
+			tokenValues.push_back(sample.greedy.minTokenLogProb);
+			meanValues.push_back(sample.greedy.meanLogProb);
+		}
+		const std::vector<float> tokenCandidates = candidateThresholds(std::move(tokenValues), candidatesPerAxis);
+		const std::vector<float> meanCandidates = candidateThresholds(std::move(meanValues), candidatesPerAxis);
+
+		// 2. Every pair: the greedy hypotheses it keeps must agree with beam search often
+		//    enough; of those pairs, keep the one escalating the fewest samples. Stricter
+		//    pairs come later, so on a tie the most permissive one wins.
+		ConfidenceThresholds best;
+		size_t bestEscalations = samples.size() + 1;
+		for (const float minToken : tokenCandidates)
+		{
+			for (const float minMean : meanCandidates)
+			{
+				const ConfidenceThresholds candidate{ minToken, minMean };
+				size_t kept = 0;
+				size_t agreeing = 0;
+				for (const CalibrationSample& sample : samples)
+				{
+					if (sample.greedy.confident(candidate))
+					{
+						++kept;
+						agreeing += sample.matchesBeam ? 1 : 0;
+					}
+				}
+
+				const bool accurate = kept == 0 || static_cast<double>(agreeing) >= targetAgreement * static_cast<double>(kept);
+				const size_t escalations = samples.size() - kept;
+				if (accurate && escalations < bestEscalations)
+				{
+					best = candidate;
+					bestEscalations = escalations;
+				}
+			}
+		}
+		return best;
+	}
+
+}
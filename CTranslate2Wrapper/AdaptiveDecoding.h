@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    // Below either value, a greedy hypothesis is decoded again with beam search.
+    struct ConfidenceThresholds
+    {
+        // Log-probability of the least likely token greedy search selected.
+        float minTokenLogProb = -2.5f;
+        // Final score over the hypothesis length: the average token log-probability.
+        float minMeanLogProb = -0.6f;
+    };
+
+    // How sure greedy search was of one hypothesis.
+    struct GreedyConfidence
+    {
+        size_t tokens = 0;
+        float minTokenLogProb = 0;
+        float meanLogProb = 0;
+        // False when decoding stopped at the maximum length instead of the end token.
+        bool finished = false;
+
+        bool confident(const ConfidenceThresholds& thresholds) const;
+    };
+
+    // Collects the log-probability of every token of a greedy decoding run of one example.
+    // The probe must outlive the run it is attached to.
+    class GreedyConfidenceProbe
+    {
+    public:
+        // Turns on scores and chains a step callback in front of options.callback.
+        void attach(ctranslate2::DecodingOptions& options);
+
+        // Confidence of the run's hypothesis. maxLength is the run's maximum length.
+        GreedyConfidence confidence(const ctranslate2::DecodingResult& result, size_t maxLength) const;
+
+    private:
+        size_t m_steps = 0;
+        float m_minLogProb = 0;
+        float m_sumLogProb = 0;
+    };
+
+    struct AdaptiveDecodingStatistics
+    {
+        size_t requests = 0;     // Translations decoded greedily first.
+        size_t escalations = 0;  // Of those, the ones decoded again with beam search.
+    };
+
+    // One translation decoded both ways, for calibration.
+    struct CalibrationSample
+    {
+        GreedyConfidence greedy;
+        // Whether beam search produced the same hypothesis.
+        bool matchesBeam = false;
+    };
+
+    // Decides when greedy output is kept and counts how often it is not.
+    //
+    // For palette input greedy search mostly finds the beam search hypothesis at a
+    // fraction of the cost; when it does not, the greedy run usually picked a token the
+    // model was unsure of, or the whole hypothesis scores low. Thresholds are calibrated
+    // per model on sentences decoded both ways (see calibrate).
+    class EscalationPolicy
+    {
+    public:
+        ConfidenceThresholds thresholds() const;
+        void setThresholds(const ConfidenceThresholds& thresholds);
+
+        bool shouldEscalate(const GreedyConfidence& confidence) const;
+
+        void recordRequest(bool escalated);
+        AdaptiveDecodingStatistics statistics() const;
+
+        // The thresholds that escalate the fewest samples while the greedy hypotheses
+        // kept match beam search for at least targetAgreement of them. The defaults
+        // when there are no samples.
+        static ConfidenceThresholds calibrate(const std::vector<CalibrationSample>& samples, double targetAgreement);
+
+    private:
+        mutable std::mutex m_mutex;
+        ConfidenceThresholds m_thresholds;
+
+        std::atomic<size_t> m_requests{ 0 };
+        std::atomic<size_t> m_escalations{ 0 };
+    };
+
+}
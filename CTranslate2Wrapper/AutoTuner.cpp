@@ -0,0 +1,332 @@
+#include "AutoTuner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+#include "CTranslate2WrapperImpl.h"
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// Palette-sized English input: single words, phrases and a few full sentences.
+		const char* const probeCorpus[] = {
+			"hello",
+			"good morning",
+			"translate this",
+			"Where is the nearest train station?",
+			"The meeting has been moved to Thursday afternoon.",
+			"Please send me the report before the end of the day.",
+			"I would like to book a table for two people tonight.",
+			"This function returns the number of elements in the list.",
+			"Could you explain how the new scheduling system works?",
+			"The weather forecast says it will rain all weekend.",
+			"We need to update the documentation before the release.",
+			"keyboard shortcut",
+			"How long does it take to get to the airport from here?",
+			"The results of the experiment were better than expected.",
+			"Don't forget to save your work before closing the application.",
+			"machine translation quality",
+		};
+
+		double percentile(std::vector<double> values, double fraction)
+		{
+			if (values.empty())
+			{
+				return 0;
+			}
+			std::sort(values.begin(), values.end());
+			const size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+			return values[std::min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+		}
+
+		double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		std::vector<ctranslate2::ComputeType> supportedComputeTypes()
+		{
+			std::vector<ctranslate2::ComputeType> types;
+			if (ctranslate2::mayiuse_int8(ctranslate2::Device::CPU))
+				types.push_back(ctranslate2::ComputeType::INT8);
+			if (ctranslate2::mayiuse_int16(ctranslate2::Device::CPU))
+				types.push_back(ctranslate2::ComputeType::INT16);
+			if (ctranslate2::mayiuse_bfloat16(ctranslate2::Device::CPU))
+				types.push_back(ctranslate2::ComputeType::BFLOAT16);
+			types.push_back(ctranslate2::ComputeType::FLOAT32);
+			return types;
+		}
+
+		// 1, 2, 4, ... replicas, splitting the cores evenly between them.
+		std::vector<TranslatorConfig> candidateLayouts()
+		{
+			const size_t cores = TranslatorConfig::detectedCores();
+			std::vector<TranslatorConfig> layouts;
+			for (size_t replicas = 1; replicas <= cores && replicas <= 8; replicas *= 2)
+			{
+				TranslatorConfig config;
+				config.replicas = replicas;
+				config.threadsPerReplica = std::max<size_t>(1, cores / replicas);
+				config.useTunedProfile = false;
+				layouts.push_back(config);
+			}
+			return layouts;
+		}
+
+		bool dominates(const TunedProfile& a, const TunedProfile& b)
+		{
+			const bool noWorse = a.p50 <= b.p50 && a.p99 <= b.p99 && a.throughput >= b.throughput;
+			const bool better = a.p50 < b.p50 || a.p99 < b.p99 || a.throughput > b.throughput;
+			return noWorse && better;
+		}
+
+		nlohmann::json toJson(const TunedProfile& profile)
+		{
+			return {
+				{ "compute_type", ctranslate2::compute_type_to_str(profile.config.computeType.value_or(ctranslate2::ComputeType::INT8)) },
+				{ "replicas", profile.config.replicas },
+				{ "threads_per_replica", profile.config.threadsPerReplica },
+				{ "beam_size", profile.beamSize },
+				{ "max_batch_size", profile.maxBatchSize },
+				{ "p50_ms", profile.p50 },
+				{ "p99_ms", profile.p99 },
+				{ "sentences_per_second", profile.throughput },
+				{ "agreement", profile.agreement },
+			};
+		}
+
+		TunedProfile fromJson(const nlohmann::json& json)
+		{
+			TunedProfile profile;
+			profile.config.computeType = ctranslate2::str_to_compute_type(json.at("compute_type").get<std::string>());
+			profile.config.replicas = json.at("replicas").get<size_t>();
+			profile.config.threadsPerReplica = json.at("threads_per_replica").get<size_t>();
+			profile.beamSize = json.at("beam_size").get<size_t>();
+			profile.maxBatchSize = json.at("max_batch_size").get<size_t>();
+			profile.p50 = json.value("p50_ms", 0.0);
+			profile.p99 = json.value("p99_ms", 0.0);
+			profile.throughput = json.value("sentences_per_second", 0.0);
+			// Profiles saved before the agreement check count as unchecked.
+			profile.agreement = json.value("agreement", 0.0);
+			return profile;
+		}
+	}
+
+	std::string AutoTuner::profilePath(const std::string& modelDir)
+	{
+		std::string directory = modelDir;
+		while (!directory.empty() && (directory.back() == '/' || directory.back() == '\\'))
+		{
+			directory.pop_back();
+		}
+		return directory + ".autotune.json";
+	}
+
+	std::string AutoTuner::machineSignature()
+	{
+		return "cores=" + std::to_string(TranslatorConfig::detectedCores())
+			+ ";int8=" + std::to_string(ctranslate2::mayiuse_int8(ctranslate2::Device::CPU))
+			+ ";int16=" + std::to_string(ctranslate2::mayiuse_int16(ctranslate2::Device::CPU))
+			+ ";bf16=" + std::to_string(ctranslate2::mayiuse_bfloat16(ctranslate2::Device::CPU));
+	}
+
+	std::vector<TunedProfile> AutoTuner::sweep(const std::string& modelDir, const AutoTuneOptions& options)
+	{
+		const std::vector<std::string> corpus(std::begin(probeCorpus), std::end(probeCorpus));
+		// The batch pass needs enough sentences to fill several replicas.
+		std::vector<std::string> batchCorpus;
+		for (int copy = 0; copy < 4; ++copy)
+		{
+			batchCorpus.insert(batchCorpus.end(), corpus.begin(), corpus.end());
+		}
+
+		std::vector<TunedProfile> candidates;
+		for (const ctranslate2::ComputeType computeType : supportedComputeTypes())
+		{
+			for (TranslatorConfig layout : candidateLayouts())
+			{
+				layout.computeType = computeType;
+				CTranslate2WrapperImpl translator(modelDir, layout);
+
+				// The widest beam goes first: the others are compared with its output.
+				std::vector<size_t> beamSizes = options.beamSizes;
+				std::sort(beamSizes.begin(), beamSizes.end(), std::greater<size_t>());
+				std::vector<std::string> widestOutputs;
+
+				for (const size_t beamSize : beamSizes)
+				{
+					translator.translationOptions.beam_size = beamSize;
+
+					// Warm up (first-call allocations, caches), then measure single sentences.
+					translator.cache.clear();
+					translator.translate(corpus.front());
+
+					std::vector<double> latencies;
+					std::vector<std::string> outputs;
+					for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+					{
+						for (const std::string& sentence : corpus)
+						{
+							translator.cache.clear();
+							const auto start = std::chrono::steady_clock::now();
+							std::string output = translator.translate(sentence);
+							latencies.push_back(elapsedMilliseconds(start));
+							if (repetition == 0)
+								outputs.push_back(std::move(output));
+						}
+					}
+
+					double agreement = 1;
+					if (widestOutputs.empty())
+					{
+						widestOutputs = outputs;
+					}
+					else if (!outputs.empty())
+					{
+						size_t agreed = 0;
+						for (size_t i = 0; i < outputs.size(); ++i)
+						{
+							if (outputs[i] == widestOutputs[i])
+								++agreed;
+						}
+						agreement = static_cast<double>(agreed) / static_cast<double>(outputs.size());
+					}
+
+					for (const size_t maxBatchSize : options.maxBatchSizes)
+					{
+						translator.cache.clear();
+						const auto start = std::chrono::steady_clock::now();
+						translator.translateBatch(batchCorpus, maxBatchSize);
+						const double seconds = elapsedMilliseconds(start) / 1000.0;
+
+						TunedProfile profile;
+						profile.config = translator.config;
+						profile.beamSize = beamSize;
+						profile.maxBatchSize = maxBatchSize;
+						profile.p50 = percentile(latencies, 0.50);
+						profile.p99 = percentile(latencies, 0.99);
+						profile.throughput = seconds > 0 ? batchCorpus.size() / seconds : 0;
+						profile.agreement = agreement;
+						candidates.push_back(profile);
+					}
+				}
+			}
+		}
+		return candidates;
+	}
+
+	TunedProfile AutoTuner::select(const std::vector<TunedProfile>& candidates, double minAgreement)
+	{
+		if (candidates.empty())
+		{
+			throw std::invalid_argument("No auto-tune candidates to select from.");
+		}
+
+		// 1. Only beams that translate like the widest one compete on speed.
+		size_t widestBeam = 0;
+		for (const TunedProfile& candidate : candidates)
+		{
+			widestBeam = std::max(widestBeam, candidate.beamSize);
+		}
+		std::vector<TunedProfile> eligible;
+		for (const TunedProfile& candidate : candidates)
+		{
+			if (candidate.beamSize == widestBeam || candidate.agreement >= minAgreement)
+				eligible.push_back(candidate);
+		}
+
+		// 2. Pareto front of latency and throughput, then the lowest p50 close to the
+		//    best throughput.
+		std::vector<TunedProfile> front;
+		for (const TunedProfile& candidate : eligible)
+		{
+			const bool dominated = std::any_of(eligible.begin(), eligible.end(),
+				[&candidate](const TunedProfile& other) { return dominates(other, candidate); });
+			if (!dominated)
+			{
+				front.push_back(candidate);
+			}
+		}
+
+		double bestThroughput = 0;
+		for (const TunedProfile& profile : front)
+		{
+			bestThroughput = std::max(bestThroughput, profile.throughput);
+		}
+
+		const TunedProfile* selected = nullptr;
+		for (const TunedProfile& profile : front)
+		{
+			if (profile.throughput < 0.8 * bestThroughput)
+			{
+				continue;
+			}
+			// On equal latency, prefer the wider beam: it only costs what was measured.
+			if (!selected || profile.p50 < selected->p50 || (profile.p50 == selected->p50 && profile.beamSize > selected->beamSize))
+			{
+				selected = &profile;
+			}
+		}
+		return selected ? *selected : front.front();
+	}
+
+	TunedProfile AutoTuner::tune(const std::string& modelDir, const AutoTuneOptions& options)
+	{
+		const std::vector<TunedProfile> candidates = sweep(modelDir, options);
+		const TunedProfile selected = select(candidates, options.minAgreement);
+		save(modelDir, selected, candidates);
+		return selected;
+	}
+
+	void AutoTuner::save(const std::string& modelDir, const TunedProfile& selected, const std::vector<TunedProfile>& candidates)
+	{
+		nlohmann::json document;
+		document["machine"] = machineSignature();
+		document["selected"] = toJson(selected);
+		document["candidates"] = nlohmann::json::array();
+		for (const TunedProfile& candidate : candidates)
+		{
+			document["candidates"].push_back(toJson(candidate));
+		}
+
+		const std::string path = profilePath(modelDir);
+		std::ofstream file(path);
+		if (!file)
+		{
+			throw std::runtime_error("Failed to write the auto-tune profile '" + path + "'.");
+		}
+		file << document.dump(2);
+	}
+
+	std::optional<TunedProfile> AutoTuner::load(const std::string& modelDir)
+	{
+		std::ifstream file(profilePath(modelDir));
+		if (!file)
+		{
+			return std::nullopt;
+		}
+
+		// A profile from another machine (or a damaged file) is ignored, not an error.
+		const nlohmann::json document = nlohmann::json::parse(file, nullptr, /*allow_exceptions=*/false);
+		if (document.is_discarded() || !document.is_object() || document.value("machine", std::string()) != machineSignature())
+		{
+			return std::nullopt;
+		}
+
+		try
+		{
+			return fromJson(document.at("selected"));
+		}
+		catch (const std::exception&)
+		{
+			return std::nullopt;
+		}
+	}
+
+}
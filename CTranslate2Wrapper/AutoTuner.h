@@ -0,0 +1,76 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "TranslatorConfig.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // One measured runtime configuration.
+    struct TunedProfile
+    {
+        TranslatorConfig config;
+        size_t beamSize = 2;
+        size_t maxBatchSize = 1024;
+
+        // Single-sentence latency over the probe corpus, in milliseconds.
+        double p50 = 0;
+        double p99 = 0;
+        // Sentences per second of translateBatch over the probe corpus.
+        double throughput = 0;
+        // Share of the probe sentences translated as the widest beam swept translates
+        // them on the same layout and compute type (1 for the widest beam).
+        double agreement = 1;
+    };
+
+    struct AutoTuneOptions
+    {
+        // Candidate values; layouts and compute types are derived from the machine.
+        std::vector<size_t> beamSizes = { 1, 2 };
+        std::vector<size_t> maxBatchSizes = { 256, 1024 };
+        // Passes over the probe corpus per latency measurement.
+        size_t repetitions = 3;
+        // A narrower beam is only selectable when it agrees with the widest one on at
+        // least this share of the probe corpus, as calibrateAdaptiveDecoding requires.
+        double minAgreement = 0.95;
+    };
+
+    // Benchmarks runtime configurations of a model on this machine and persists the
+    // best one, so later translators on the same model start with it.
+    //
+    // The sweep covers replica x thread layouts derived from the core count, every
+    // compute type the CPU supports (mayiuse_int8/int16/bfloat16, plus float32), the
+    // beam sizes and the batch budgets. Each point is scored with single-sentence p50
+    // and p99 latency and batch throughput. The selected profile is on the Pareto front
+    // of those three and, of the front, has the lowest p50 among the profiles reaching
+    // at least 80% of the best throughput: the palette is interactive first.
+    //
+    // Latency never trades against quality: a beam narrower than the widest swept is
+    // only a candidate where its output matches the widest beam's on the probe corpus
+    // (minAgreement); otherwise the widest beam is kept.
+    //
+    // Loading a model per compute type and layout takes a while; run it off the UI.
+    class AutoTuner
+    {
+    public:
+        // "<modelDir>.autotune.json", next to the model directory.
+        static std::string profilePath(const std::string& modelDir);
+
+        // Identifies the hardware a profile was measured on.
+        static std::string machineSignature();
+
+        static std::vector<TunedProfile> sweep(const std::string& modelDir, const AutoTuneOptions& options = {});
+        static TunedProfile select(const std::vector<TunedProfile>& candidates, double minAgreement = 0.95);
+
+        // Sweeps, selects and saves. Returns the selected profile.
+        static TunedProfile tune(const std::string& modelDir, const AutoTuneOptions& options = {});
+
+        // Throws std::runtime_error if the file cannot be written.
+        static void save(const std::string& modelDir, const TunedProfile& selected, const std::vector<TunedProfile>& candidates);
+        // The saved profile, if there is one for this machine.
+        static std::optional<TunedProfile> load(const std::string& modelDir);
+    };
+
+}
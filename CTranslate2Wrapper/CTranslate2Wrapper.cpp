@@ -6,140 +6,1028 @@
 #include <string>
 #include <memory>
 
-// CTranslate2, sentencepiece and C++/CLI interop headers
-#include <ctranslate2/translator.h>
-#include <sentencepiece_processor.h>
+// Native translation core
+#include "CTranslate2WrapperImpl.h"
+#include "LanguageIdentifier.h"
+#include "Utf8Transcoder.h"
 
 // Add these includes for UTF-8/UTF-16 conversion
 #include <msclr/marshal.h>
 #include <msclr/marshal_cppstd.h>
-#include <codecvt>
+#include <vcclr.h>
 
+// The managed string is pinned and read in place, and the conversion goes through the
+// calling thread's scratch buffer, so the only allocation is the result itself.
 std::string toUtf8(System::String^ s) {
-	using namespace System::Runtime::InteropServices;
-	IntPtr ptr = Marshal::StringToHGlobalUni(s);
-	const wchar_t* wstr = static_cast<const wchar_t*>(ptr.ToPointer());
+	if (s == nullptr || s->Length == 0)
+	{
+		return std::string();
+	}
+	pin_ptr<const wchar_t> chars = PtrToStringChars(s);
+	const auto utf8 = CTranslate2Wrapper::Native::utf16ToUtf8Scratch(reinterpret_cast<const char16_t*>(chars), static_cast<size_t>(s->Length));
+	return std::string(utf8);
+}
 
-	int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, nullptr, 0, nullptr, nullptr);
-	std::string utf8(len - 1, 0);
-	WideCharToMultiByte(CP_UTF8, 0, wstr, -1, utf8.data(), len, nullptr, nullptr);
+System::String^ fromUtf8(const std::string& s) {
+	if (s.empty())
+	{
+		return System::String::Empty;
+	}
+	const auto utf16 = CTranslate2Wrapper::Native::utf8ToUtf16Scratch(s);
+	return gcnew System::String(reinterpret_cast<const wchar_t*>(utf16.data()), 0, static_cast<int>(utf16.size()));
+}
 
-	Marshal::FreeHGlobal(ptr);
-	return utf8;
+// Same conversions, with the time spent recorded as the Marshal/Unmarshal stages of a translator.
+std::string toUtf8(System::String^ s, CTranslate2Wrapper::Native::StageMetrics& metrics) {
+	CTranslate2Wrapper::Native::ScopedStageTimer timer(metrics, CTranslate2Wrapper::Native::Stage::Marshal);
+	return toUtf8(s);
 }
 
-System::String^ fromUtf8(const std::string& s) {
-	int len = MultiByteToWideChar(CP_UTF8, 0, s.c_str(), -1, nullptr, 0);
-	std::wstring wstr(len - 1, 0);
-	MultiByteToWideChar(CP_UTF8, 0, s.c_str(), -1, wstr.data(), len);
-	return gcnew System::String(wstr.c_str());
+System::String^ fromUtf8(const std::string& s, CTranslate2Wrapper::Native::StageMetrics& metrics) {
+	CTranslate2Wrapper::Native::ScopedStageTimer timer(metrics, CTranslate2Wrapper::Native::Stage::Unmarshal);
+	return fromUtf8(s);
 }
 
-// This is the Private Implementation (PImpl) idiom.
-// It hides the native C++ types from the header file, which improves compile times
-// and prevents issues with including native headers in C# projects.
-class CTranslate2WrapperImpl
+// Native state behind a CancellationHandle.
+struct CancellationHandleImpl
 {
-public:
-	std::unique_ptr<std::string> nativeModelPath;
-	// This holds the pointer to the actual CTranslate2 engine.
-	std::unique_ptr<ctranslate2::Translator> translator;
+	std::shared_ptr<CTranslate2Wrapper::Native::CancellationFlag> flag = std::make_shared<CTranslate2Wrapper::Native::CancellationFlag>();
 };
 
 // Use the namespace defined in your header file
 using namespace CTranslate2Wrapper;
 
+CancellationHandle::CancellationHandle()
+{
+	m_pImpl = new CancellationHandleImpl();
+}
+
+void CancellationHandle::Cancel()
+{
+	if (m_pImpl != nullptr)
+	{
+		m_pImpl->flag->cancel();
+	}
+}
+
+bool CancellationHandle::IsCancellationRequested::get()
+{
+	return m_pImpl != nullptr && m_pImpl->flag->isCanceled();
+}
+
+CancellationHandle::~CancellationHandle()
+{
+	this->!CancellationHandle();
+}
+
+CancellationHandle::!CancellationHandle()
+{
+	if (m_pImpl != nullptr)
+	{
+		// An in-flight translation keeps its own reference to the flag.
+		delete m_pImpl;
+		m_pImpl = nullptr;
+	}
+}
+
+LanguageIdentification LanguageIdentifier::Identify(String^ text)
+{
+	if (text == nullptr)
+	{
+		throw gcnew ArgumentNullException("text");
+	}
+
+	const auto nativeIdentification = CTranslate2Wrapper::Native::LanguageIdentifier::identify(toUtf8(text));
+	LanguageIdentification identification;
+	identification.Language = gcnew String(nativeIdentification.language);
+	identification.Confidence = nativeIdentification.confidence;
+	return identification;
+}
+
+float LanguageIdentifier::ConfidenceThreshold::get()
+{
+	return CTranslate2Wrapper::Native::LanguageIdentifier::confidenceThreshold;
+}
+
 // Constructor: Initializes the native translator engine.
 Translator::Translator(String^ modelPath)
+	: Translator(modelPath, false)
 {
-	m_pImpl = new CTranslate2WrapperImpl();
-	try
+}
+
+Translator::Translator(String^ modelPath, bool loadInBackground)
+	: Translator(modelPath, nullptr, loadInBackground)
+{
+}
+
+TranslatorConfig::TranslatorConfig()
+{
+	const CTranslate2Wrapper::Native::TranslatorConfig defaults;
+	Replicas = static_cast<int>(defaults.replicas);
+	ThreadsPerReplica = static_cast<int>(defaults.threadsPerReplica);
+	MaxQueuedBatches = static_cast<int>(defaults.maxQueuedBatches);
+	CpuCoreOffset = defaults.cpuCoreOffset;
+	UseTunedProfile = defaults.useTunedProfile;
+	UseVocabularyMap = defaults.useVocabularyMap;
+	Scheduling = static_cast<RequestScheduling>(defaults.scheduling);
+	// Empty: the tuned profile's compute type, or int8 without one.
+	ComputeType = String::Empty;
+}
+
+int TranslatorConfig::DetectedCores::get()
+{
+	return static_cast<int>(CTranslate2Wrapper::Native::TranslatorConfig::detectedCores());
+}
+
+static CTranslate2Wrapper::Native::TranslatorConfig toNativeConfig(TranslatorConfig^ config)
+{
+	CTranslate2Wrapper::Native::TranslatorConfig nativeConfig;
+	if (config == nullptr)
+	{
+		return nativeConfig;
+	}
+	if (config->Replicas < 0 || config->ThreadsPerReplica < 0)
+	{
+		throw gcnew ArgumentOutOfRangeException("config", "Replicas and ThreadsPerReplica must not be negative.");
+	}
+
+	nativeConfig.replicas = static_cast<size_t>(config->Replicas);
+	nativeConfig.threadsPerReplica = static_cast<size_t>(config->ThreadsPerReplica);
+	nativeConfig.maxQueuedBatches = config->MaxQueuedBatches;
+	nativeConfig.cpuCoreOffset = config->CpuCoreOffset;
+	nativeConfig.useTunedProfile = config->UseTunedProfile;
+	nativeConfig.useVocabularyMap = config->UseVocabularyMap;
+	nativeConfig.scheduling = static_cast<CTranslate2Wrapper::Native::SchedulingMode>(config->Scheduling);
+	if (!String::IsNullOrEmpty(config->ComputeType))
 	{
-		// Convert the managed .NET string to a native C++ std::string.
-		m_pImpl->nativeModelPath = std::make_unique<std::string>(toUtf8(modelPath));
+		try
+		{
+			nativeConfig.computeType = ctranslate2::str_to_compute_type(toUtf8(config->ComputeType));
+		}
+		catch (const std::exception& e)
+		{
+			throw gcnew ArgumentException(msclr::interop::marshal_as<String^>(e.what()), "config");
+		}
+	}
+	return nativeConfig;
+}
 
-		// Create the native CTranslate2 Translator object.
-		const std::vector<int> device_indices = { 0 };
-		m_pImpl->translator = std::make_unique<ctranslate2::Translator>(*(m_pImpl->nativeModelPath), ctranslate2::Device::CPU, ctranslate2::ComputeType::INT8, device_indices);
+String^ TranslatorConfig::ToString()
+{
+	return fromUtf8(toNativeConfig(this).toString());
+}
+
+Translator::Translator(String^ modelPath, TranslatorConfig^ config, bool loadInBackground)
+{
+	m_pImpl = nullptr;
+	const auto nativeConfig = toNativeConfig(config);
+	try
+	{
+		// Convert the managed .NET string to a native C++ std::string and
+		// load the CTranslate2 model together with its SentencePiece models.
+		m_pImpl = new CTranslate2WrapperImpl(toUtf8(modelPath), nativeConfig,
+			loadInBackground ? CTranslate2WrapperImpl::LoadMode::Background : CTranslate2WrapperImpl::LoadMode::Synchronous);
+	}
+	catch (const std::invalid_argument& e)
+	{
+		throw gcnew ArgumentException(msclr::interop::marshal_as<String^>(e.what()), "config");
 	}
 	catch (const std::exception& e)
 	{
 		// If the native code throws an exception (e.g., model not found),
-		// clean up and re-throw it as a managed exception that C# can catch.
-		delete m_pImpl;
-		m_pImpl = nullptr;
+		// re-throw it as a managed exception that C# can catch.
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+}
+
+TranslatorConfig^ Translator::GetConfig()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto& nativeConfig = m_pImpl->config;
+	TranslatorConfig^ config = gcnew TranslatorConfig();
+	config->Replicas = static_cast<int>(nativeConfig.replicas);
+	config->ThreadsPerReplica = static_cast<int>(nativeConfig.threadsPerReplica);
+	config->MaxQueuedBatches = static_cast<int>(nativeConfig.maxQueuedBatches);
+	config->CpuCoreOffset = nativeConfig.cpuCoreOffset;
+	config->UseTunedProfile = m_pImpl->tunedProfile.has_value();
+	config->UseVocabularyMap = nativeConfig.useVocabularyMap;
+	config->Scheduling = static_cast<RequestScheduling>(nativeConfig.scheduling);
+	config->ComputeType = gcnew String(ctranslate2::compute_type_to_str(*nativeConfig.computeType).c_str());
+	return config;
+}
+
+TunedProfile Translator::AutoTune(String^ modelPath)
+{
+	if (modelPath == nullptr)
+	{
+		throw gcnew ArgumentNullException("modelPath");
+	}
+
+	CTranslate2Wrapper::Native::TunedProfile nativeProfile;
+	try
+	{
+		nativeProfile = CTranslate2Wrapper::Native::AutoTuner::tune(toUtf8(modelPath));
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	TunedProfile profile;
+	profile.ComputeType = gcnew String(ctranslate2::compute_type_to_str(nativeProfile.config.computeType.value_or(ctranslate2::ComputeType::INT8)).c_str());
+	profile.Replicas = static_cast<int>(nativeProfile.config.replicas);
+	profile.ThreadsPerReplica = static_cast<int>(nativeProfile.config.threadsPerReplica);
+	profile.BeamSize = static_cast<int>(nativeProfile.beamSize);
+	profile.MaxBatchSize = static_cast<int>(nativeProfile.maxBatchSize);
+	profile.P50Milliseconds = nativeProfile.p50;
+	profile.P99Milliseconds = nativeProfile.p99;
+	profile.SentencesPerSecond = nativeProfile.throughput;
+	return profile;
+}
+
+bool Translator::IsReady::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->isReady();
+}
+
+bool Translator::WaitUntilReady(int millisecondsTimeout)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (millisecondsTimeout < -1)
+	{
+		throw gcnew ArgumentOutOfRangeException("millisecondsTimeout");
+	}
+
+	// Wait only; a load failure is reported by the translate calls.
+	if (millisecondsTimeout == -1)
+	{
+		m_pImpl->waitUntilReady();
+		return true;
+	}
+	return m_pImpl->waitUntilReady(std::chrono::milliseconds(millisecondsTimeout));
+}
+
+ModelLoadTimings Translator::GetLoadTimings()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	ModelLoadTimings timings;
+	try
+	{
+		m_pImpl->ensureReady();
+	}
+	catch (const std::exception& e)
+	{
 		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
 	}
+
+	const auto& nativeTimings = m_pImpl->loadTimings();
+	timings.ModelMilliseconds = nativeTimings.model;
+	timings.TokenizerMilliseconds = nativeTimings.tokenizer;
+	timings.TotalMilliseconds = nativeTimings.total;
+	return timings;
 }
 
 // Translate Method: This is the core function your C# app will call.
 String^ Translator::Translate(String^ text)
+{
+	return Translate(text, nullptr);
+}
+
+static std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> toNativeCancellation(CancellationHandle^ cancellation)
+{
+	if (cancellation == nullptr)
+	{
+		return nullptr;
+	}
+	if (cancellation->m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("CancellationHandle instance has been disposed.");
+	}
+	return cancellation->m_pImpl->flag;
+}
+
+String^ Translator::Translate(String^ text, CancellationHandle^ cancellation)
 {
 	if (m_pImpl == nullptr)
 	{
 		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
 	}
 
-	// Load the SentencePiece spm file.
-	sentencepiece::SentencePieceProcessor tokenizer;
-	std::string sp_model_path = *(m_pImpl->nativeModelPath) + "/source.spm";
-	std::string debugMsg = "Trying to load SentencePiece model from: " + sp_model_path + "\n";
-	OutputDebugStringA(debugMsg.c_str());
-	const auto sp_status = tokenizer.Load(sp_model_path);
-	if (!sp_status.ok())
+	const auto nativeCancellation = toNativeCancellation(cancellation);
+
+	// 1. Marshal (convert) the input .NET string to a native C++ string.
+	std::string nativeText = toUtf8(text, m_pImpl->metrics);
+
+	// 2. Tokenize, translate and detokenize in the native core.
+	std::string translatedText;
+	try
+	{
+		translatedText = m_pImpl->translate(nativeText, nativeCancellation);
+	}
+	catch (const CTranslate2Wrapper::Native::TranslationCanceled&)
+	{
+		throw gcnew OperationCanceledException();
+	}
+	catch (const std::exception& e)
 	{
-		throw std::runtime_error("Failed to load SentencePiece model: " + sp_status.ToString());
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
 	}
 
-	// 1. Marshal (convert) the input .NET string to a native C++ string.
-	std::string nativeText = toUtf8(text);
+	// 3. Marshal the native C++ string result back to a .NET string and return it.
+	return fromUtf8(translatedText, m_pImpl->metrics);
+}
 
-	// 2. Tokenize the input string. Use sentencepiece
-	std::vector<std::string> tokens;
-	tokenizer.Encode(nativeText, &tokens);
-	// Add BOS and EOS tokens
-	//tokens.insert(tokens.begin(), "<s>");
-	// opusmt does not need BOS tokens
-	tokens.push_back("</s>");
+String^ Translator::TranslatePivot(Translator^ next, String^ text, CancellationHandle^ cancellation)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (next == nullptr)
+	{
+		throw gcnew ArgumentNullException("next");
+	}
+	if (next->m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
 
-	// 3. The translate_batch method expects a vector of sentences.
-	//    We wrap our single sentence's tokens in another vector to create a batch of one.
-	std::vector<std::vector<std::string>> batch_tokens = { tokens };
+	const auto nativeCancellation = toNativeCancellation(cancellation);
+	std::string nativeText = toUtf8(text, m_pImpl->metrics);
 
-	// Translation options
-	ctranslate2::TranslationOptions options;
-	options.beam_size = 2;
-	options.num_hypotheses = 1;
-	options.max_decoding_length = 256;
-	options.return_scores = false;
-	// additional options
-	options.repetition_penalty = 1.1;
+	// Both stages run natively; the intermediate text never becomes a .NET string.
+	std::string translatedText;
+	try
+	{
+		translatedText = m_pImpl->translatePivot(*next->m_pImpl, nativeText, nativeCancellation);
+	}
+	catch (const CTranslate2Wrapper::Native::TranslationCanceled&)
+	{
+		throw gcnew OperationCanceledException();
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
 
-	// 4. Call the CTranslate2 engine.
-	const std::vector<ctranslate2::TranslationResult> results = m_pImpl->translator->translate_batch(batch_tokens, options);
+	return fromUtf8(translatedText, m_pImpl->metrics);
+}
 
-	if (results.empty() || results[0].hypotheses.empty())
+String^ Translator::TranslateStreaming(String^ text, PartialTranslationCallback^ onPartial, CancellationHandle^ cancellation)
+{
+	if (m_pImpl == nullptr)
 	{
-		return String::Empty;
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
 	}
 
-	// Remove BOS/EOS tokens
-	auto hypothesis = results[0].hypotheses[0];
-	if (!hypothesis.empty() && hypothesis.front() == "<s>")
-		hypothesis.erase(hypothesis.begin());
-	if (!hypothesis.empty() && hypothesis.back() == "</s>")
-		hypothesis.pop_back();
+	const auto nativeCancellation = toNativeCancellation(cancellation);
+	std::string nativeText = toUtf8(text, m_pImpl->metrics);
+
+	// The native callback holds a GC handle to the delegate for the duration of the call.
+	CTranslate2Wrapper::Native::PartialTranslationCallback nativeOnPartial;
+	if (onPartial != nullptr)
+	{
+		gcroot<PartialTranslationCallback^> callback = onPartial;
+		nativeOnPartial = [callback](const std::string& partialText)
+		{
+			try
+			{
+				callback->Invoke(fromUtf8(partialText));
+			}
+			catch (Exception^)
+			{
+				// A failing UI update must not abort the decoding on the replica.
+			}
+		};
+	}
 
 	std::string translatedText;
-	auto status = tokenizer.Decode(hypothesis, &translatedText);
-	if (!status.ok())
+	try
+	{
+		translatedText = m_pImpl->translateStreaming(nativeText, std::move(nativeOnPartial), nativeCancellation);
+	}
+	catch (const CTranslate2Wrapper::Native::TranslationCanceled&)
+	{
+		throw gcnew OperationCanceledException();
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	return fromUtf8(translatedText, m_pImpl->metrics);
+}
+
+array<String^>^ Translator::TranslateBatch(array<String^>^ texts)
+{
+	if (m_pImpl == nullptr)
 	{
-		throw gcnew Exception(msclr::interop::marshal_as<String^>(
-			"Failed to decode SentencePiece tokens: " + status.ToString()));
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	// defaultMaxBatchSize, unless an auto-tune profile picked another budget.
+	return TranslateBatch(texts, static_cast<int>(m_pImpl->maxBatchSize));
+}
+
+// TranslateBatch Method: one native call for a whole list of sentences.
+array<String^>^ Translator::TranslateBatch(array<String^>^ texts, int maxBatchSize)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (texts == nullptr)
+	{
+		throw gcnew ArgumentNullException("texts");
+	}
+	if (maxBatchSize <= 0)
+	{
+		throw gcnew ArgumentOutOfRangeException("maxBatchSize", "The batch size must be positive.");
+	}
+
+	// 1. Marshal all inputs before entering the native engine.
+	std::vector<std::string> nativeTexts;
+	nativeTexts.reserve(texts->Length);
+	for each (String^ text in texts)
+	{
+		nativeTexts.push_back(text == nullptr ? std::string() : toUtf8(text, m_pImpl->metrics));
+	}
+
+	// 2. Tokenize, translate and detokenize the whole batch in the native core.
+	std::vector<std::string> translatedTexts;
+	try
+	{
+		translatedTexts = m_pImpl->translateBatch(nativeTexts, static_cast<size_t>(maxBatchSize));
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	// 3. Marshal the results back, in input order.
+	array<String^>^ results = gcnew array<String^>(static_cast<int>(translatedTexts.size()));
+	for (int i = 0; i < results->Length; ++i)
+	{
+		results[i] = fromUtf8(translatedTexts[i], m_pImpl->metrics);
+	}
+	return results;
+}
+
+TranslationCacheStatistics Translator::GetCacheStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto nativeStatistics = m_pImpl->cache.statistics();
+	TranslationCacheStatistics statistics;
+	statistics.Hits = static_cast<Int64>(nativeStatistics.hits);
+	statistics.Misses = static_cast<Int64>(nativeStatistics.misses);
+	statistics.Evictions = static_cast<Int64>(nativeStatistics.evictions);
+	statistics.Entries = static_cast<Int64>(nativeStatistics.entries);
+	statistics.Bytes = static_cast<Int64>(nativeStatistics.bytes);
+	return statistics;
+}
+
+void Translator::ClearCache()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	m_pImpl->cache.clear();
+}
+
+bool Translator::SpeculativeDrafts::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->speculativeDrafts;
+}
+
+void Translator::SpeculativeDrafts::set(bool value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	m_pImpl->speculativeDrafts = value;
+}
+
+SpeculativeDraftStatistics Translator::GetSpeculativeDraftStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto nativeStatistics = m_pImpl->drafts.statistics();
+	SpeculativeDraftStatistics statistics;
+	statistics.Requests = static_cast<Int64>(nativeStatistics.requests);
+	statistics.DraftedRequests = static_cast<Int64>(nativeStatistics.draftedRequests);
+	statistics.DraftTokens = static_cast<Int64>(nativeStatistics.draftTokens);
+	statistics.AcceptedTokens = static_cast<Int64>(nativeStatistics.acceptedTokens);
+	statistics.DecodedTokens = static_cast<Int64>(nativeStatistics.decodedTokens);
+	return statistics;
+}
+
+bool Translator::AdaptiveDecoding::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->adaptiveDecoding;
+}
+
+void Translator::AdaptiveDecoding::set(bool value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	m_pImpl->adaptiveDecoding = value;
+}
+
+AdaptiveDecodingStatistics Translator::GetAdaptiveDecodingStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto nativeStatistics = m_pImpl->escalation.statistics();
+	AdaptiveDecodingStatistics statistics;
+	statistics.Requests = static_cast<Int64>(nativeStatistics.requests);
+	statistics.Escalations = static_cast<Int64>(nativeStatistics.escalations);
+	return statistics;
+}
+
+void Translator::CalibrateAdaptiveDecoding(array<String^>^ sentences)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (sentences == nullptr)
+	{
+		throw gcnew ArgumentNullException("sentences");
+	}
+
+	std::vector<std::string> nativeSentences;
+	nativeSentences.reserve(sentences->Length);
+	for each (String^ sentence in sentences)
+	{
+		nativeSentences.push_back(toUtf8(sentence));
+	}
+
+	try
+	{
+		m_pImpl->calibrateAdaptiveDecoding(nativeSentences);
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+}
+
+bool Translator::ContinuousBatching::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->continuousBatching;
+}
+
+void Translator::ContinuousBatching::set(bool value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	m_pImpl->continuousBatching = value;
+}
+
+ContinuousBatchingStatistics Translator::GetContinuousBatchingStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	try
+	{
+		m_pImpl->ensureReady();
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	const auto nativeStatistics = m_pImpl->batcher->statistics();
+	ContinuousBatchingStatistics statistics;
+	statistics.Requests = static_cast<Int64>(nativeStatistics.requests);
+	statistics.DecoderSteps = static_cast<Int64>(nativeStatistics.steps);
+	statistics.BatchedRows = static_cast<Int64>(nativeStatistics.rows);
+	return statistics;
+}
+
+namespace {
+	StageStatistics toManagedStatistics(const char* name, const CTranslate2Wrapper::Native::LatencyHistogram::Snapshot& snapshot)
+	{
+		StageStatistics statistics;
+		statistics.Stage = gcnew String(name);
+		statistics.Count = static_cast<Int64>(snapshot.count);
+		statistics.Mean = snapshot.mean();
+		statistics.P50 = static_cast<Int64>(snapshot.percentile(0.50));
+		statistics.P90 = static_cast<Int64>(snapshot.percentile(0.90));
+		statistics.P99 = static_cast<Int64>(snapshot.percentile(0.99));
+		statistics.Max = static_cast<Int64>(snapshot.max);
+		return statistics;
+	}
+}
+
+int Translator::SelfSpeculativeLayers::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return static_cast<int>(m_pImpl->selfSpeculativeLayers);
+}
+
+void Translator::SelfSpeculativeLayers::set(int value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (value < 0)
+	{
+		throw gcnew ArgumentOutOfRangeException("value", "The number of layers must not be negative.");
+	}
+
+	m_pImpl->selfSpeculativeLayers = static_cast<size_t>(value);
+}
+
+int Translator::SelfSpeculativeDraftTokens::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return static_cast<int>(m_pImpl->selfSpeculativeDraftTokens);
+}
+
+void Translator::SelfSpeculativeDraftTokens::set(int value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (value < 1)
+	{
+		throw gcnew ArgumentOutOfRangeException("value", "A draft has at least one token.");
+	}
+
+	m_pImpl->selfSpeculativeDraftTokens = static_cast<size_t>(value);
+}
+
+SelfSpeculativeStatistics Translator::GetSelfSpeculativeStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto nativeStatistics = m_pImpl->selfSpeculation.statistics();
+	SelfSpeculativeStatistics statistics;
+	statistics.Requests = static_cast<Int64>(nativeStatistics.requests);
+	statistics.VerificationPasses = static_cast<Int64>(nativeStatistics.rounds);
+	statistics.DraftTokens = static_cast<Int64>(nativeStatistics.draftTokens);
+	statistics.AcceptedTokens = static_cast<Int64>(nativeStatistics.acceptedTokens);
+	statistics.Tokens = static_cast<Int64>(nativeStatistics.tokens);
+	return statistics;
+}
+
+// The translator's open translation memory; throws if there is none.
+static std::shared_ptr<CTranslate2Wrapper::Native::TranslationMemory> requireMemory(const CTranslate2WrapperImpl& impl)
+{
+	auto memory = impl.memory();
+	if (!memory)
+	{
+		throw gcnew InvalidOperationException("No translation memory is open.");
+	}
+	return memory;
+}
+
+static void checkScore(double value)
+{
+	if (!(value >= 0 && value <= 1))
+	{
+		throw gcnew ArgumentOutOfRangeException("value", "A score is between 0 and 1.");
+	}
+}
+
+void Translator::OpenTranslationMemory(String^ path)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (String::IsNullOrEmpty(path))
+	{
+		throw gcnew ArgumentException("A translation memory path is required.", "path");
+	}
+
+	try
+	{
+		m_pImpl->openTranslationMemory(toUtf8(path));
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+}
+
+void Translator::CloseTranslationMemory()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	m_pImpl->closeTranslationMemory();
+}
+
+void Translator::AddTranslationMemoryEntry(String^ source, String^ target)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto memory = requireMemory(*m_pImpl);
+	try
+	{
+		memory->add(toUtf8(source), toUtf8(target));
+	}
+	catch (const std::invalid_argument& e)
+	{
+		throw gcnew ArgumentException(msclr::interop::marshal_as<String^>(e.what()), "source");
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+}
+
+void Translator::SaveTranslationMemory()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	const auto memory = requireMemory(*m_pImpl);
+	try
+	{
+		memory->save();
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+}
+
+Nullable<TranslationMemoryMatch> Translator::LookupTranslationMemory(String^ text, double minScore)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (!(minScore >= 0 && minScore <= 1))
+	{
+		throw gcnew ArgumentOutOfRangeException("minScore", "A score is between 0 and 1.");
+	}
+
+	const auto memory = requireMemory(*m_pImpl);
+	std::optional<CTranslate2Wrapper::Native::TranslationMemoryMatch> nativeMatch;
+	try
+	{
+		nativeMatch = memory->find(toUtf8(text), static_cast<float>(minScore));
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	if (!nativeMatch)
+	{
+		return Nullable<TranslationMemoryMatch>();
+	}
+	TranslationMemoryMatch match;
+	match.Source = fromUtf8(nativeMatch->source);
+	match.Target = fromUtf8(nativeMatch->target);
+	match.Score = nativeMatch->score;
+	return Nullable<TranslationMemoryMatch>(match);
+}
+
+double Translator::TranslationMemoryAcceptScore::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->memoryAcceptScore;
+}
+
+void Translator::TranslationMemoryAcceptScore::set(double value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	checkScore(value);
+
+	m_pImpl->memoryAcceptScore = static_cast<float>(value);
+}
+
+double Translator::TranslationMemoryHintScore::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return m_pImpl->memoryHintScore;
+}
+
+void Translator::TranslationMemoryHintScore::set(double value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	checkScore(value);
+
+	m_pImpl->memoryHintScore = static_cast<float>(value);
+}
+
+TranslationMemoryStatistics Translator::GetTranslationMemoryStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	TranslationMemoryStatistics statistics;
+	const auto memory = m_pImpl->memory();
+	if (!memory)
+	{
+		return statistics;
+	}
+	const auto nativeStatistics = memory->statistics();
+	statistics.Entries = static_cast<Int64>(nativeStatistics.entries);
+	statistics.Lookups = static_cast<Int64>(nativeStatistics.lookups);
+	statistics.ExactHits = static_cast<Int64>(nativeStatistics.exactHits);
+	statistics.NearHits = static_cast<Int64>(nativeStatistics.nearHits);
+	return statistics;
+}
+
+int Translator::InteractiveDeadlineMilliseconds::get()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return static_cast<int>(m_pImpl->interactiveDeadline.load().count());
+}
+
+void Translator::InteractiveDeadlineMilliseconds::set(int value)
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+	if (value < 0)
+	{
+		throw gcnew ArgumentOutOfRangeException("value", "The deadline must not be negative.");
+	}
+
+	m_pImpl->interactiveDeadline = std::chrono::milliseconds(value);
+}
+
+array<RequestQueueStatistics>^ Translator::GetRequestQueueStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	try
+	{
+		m_pImpl->ensureReady();
+	}
+	catch (const std::exception& e)
+	{
+		throw gcnew Exception(msclr::interop::marshal_as<String^>(e.what()));
+	}
+
+	using CTranslate2Wrapper::Native::RequestClass;
+	array<RequestQueueStatistics>^ statistics = gcnew array<RequestQueueStatistics>(static_cast<int>(RequestClass::Count));
+	for (int i = 0; i < statistics->Length; ++i)
+	{
+		const RequestClass requestClass = static_cast<RequestClass>(i);
+		const auto nativeStatistics = m_pImpl->scheduler->statistics(requestClass);
+		statistics[i].RequestClass = gcnew String(CTranslate2Wrapper::Native::requestClassName(requestClass));
+		statistics[i].Submitted = static_cast<Int64>(nativeStatistics.submitted);
+		statistics[i].Expired = static_cast<Int64>(nativeStatistics.expired);
+		statistics[i].MeanWait = nativeStatistics.wait.mean();
+		statistics[i].P50Wait = static_cast<Int64>(nativeStatistics.wait.percentile(0.50));
+		statistics[i].P99Wait = static_cast<Int64>(nativeStatistics.wait.percentile(0.99));
+		statistics[i].MaxWait = static_cast<Int64>(nativeStatistics.wait.max);
+	}
+	return statistics;
+}
+
+array<StageStatistics>^ Translator::GetStageStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	using CTranslate2Wrapper::Native::Stage;
+	using CTranslate2Wrapper::Native::StageMetrics;
+	array<StageStatistics>^ statistics = gcnew array<StageStatistics>(static_cast<int>(StageMetrics::stageCount));
+	for (int i = 0; i < statistics->Length; ++i)
+	{
+		const Stage stage = static_cast<Stage>(i);
+		statistics[i] = toManagedStatistics(CTranslate2Wrapper::Native::stageName(stage), m_pImpl->metrics.snapshot(stage));
+	}
+	return statistics;
+}
+
+StageStatistics Translator::GetDecodeStepStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return toManagedStatistics("decode_steps", m_pImpl->metrics.decodeSteps());
+}
+
+String^ Translator::DumpStageStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
+	}
+
+	return fromUtf8(m_pImpl->metrics.dump());
+}
+
+void Translator::ResetStageStatistics()
+{
+	if (m_pImpl == nullptr)
+	{
+		throw gcnew ObjectDisposedException("Translator instance has been disposed.");
 	}
 
-	// 6. Marshal the native C++ string result back to a .NET string and return it.
-	return fromUtf8(translatedText);
+	m_pImpl->metrics.reset();
 }
 
 // This is the IDisposable pattern for C++/CLI.
@@ -1,6 +1,7 @@
 #pragma once
 
 class CTranslate2WrapperImpl; // Forward declaration
+struct CancellationHandleImpl; // Forward declaration
 using namespace System;
 using namespace System::Threading;
 
@@ -8,15 +9,332 @@ namespace CTranslate2Wrapper {
     // Delegate for the translation callback function
     public delegate bool TranslationCallback(int step);
 
+    // Delegate receiving the translation decoded so far while streaming
+    public delegate void PartialTranslationCallback(String^ partialText);
+
+    // Counters of the native translation result cache
+    public value struct TranslationCacheStatistics
+    {
+        Int64 Hits;
+        Int64 Misses;
+        Int64 Evictions;
+        Int64 Entries;
+        Int64 Bytes;
+    };
+
+    // Counters of speculative (draft-and-verify) decoding
+    public value struct SpeculativeDraftStatistics
+    {
+        Int64 Requests;
+        Int64 DraftedRequests;
+        Int64 DraftTokens;
+        Int64 AcceptedTokens;
+        Int64 DecodedTokens;
+    };
+
+    // Counters of adaptive (greedy first, beam search when unsure) decoding
+    public value struct AdaptiveDecodingStatistics
+    {
+        Int64 Requests;
+        Int64 Escalations;
+    };
+
+    // Counters of continuous batching. BatchedRows / DecoderSteps is the average number
+    // of translations advanced by one decoder call.
+    public value struct ContinuousBatchingStatistics
+    {
+        Int64 Requests;
+        Int64 DecoderSteps;
+        Int64 BatchedRows;
+    };
+
+    // Counters of self-speculative decoding. AcceptedTokens / DraftTokens is the draft's
+    // acceptance rate, Tokens / VerificationPasses the tokens settled per full decoder pass.
+    public value struct SelfSpeculativeStatistics
+    {
+        Int64 Requests;
+        Int64 VerificationPasses;
+        Int64 DraftTokens;
+        Int64 AcceptedTokens;
+        Int64 Tokens;
+    };
+
+    // A translation memory entry found for a text. Score is 1 for an exact match, else
+    // 1 - edit distance / length of the longer source.
+    public value struct TranslationMemoryMatch
+    {
+        String^ Source;
+        String^ Target;
+        double Score;
+    };
+
+    // Counters of the translation memory
+    public value struct TranslationMemoryStatistics
+    {
+        Int64 Entries;
+        Int64 Lookups;
+        Int64 ExactHits;
+        Int64 NearHits;
+    };
+
+    // Requests of one class (interactive, bulk, background) and their wait for a replica,
+    // in microseconds. Percentiles are accurate to about 6%.
+    public value struct RequestQueueStatistics
+    {
+        String^ RequestClass;
+        Int64 Submitted;
+        Int64 Expired;
+        double MeanWait;
+        Int64 P50Wait;
+        Int64 P99Wait;
+        Int64 MaxWait;
+    };
+
+    // Distribution of one translation stage, in microseconds (decode steps for
+    // GetDecodeStepStatistics). Percentiles are accurate to about 6%.
+    public value struct StageStatistics
+    {
+        String^ Stage;
+        Int64 Count;
+        double Mean;
+        Int64 P50;
+        Int64 P90;
+        Int64 P99;
+        Int64 Max;
+    };
+
+    // Time spent loading a model, in milliseconds. The CTranslate2 weights and the
+    // SentencePiece models load concurrently.
+    public value struct ModelLoadTimings
+    {
+        double ModelMilliseconds;
+        double TokenizerMilliseconds;
+        double TotalMilliseconds;
+    };
+
+    // Order in which a Translator's queued requests reach its replicas. Priority runs
+    // Translate before TranslateBatch before calibration; WorkStealing keeps that order
+    // with per-replica lock-free queues, for many small requests on many replicas; Fifo
+    // runs them in submission order. The values match SchedulingMode.
+    public enum class RequestScheduling
+    {
+        Fifo,
+        Priority,
+        WorkStealing,
+    };
+
+    // Replica and thread layout of a Translator. Zero (the default) for Replicas or
+    // ThreadsPerReplica derives the value from the detected core count. Few replicas with
+    // many threads favor single-query latency; more replicas favor concurrent throughput.
+    public ref class TranslatorConfig
+    {
+    public:
+        TranslatorConfig();
+
+        property int Replicas;
+        property int ThreadsPerReplica;
+        // Batches queued per translator before callers block; 0 = automatic, -1 = unbounded.
+        // Interactive queries are exempt unless Scheduling is Fifo.
+        property int MaxQueuedBatches;
+        // First core to pin replica threads to; -1 = no pinning
+        property int CpuCoreOffset;
+        // CTranslate2 compute type name: "int8", "int8_float32", "int16", "float32", "auto", ...
+        // Empty (the default) takes the tuned profile's, or int8 without one.
+        property String^ ComputeType;
+        // Use the profile saved by Translator::AutoTune for this model and machine, when
+        // there is one (default: true). Values set above win over the profile's: its layout
+        // only applies when Replicas and ThreadsPerReplica are both 0, its compute type
+        // when ComputeType is empty.
+        property bool UseTunedProfile;
+        // Decode with the model's vmap.txt (built by ct2palette-vmap) so the output layer
+        // only scores likely target pieces. No effect without a map (default: false).
+        property bool UseVocabularyMap;
+        // How queued translations reach the replicas (default: Priority).
+        property RequestScheduling Scheduling;
+
+        static property int DetectedCores { int get(); }
+
+        virtual String^ ToString() override;
+    };
+
+    // Runtime configuration selected by Translator::AutoTune, with its measurements
+    public value struct TunedProfile
+    {
+        String^ ComputeType;
+        int Replicas;
+        int ThreadsPerReplica;
+        int BeamSize;
+        int MaxBatchSize;
+        double P50Milliseconds;
+        double P99Milliseconds;
+        double SentencesPerSecond;
+    };
+
+    // Language of a piece of text: ISO 639-1 code ("und" without letters) and 0..1 confidence
+    public value struct LanguageIdentification
+    {
+        String^ Language;
+        float Confidence;
+    };
+
+    // Native script and language identification. Takes a few microseconds for
+    // palette-sized input, so it can run on every keystroke before any model.
+    public ref class LanguageIdentifier abstract sealed
+    {
+    public:
+        static LanguageIdentification Identify(String^ text);
+
+        // Below this confidence an identification is a guess (short or ambiguous
+        // input); routing should keep its default.
+        static property float ConfidenceThreshold { float get(); }
+    };
+
+    // Cancels an in-flight native translation. The flag is checked at every
+    // decoding step, so the model replica is released within one step.
+    // Typical use: token.Register(handle.Cancel) around a Translate call.
+    public ref class CancellationHandle : IDisposable
+    {
+    public:
+        CancellationHandle();
+        ~CancellationHandle(); // Destructor
+        !CancellationHandle(); // Finalizer
+
+        void Cancel();
+
+        property bool IsCancellationRequested { bool get(); }
+
+    internal:
+        CancellationHandleImpl* m_pImpl;
+    };
+
     public ref class Translator : IDisposable
     {
     public:
         Translator(String^ modelPath);
+        // With loadInBackground the constructor returns immediately and the model loads on
+        // a native thread. Translate calls wait for it and rethrow a load failure.
+        Translator(String^ modelPath, bool loadInBackground);
+        // Same, with an explicit replica/thread layout. An invalid configuration throws
+        // ArgumentException from the constructor.
+        Translator(String^ modelPath, TranslatorConfig^ config, bool loadInBackground);
         ~Translator(); // Destructor
         !Translator(); // Finalizer
 
+        // The configuration in use, automatic values resolved. UseTunedProfile tells
+        // whether a saved auto-tune profile was applied.
+        TranslatorConfig^ GetConfig();
+
+        // Benchmarks replica layouts, compute types, beam sizes and batch budgets for the
+        // model on this machine, saves the selected profile as "<modelPath>.autotune.json"
+        // and returns it. Translators created afterwards pick it up. Takes minutes.
+        static TunedProfile AutoTune(String^ modelPath);
+
+        // True once loading has finished (successfully or not).
+        property bool IsReady { bool get(); }
+        // Waits up to millisecondsTimeout (-1: forever) for the model; returns IsReady.
+        bool WaitUntilReady(int millisecondsTimeout);
+        // Load timings, once IsReady is true. Throws the load failure if there was one.
+        ModelLoadTimings GetLoadTimings();
+
+        // Text of several sentences or lines is split natively and translated as one
+        // batch over the replicas; the result keeps the original whitespace between them.
         String^ Translate(String^ text);
 
+        // Same as Translate, but stops decoding as soon as the handle is canceled
+        // and throws OperationCanceledException.
+        String^ Translate(String^ text, CancellationHandle^ cancellation);
+
+        // Pivot translation: translates with this translator (e.g. mul->en) and feeds the
+        // result to next (e.g. en->zh) inside the native core. Sentences are pipelined, so
+        // next works on one sentence while this translator decodes the following one.
+        String^ TranslatePivot(Translator^ next, String^ text, CancellationHandle^ cancellation);
+
+        // Streaming translation: onPartial receives the growing translation while the
+        // decoder runs (on a native worker thread), the return value is the final text.
+        // With beam search only the prefix all live beams agree on is reported. The
+        // sentences of longer text are decoded in parallel and reported in order, each
+        // one as it grows once the sentences before it are done.
+        String^ TranslateStreaming(String^ text, PartialTranslationCallback^ onPartial, CancellationHandle^ cancellation);
+
+        // Translates all texts in one batched pass through the native engine.
+        // maxBatchSize is the maximum number of tokens per batch sent to a
+        // model replica. Results are returned in input order.
+        array<String^>^ TranslateBatch(array<String^>^ texts);
+        array<String^>^ TranslateBatch(array<String^>^ texts, int maxBatchSize);
+
+        // Repeated queries are answered from a native LRU cache without running the model.
+        TranslationCacheStatistics GetCacheStatistics();
+        void ClearCache();
+
+        // Reuses the previous translation as a draft while the user keeps typing: the
+        // draft is checked in one decoder pass and only the tokens after the first
+        // mismatch are decoded step by step. Only greedy decoding (a tuned beam size of
+        // 1) uses drafts; the default beam search ignores them, and so does
+        // AdaptiveDecoding, which has to score every token of its greedy pass. Off by default.
+        property bool SpeculativeDrafts { bool get(); void set(bool value); }
+        SpeculativeDraftStatistics GetSpeculativeDraftStatistics();
+
+        // Decodes greedily first and runs beam search only when the greedy translation has
+        // a low-probability token or a low average token log-probability. Streaming and
+        // batches keep beam search. Off by default. Calibration decodes the sentences both
+        // ways and picks the thresholds that escalate the fewest while 95% of the greedy
+        // translations kept match beam search.
+        property bool AdaptiveDecoding { bool get(); void set(bool value); }
+        AdaptiveDecodingStatistics GetAdaptiveDecodingStatistics();
+        void CalibrateAdaptiveDecoding(array<String^>^ sentences);
+
+        // Decodes concurrent Translate calls greedily in one shared loop per replica: a
+        // new query starts a loop on an idle replica, or once every replica runs one,
+        // joins a running loop at the next decoding step instead of waiting for its batch
+        // to finish; a finished one returns at once. Replaces beam search for these
+        // calls; drafts and adaptive decoding do not apply. Queries that join a busy loop
+        // one by one are each stepped on their own, so with more staggered queries than
+        // replicas this is slower than the default path. Off by default.
+        property bool ContinuousBatching { bool get(); void set(bool value); }
+        ContinuousBatchingStatistics GetContinuousBatchingStatistics();
+
+        // Lets the first SelfSpeculativeLayers decoder layers draft SelfSpeculativeDraftTokens
+        // tokens at a time for greedy Translate calls; the full decoder checks each draft
+        // in one pass and keeps its own choice where they differ. Its logits come from
+        // multi-token passes, so a near-tie can rarely pick another token than plain greedy
+        // decoding. No extra model is needed. 0 (the default) turns it off; it does not
+        // apply with beam search or ContinuousBatching.
+        property int SelfSpeculativeLayers { int get(); void set(int value); }
+        property int SelfSpeculativeDraftTokens { int get(); void set(int value); }
+        SelfSpeculativeStatistics GetSelfSpeculativeStatistics();
+
+        // Source/target pairs served before the model, kept in a memory-mapped file (created
+        // on the first save). Translate and TranslateBatch return a match scoring at least
+        // TranslationMemoryAcceptScore (default 1: exact matches only, ignoring spacing)
+        // without running the model. Translate also gives the model the target of a match
+        // scoring at least TranslationMemoryHintScore (default 0.7) as a draft: the part
+        // the model agrees with is checked in one pass instead of decoded token by token.
+        // Like SpeculativeDrafts, hints only serve greedy decoding; beam search ignores them.
+        // LookupTranslationMemory returns a match at once, e.g. to show while translating.
+        void OpenTranslationMemory(String^ path);
+        void CloseTranslationMemory();
+        void AddTranslationMemoryEntry(String^ source, String^ target);
+        void SaveTranslationMemory();
+        Nullable<TranslationMemoryMatch> LookupTranslationMemory(String^ text, double minScore);
+        property double TranslationMemoryAcceptScore { double get(); void set(double value); }
+        property double TranslationMemoryHintScore { double get(); void set(double value); }
+        TranslationMemoryStatistics GetTranslationMemoryStatistics();
+
+        // Queued translations wait for a replica by class: Translate before TranslateBatch
+        // before calibration (see TranslatorConfig::Scheduling). A Translate call
+        // still queued after InteractiveDeadlineMilliseconds is canceled instead of run,
+        // with OperationCanceledException; 0 (the default) waits forever.
+        property int InteractiveDeadlineMilliseconds { int get(); void set(int value); }
+        array<RequestQueueStatistics>^ GetRequestQueueStatistics();
+
+        // Always-on latency breakdown of every translation: marshaling, SentencePiece,
+        // replica queueing, encoder, decoding loop and detokenization, plus the number of
+        // decoding steps per request. The dump is a text table of the stages seen so far.
+        array<StageStatistics>^ GetStageStatistics();
+        StageStatistics GetDecodeStepStatistics();
+        String^ DumpStageStatistics();
+        void ResetStageStatistics();
+
     private:
         CTranslate2WrapperImpl* m_pImpl;
     };
@@ -0,0 +1,1021 @@
+#include "CTranslate2WrapperImpl.h"
+
+#include "MmapModelReader.h"
+#include "ReplicaRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <optional>
+
+using namespace CTranslate2Wrapper::Native;
+
+namespace {
+	ctranslate2::TranslationOptions makeTranslationOptions()
+	{
+		ctranslate2::TranslationOptions options;
+		options.beam_size = 2;
+		options.num_hypotheses = 1;
+		options.max_decoding_length = 256;
+		options.return_scores = false;
+		// additional options
+		options.repetition_penalty = 1.1f;
+		return options;
+	}
+
+	// Token budget for one batch call: at most maxBatchSize, but small enough to hand
+	// every replica a share of the examples. A long paragraph then takes about as long
+	// as its longest sentence instead of all of them in a row on one replica.
+	size_t spreadBatchBudget(const std::vector<size_t>& lengths, size_t maxBatchSize, size_t replicas)
+	{
+		size_t total = 0;
+		size_t longest = 0;
+		for (const size_t length : lengths)
+		{
+			total += length;
+			longest = std::max(longest, length);
+		}
+		const size_t share = (total + replicas - 1) / std::max<size_t>(replicas, 1);
+		return std::min(maxBatchSize, std::max(longest, share));
+	}
+
+	// Indices of the examples of each batch, the way translate_batch cuts them with
+	// BatchType::Tokens: sorted by length so batches pad little, and cut at budget.
+	std::vector<std::vector<size_t>> cutBatches(const std::vector<size_t>& lengths, size_t budget)
+	{
+		std::vector<size_t> order(lengths.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(),
+			[&lengths](size_t a, size_t b) { return lengths[a] < lengths[b]; });
+
+		std::vector<std::vector<size_t>> batches;
+		size_t tokens = 0;
+		for (const size_t index : order)
+		{
+			if (batches.empty() || (!batches.back().empty() && tokens + lengths[index] > budget))
+			{
+				batches.emplace_back();
+				tokens = 0;
+			}
+			tokens += lengths[index];
+			batches.back().push_back(index);
+		}
+		return batches;
+	}
+
+	size_t sentenceCount(const std::vector<SentenceSegment>& segments)
+	{
+		return static_cast<size_t>(std::count_if(segments.begin(), segments.end(),
+			[](const SentenceSegment& segment) { return !segment.text.empty(); }));
+	}
+
+	std::optional<TunedProfile> findTunedProfile(const std::string& modelPath, const TranslatorConfig& config)
+	{
+		return config.useTunedProfile ? AutoTuner::load(modelPath) : std::nullopt;
+	}
+
+	// The profile fills in what the caller left automatic; explicit values win. Its
+	// layout was measured as a whole, so it only applies when both halves are automatic.
+	TranslatorConfig withTunedProfile(TranslatorConfig config, const std::optional<TunedProfile>& profile)
+	{
+		if (!profile)
+		{
+			return config;
+		}
+		if (config.replicas == 0 && config.threadsPerReplica == 0)
+		{
+			config.replicas = profile->config.replicas;
+			config.threadsPerReplica = profile->config.threadsPerReplica;
+		}
+		if (!config.computeType)
+		{
+			config.computeType = profile->config.computeType;
+		}
+		return config;
+	}
+}
+
+CTranslate2WrapperImpl::CTranslate2WrapperImpl(const std::string& modelPath, const TranslatorConfig& translatorConfig, LoadMode loadMode)
+	: nativeModelPath(modelPath)
+	, tunedProfile(findTunedProfile(modelPath, translatorConfig))
+	, config(withTunedProfile(translatorConfig, tunedProfile).resolved())
+	, cache(config.cacheCapacityBytes)
+{
+	translationOptions = makeTranslationOptions();
+	translationOptions.use_vmap = config.useVocabularyMap;
+	if (tunedProfile)
+	{
+		// A narrower beam only comes from a profile that checked it translates like the
+		// wider one; profiles saved before that check keep the default beam.
+		if (tunedProfile->beamSize >= translationOptions.beam_size || tunedProfile->agreement >= AutoTuneOptions().minAgreement)
+		{
+			translationOptions.beam_size = tunedProfile->beamSize;
+		}
+		maxBatchSize = tunedProfile->maxBatchSize;
+	}
+
+	if (loadMode == LoadMode::Background)
+	{
+		loaded = std::async(std::launch::async, [this] { load(); }).share();
+		return;
+	}
+
+	load();
+	std::promise<void> done;
+	done.set_value();
+	loaded = done.get_future().share();
+}
+
+CTranslate2WrapperImpl::~CTranslate2WrapperImpl()
+{
+	// The loading thread writes into this object; let it finish first.
+	if (loaded.valid())
+	{
+		loaded.wait();
+	}
+}
+
+void CTranslate2WrapperImpl::load()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto toMilliseconds = [](Clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+	const Clock::time_point start = Clock::now();
+
+	// Load the SentencePiece models once, instead of on every Translate call. They do
+	// not depend on the CTranslate2 model, so they load while the weights are read.
+	auto tokenizerLoad = std::async(std::launch::async, [this, start, toMilliseconds]
+		{
+			auto service = TokenizerService::forModel(nativeModelPath);
+			timings.tokenizer = toMilliseconds(Clock::now() - start);
+			return service;
+		});
+
+	try
+	{
+		// Create the native CTranslate2 Translator object. model.bin is read from a
+		// memory mapping instead of a buffered file stream, the vocabulary from its
+		// compiled form instead of JSON.
+		const auto reader = std::make_shared<MmapModelReader>(nativeModelPath);
+		ctranslate2::models::ModelLoader loader(reader);
+		loader.device = ctranslate2::Device::CPU;
+		loader.compute_type = *config.computeType;
+		loader.device_indices = { 0 };
+		loader.num_replicas_per_device = config.replicas;
+		translator = std::make_unique<ctranslate2::Translator>(loader, config.poolConfig());
+		scheduler = std::make_unique<RequestScheduler>(*translator, config.scheduling, config.maxQueuedBatches);
+		batcher = std::make_unique<ContinuousBatcher>(*scheduler, config.replicas);
+		model = std::dynamic_pointer_cast<const ctranslate2::models::SequenceToSequenceModel>(translator->get_first_replica().model());
+		if (!model)
+		{
+			throw std::runtime_error("The model in '" + nativeModelPath + "' is not a sequence-to-sequence model.");
+		}
+		sourceVocabulary = reader->compactVocabulary("source_vocabulary");
+		if (!sourceVocabulary)
+		{
+			sourceVocabulary = reader->compactVocabulary("shared_vocabulary");
+		}
+		timings.model = toMilliseconds(Clock::now() - start);
+	}
+	catch (...)
+	{
+		// Do not leave the tokenizer thread writing into a half-built object.
+		tokenizerLoad.wait();
+		throw;
+	}
+
+	tokenizer = tokenizerLoad.get();
+	if (PieceIdMap::supports(*model))
+	{
+		pieceIds = std::make_shared<const PieceIdMap>(tokenizer, *model, sourceVocabulary.get());
+	}
+	timings.total = toMilliseconds(Clock::now() - start);
+}
+
+bool CTranslate2WrapperImpl::isReady() const
+{
+	return loaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void CTranslate2WrapperImpl::ensureReady() const
+{
+	loaded.get();
+}
+
+void CTranslate2WrapperImpl::waitUntilReady() const
+{
+	loaded.wait();
+}
+
+bool CTranslate2WrapperImpl::waitUntilReady(std::chrono::milliseconds timeout) const
+{
+	return loaded.wait_for(timeout) == std::future_status::ready;
+}
+
+std::string CTranslate2WrapperImpl::translate(const std::string& text, std::shared_ptr<const CancellationFlag> cancellation) const
+{
+	ensureReady();
+	const std::vector<SentenceSegment> segments = segmentSentences(text);
+	if (sentenceCount(segments) > 1)
+	{
+		return translateSegments(segments, cancellation);
+	}
+	return translateOne(text, cancellation, nullptr);
+}
+
+std::string CTranslate2WrapperImpl::translateSegments(const std::vector<SentenceSegment>& segments, const std::shared_ptr<const CancellationFlag>& cancellation) const
+{
+	ScopedStageTimer timer(metrics, Stage::Translate);
+
+	// 1. Every sentence in one batch call; each one is cached on its own.
+	std::vector<std::string> sentences;
+	for (const SentenceSegment& segment : segments)
+	{
+		if (!segment.text.empty())
+		{
+			sentences.emplace_back(segment.text);
+		}
+	}
+	// Someone is waiting for the whole paragraph, so its sentences are interactive.
+	const std::vector<std::string> translations = translateBatch(sentences, maxBatchSize, cancellation, RequestClass::Interactive);
+
+	// 2. Put the translations back between the original separators.
+	std::string translation;
+	size_t next = 0;
+	for (const SentenceSegment& segment : segments)
+	{
+		if (!segment.text.empty() && next < translations.size())
+		{
+			translation += translations[next++];
+		}
+		translation += segment.trailing;
+	}
+	return translation;
+}
+
+std::string CTranslate2WrapperImpl::translateStreaming(const std::string& text, PartialTranslationCallback onPartial, std::shared_ptr<const CancellationFlag> cancellation) const
+{
+	ensureReady();
+	const std::vector<SentenceSegment> segments = segmentSentences(text);
+	if (sentenceCount(segments) > 1)
+	{
+		return translateSegmentsStreaming(segments, onPartial, cancellation);
+	}
+
+	TranslationStream stream(*model, *tokenizer, std::move(onPartial));
+	return translateOne(text, cancellation, &stream);
+}
+
+std::string CTranslate2WrapperImpl::translateSegmentsStreaming(const std::vector<SentenceSegment>& segments, const PartialTranslationCallback& onPartial, const std::shared_ptr<const CancellationFlag>& cancellation) const
+{
+	// Text of each segment so far: the streamed prefix of a sentence, then its translation.
+	std::mutex mutex;
+	std::vector<std::string> translations(segments.size());
+	std::vector<bool> finished(segments.size());
+	std::string reported;
+
+	// Reports the finished segments in order and the first unfinished one as it grows.
+	// Later sentences may finish first; they are held back so the text only ever grows.
+	const auto report = [&]
+	{
+		std::string text;
+		for (size_t i = 0; i < segments.size(); ++i)
+		{
+			text += translations[i];
+			if (!segments[i].text.empty() && !finished[i])
+			{
+				break;
+			}
+			text += segments[i].trailing;
+		}
+		if (onPartial && text.size() > reported.size())
+		{
+			reported = text;
+			onPartial(reported);
+		}
+	};
+
+	// 1. One streaming request per sentence, so they spread over the replicas like a
+	//    batch would, and each reports as it decodes. They are posted from this thread,
+	//    no more than there are replicas, and finished in order: the next sentence is
+	//    posted when the oldest one is done. The streams outlive every request.
+	std::vector<std::unique_ptr<TranslationStream>> streams(segments.size());
+	std::deque<std::pair<size_t, std::unique_ptr<PendingTranslation>>> inFlight;
+	std::exception_ptr error;
+	const auto finishOldest = [&]
+	{
+		const size_t i = inFlight.front().first;
+		const std::unique_ptr<PendingTranslation> pending = std::move(inFlight.front().second);
+		inFlight.pop_front();
+		try
+		{
+			std::string translation = finishOne(*pending);
+			std::lock_guard<std::mutex> lock(mutex);
+			translations[i] = std::move(translation);
+			finished[i] = true;
+			report();
+		}
+		catch (...)
+		{
+			if (!error)
+			{
+				error = std::current_exception();
+			}
+		}
+	};
+
+	const size_t maxInFlight = std::max<size_t>(config.replicas, 1);
+	for (size_t i = 0; i < segments.size() && !error; ++i)
+	{
+		if (segments[i].text.empty())
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			finished[i] = true;
+			continue;
+		}
+		if (inFlight.size() >= maxInFlight)
+		{
+			finishOldest();
+			if (error)
+			{
+				break;
+			}
+		}
+		try
+		{
+			streams[i] = std::make_unique<TranslationStream>(*model, *tokenizer, [&, i](const std::string& partialText)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					translations[i] = partialText;
+					report();
+				});
+			inFlight.emplace_back(i, startOne(std::string(segments[i].text), cancellation, streams[i].get()));
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+	}
+
+	// 2. Rethrows the first error, e.g. TranslationCanceled, once every request is done.
+	while (!inFlight.empty())
+	{
+		finishOldest();
+	}
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+
+	std::string translation;
+	for (size_t i = 0; i < segments.size(); ++i)
+	{
+		translation += translations[i];
+		translation += segments[i].trailing;
+	}
+	return translation;
+}
+
+std::vector<size_t> CTranslate2WrapperImpl::encodeSourceIds(const std::string& text) const
+{
+	if (pieceIds)
+	{
+		return pieceIds->encode(text, translationOptions.max_input_length);
+	}
+
+	std::vector<std::string> tokens = tokenizer->encode(text);
+	// opusmt does not need BOS tokens, only EOS
+	tokens.push_back("</s>");
+	return std::move(toSourceIds(*model, sourceVocabulary.get(), { tokens }, translationOptions.max_input_length).front());
+}
+
+std::string CTranslate2WrapperImpl::decodeTargetIds(const std::vector<size_t>& targetIds) const
+{
+	if (pieceIds)
+	{
+		return pieceIds->decode(targetIds);
+	}
+	return tokenizer->decode(toTargetPieces(*model, targetIds));
+}
+
+std::vector<size_t> CTranslate2WrapperImpl::encodeTargetIds(const std::string& text) const
+{
+	return std::move(model->get_target_vocabulary().to_ids({ tokenizer->encodeTarget(text) }).front());
+}
+
+void CTranslate2WrapperImpl::openTranslationMemory(const std::string& path)
+{
+	std::atomic_store(&translationMemory, std::make_shared<TranslationMemory>(path));
+}
+
+void CTranslate2WrapperImpl::closeTranslationMemory()
+{
+	std::atomic_store(&translationMemory, std::shared_ptr<TranslationMemory>());
+}
+
+std::shared_ptr<TranslationMemory> CTranslate2WrapperImpl::memory() const
+{
+	return std::atomic_load(&translationMemory);
+}
+
+std::optional<RequestScheduler::Clock::time_point> CTranslate2WrapperImpl::interactiveDeadlineFromNow() const
+{
+	const std::chrono::milliseconds deadline = interactiveDeadline;
+	if (deadline.count() <= 0)
+	{
+		return std::nullopt;
+	}
+	return RequestScheduler::Clock::now() + deadline;
+}
+
+std::string CTranslate2WrapperImpl::translateOne(const std::string& text, const std::shared_ptr<const CancellationFlag>& cancellation, TranslationStream* stream) const
+{
+	const std::unique_ptr<PendingTranslation> pending = startOne(text, cancellation, stream);
+	return finishOne(*pending);
+}
+
+std::unique_ptr<CTranslate2WrapperImpl::PendingTranslation> CTranslate2WrapperImpl::startOne(const std::string& text, const std::shared_ptr<const CancellationFlag>& cancellation, TranslationStream* stream) const
+{
+	const auto start = std::chrono::steady_clock::now();
+	auto pending = std::make_unique<PendingTranslation>();
+	pending->text = text;
+	pending->start = start;
+	// Settings may change while a request runs; it keeps the ones it started with.
+	const bool useDrafts = speculativeDrafts;
+	const bool useAdaptiveDecoding = adaptiveDecoding;
+	const bool useContinuousBatching = continuousBatching;
+	const size_t draftLayers = selfSpeculativeLayers;
+	const size_t draftLayerTokens = selfSpeculativeDraftTokens;
+	const float acceptScore = memoryAcceptScore;
+	const float hintScore = memoryHintScore;
+
+	// The vocabulary map restricts the output layer of the whole replica, which the
+	// shared loop cannot do for one of its rows.
+	const bool continuous = useContinuousBatching && !(translationOptions.use_vmap && model->get_vocabulary_map());
+	// Streamed text only ever grows, so a streaming request never switches hypotheses.
+	const bool adaptive = useAdaptiveDecoding && translationOptions.beam_size > 1 && !stream && !continuous;
+	// The truncated decoder only drafts for greedy search.
+	const bool selfSpeculative = draftLayers > 0 && translationOptions.beam_size == 1
+		&& translationOptions.sampling_topk == 1 && !continuous;
+	pending->useDrafts = useDrafts;
+	pending->adaptive = adaptive;
+
+	// The translation memory comes first: it holds what the user wants, which may
+	// differ from what the model said last time.
+	std::optional<TranslationMemoryMatch> memoryMatch;
+	if (const auto openMemory = memory())
+	{
+		memoryMatch = openMemory->find(text, std::min(acceptScore, hintScore));
+		if (memoryMatch && memoryMatch->score >= acceptScore)
+		{
+			metrics.record(Stage::MemoryHit, std::chrono::steady_clock::now() - start);
+			pending->translation = memoryMatch->target;
+			return pending;
+		}
+	}
+
+	// Cache hits are answered here, without touching the replica pool.
+	// Each decoding path keeps its own entries: self-speculative search may settle
+	// near-ties differently from greedy search.
+	std::string cacheModel = continuous ? nativeModelPath + "#continuous" : adaptive ? nativeModelPath + "#adaptive" : nativeModelPath;
+	if (selfSpeculative)
+	{
+		cacheModel += "#selfspec" + std::to_string(draftLayers);
+	}
+	pending->cacheKey = TranslationCache::makeKey(cacheModel, translationOptions, text);
+	if (auto cached = cache.find(pending->cacheKey))
+	{
+		metrics.record(Stage::CacheHit, std::chrono::steady_clock::now() - start);
+		pending->translation = std::move(*cached);
+		return pending;
+	}
+
+	if (cancellation)
+	{
+		cancellation->throwIfCanceled();
+	}
+
+	// 1. Tokenize the input string with the source SentencePiece model.
+	std::vector<std::vector<size_t>> sourceIds;
+	std::vector<size_t> outputIds;
+	{
+		ScopedStageTimer timer(metrics, Stage::Encode);
+
+		// With a vocabulary map, the decoder only scores the target candidates of this
+		// input. The map is keyed by piece strings, so only then are they built.
+		const ctranslate2::VocabularyMap* vocabularyMap = translationOptions.use_vmap ? model->get_vocabulary_map() : nullptr;
+		if (vocabularyMap)
+		{
+			std::vector<std::string> tokens = tokenizer->encode(text);
+			// opusmt does not need BOS tokens, only EOS
+			tokens.push_back("</s>");
+			sourceIds = toSourceIds(*model, sourceVocabulary.get(), { tokens }, translationOptions.max_input_length);
+			outputIds = vocabularyMap->get_candidates({ tokens }, { std::vector<size_t>() });
+		}
+		else
+		{
+			sourceIds = { encodeSourceIds(text) };
+		}
+	}
+
+	if (continuous)
+	{
+		// 2. Decode greedily in a loop shared with the other requests in flight.
+		//    Queueing, encoder and decoder time are not told apart here.
+		ctranslate2::DecodingOptions options = makeDecodingOptions(translationOptions, model->get_target_vocabulary());
+		options.beam_size = 1;
+		if (stream)
+		{
+			stream->attach(options);
+		}
+		pending->continuous = batcher->submit(std::move(sourceIds.front()), std::move(options), cancellation);
+		return pending;
+	}
+
+	// 2. Decode on the first free replica. The cancellation check runs inside the
+	//    beam/greedy search loop, so it also stops beam search, which the
+	//    TranslationOptions::callback hook does not reach.
+	ctranslate2::DecodingOptions decodingOptions = makeDecodingOptions(translationOptions, model->get_target_vocabulary());
+	if (cancellation)
+	{
+		decodingOptions.logits_processors.emplace_back(std::make_shared<CancellationCheck>(cancellation));
+	}
+	if (stream)
+	{
+		// The caller keeps the stream until finishOne has waited for the job below.
+		stream->attach(decodingOptions);
+	}
+	pending->stepCounter = std::make_shared<DecodeStepCounter>();
+	decodingOptions.logits_processors.emplace_back(pending->stepCounter);
+
+	// Adaptive decoding runs greedy search first and keeps the beam search options for
+	// the hypotheses that are not confident enough.
+	std::optional<ctranslate2::DecodingOptions> escalationOptions;
+	if (adaptive)
+	{
+		escalationOptions = decodingOptions;
+		decodingOptions.beam_size = 1;
+		pending->probe.attach(decodingOptions);
+	}
+
+	// The previous keystroke's hypothesis, if it is a plausible draft for this one.
+	// Verification accepts what greedy search would pick, so a draft would force that
+	// prefix on beam search; drafts only serve greedy decoding. Nor do they serve the
+	// greedy pass of adaptive decoding: the probe would not see the verified tokens, and
+	// a draft verified to its end would skip the escalation check.
+	const bool greedy = !escalationOptions && decodingOptions.beam_size == 1 && decodingOptions.sampling_topk == 1;
+	pending->greedy = greedy;
+	std::optional<std::vector<size_t>> draft;
+	if (useDrafts && greedy)
+	{
+		draft = drafts.find(text);
+	}
+	// Otherwise the target of a near translation memory match.
+	if (greedy && !draft && memoryMatch && memoryMatch->score >= hintScore)
+	{
+		draft = encodeTargetIds(memoryMatch->target);
+	}
+
+	pending->draftTokens = draft ? draft->size() : 0;
+
+	// The job fills in the pending translation, which stays put until finishOne.
+	const auto posted = std::chrono::steady_clock::now();
+	pending->decoding = scheduler->post<ctranslate2::DecodingResult>(RequestClass::Interactive,
+		[this, posted, sourceIds = std::move(sourceIds), outputIds = std::move(outputIds), decodingOptions = std::move(decodingOptions), escalationOptions = std::move(escalationOptions), cancellation, draft = std::move(draft), selfSpeculative, draftLayers, draftLayerTokens, stream, &probe = pending->probe, &acceptedTokens = pending->acceptedTokens, &prefixTokens = pending->prefixTokens, &escalated = pending->escalated, &selfSpeculated = pending->selfSpeculated](ctranslate2::models::SequenceToSequenceReplica& replica)
+		{
+			metrics.record(Stage::Queue, std::chrono::steady_clock::now() - posted);
+
+			// The request may have been superseded while it was waiting for a replica.
+			if (cancellation)
+			{
+				cancellation->throwIfCanceled();
+			}
+
+			EncoderDecoderRunner runner(replica);
+			runner.restrictOutput(outputIds);
+			ctranslate2::layers::DecoderState state;
+			{
+				ScopedStageTimer timer(metrics, Stage::Encoder);
+				state = runner.encode(sourceIds);
+			}
+
+			// Decoding consumes the state; an escalation starts again from the encoder
+			// output instead of running the encoder twice.
+			std::optional<ctranslate2::layers::DecoderState> encoded;
+			if (escalationOptions)
+			{
+				encoded = state;
+			}
+
+			// A draft accepted up to its end token leaves nothing to decode, and the
+			// verification agreed with greedy search at every position.
+			bool decoded = true;
+			const auto decodeFirst = [&]() -> ctranslate2::DecodingResult
+			{
+				ScopedStageTimer timer(metrics, Stage::Decoder);
+				if (!draft || draft->empty())
+				{
+					// Without a keystroke draft, the first decoder layers can draft instead.
+					if (const auto truncated = selfSpeculative ? TruncatedDecoder::create(runner, draftLayers) : nullptr)
+					{
+						selfSpeculated = true;
+						ctranslate2::DecodingResult result;
+						result.hypotheses.emplace_back(decodeSelfSpeculative(runner, *truncated, state, decodingOptions,
+							draftLayerTokens, cancellation.get(), selfSpeculation));
+						return result;
+					}
+					return std::move(runner.decode(state, { {} }, decodingOptions).front());
+				}
+
+				// Verify the whole draft in one parallel pass, then decode step by step
+				// only from the first token the model disagrees with.
+				const DraftVerification verification = verifyDraft(runner, state, *draft, decodingOptions);
+				acceptedTokens = verification.acceptedIds.size();
+
+				std::vector<size_t> prefix = verification.acceptedIds;
+				if (verification.correctionId != runner.endId())
+				{
+					prefix.push_back(verification.correctionId);
+				}
+				prefixTokens = prefix.size();
+
+				if (verification.finished)
+				{
+					decoded = false;
+					ctranslate2::DecodingResult result;
+					result.hypotheses.emplace_back(std::move(prefix));
+					return result;
+				}
+
+				if (stream)
+				{
+					stream->pushPrefix(prefix);
+				}
+				return std::move(runner.decode(state, { prefix }, decodingOptions).front());
+			};
+
+			ctranslate2::DecodingResult result = decodeFirst();
+			if (escalationOptions && decoded && escalation.shouldEscalate(probe.confidence(result, decodingOptions.max_length)))
+			{
+				if (cancellation)
+				{
+					cancellation->throwIfCanceled();
+				}
+
+				ScopedStageTimer timer(metrics, Stage::Escalation);
+				escalated = true;
+				result = std::move(runner.decode(*encoded, { {} }, *escalationOptions).front());
+			}
+			return result;
+		}, interactiveDeadlineFromNow());
+	return pending;
+}
+
+std::string CTranslate2WrapperImpl::finishOne(PendingTranslation& pending) const
+{
+	if (pending.translation)
+	{
+		return std::move(*pending.translation);
+	}
+
+	// Last step of both decoding paths: detokenize with the target model (the
+	// hypothesis is made of target ids) and cache the translation.
+	const auto detokenize = [&](const std::vector<size_t>& targetIds)
+	{
+		std::string translation;
+		{
+			ScopedStageTimer timer(metrics, Stage::Detokenize);
+			translation = decodeTargetIds(targetIds);
+		}
+		cache.insert(pending.cacheKey, translation);
+		metrics.record(Stage::Translate, std::chrono::steady_clock::now() - pending.start);
+		return translation;
+	};
+
+	if (pending.continuous.valid())
+	{
+		const std::vector<size_t> targetIds = pending.continuous.get();
+		metrics.recordDecodeSteps(targetIds.size());
+		return detokenize(targetIds);
+	}
+
+	const ctranslate2::DecodingResult result = pending.decoding.get();
+	metrics.recordDecodeSteps(pending.selfSpeculated && !result.hypotheses.empty() ? result.hypotheses[0].size() : pending.stepCounter->steps());
+	if (pending.adaptive)
+	{
+		escalation.recordRequest(pending.escalated);
+	}
+
+	if (result.hypotheses.empty())
+	{
+		return std::string();
+	}
+
+	if (pending.useDrafts && pending.greedy)
+	{
+		const std::vector<size_t>& hypothesis = result.hypotheses[0];
+		const size_t decodedTokens = hypothesis.size() > pending.prefixTokens ? hypothesis.size() - pending.prefixTokens : 0;
+		drafts.recordRequest(pending.draftTokens, pending.acceptedTokens, decodedTokens);
+		drafts.remember(pending.text, hypothesis);
+	}
+
+	return detokenize(result.hypotheses[0]);
+}
+
+std::string CTranslate2WrapperImpl::translatePivot(const CTranslate2WrapperImpl& next, const std::string& text, std::shared_ptr<const CancellationFlag> cancellation) const
+{
+	// A pivot needs both models; each one is waited for on its own.
+	ensureReady();
+	next.ensureReady();
+
+	// The remap table only depends on the two vocabularies, build it once per pair.
+	std::shared_ptr<const PieceRemap> remap;
+	{
+		std::lock_guard<std::mutex> lock(pivotMutex);
+		auto& entry = pivotRemaps[next.nativeModelPath];
+		if (!entry)
+		{
+			entry = std::make_shared<const PieceRemap>(*this, next);
+		}
+		remap = entry;
+	}
+
+	ScopedStageTimer timer(metrics, Stage::Pivot);
+	const PivotPipeline pipeline(*this, next, std::move(remap));
+	return pipeline.translate(text, cancellation);
+}
+
+std::future<std::vector<size_t>> CTranslate2WrapperImpl::translateIdsAsync(std::vector<size_t> sourceIds, std::shared_ptr<const CancellationFlag> cancellation) const
+{
+	ensureReady();
+	ctranslate2::DecodingOptions decodingOptions = makeDecodingOptions(translationOptions, model->get_target_vocabulary());
+	decodingOptions.num_hypotheses = 1;
+	if (cancellation)
+	{
+		decodingOptions.logits_processors.emplace_back(std::make_shared<CancellationCheck>(cancellation));
+	}
+
+	return scheduler->post<std::vector<size_t>>(RequestClass::Interactive,
+		[sourceIds = std::move(sourceIds), decodingOptions = std::move(decodingOptions), cancellation](ctranslate2::models::SequenceToSequenceReplica& replica)
+		{
+			if (cancellation)
+			{
+				cancellation->throwIfCanceled();
+			}
+
+			EncoderDecoderRunner runner(replica);
+			ctranslate2::layers::DecoderState state = runner.encode({ sourceIds });
+			ctranslate2::DecodingResult result = runner.decode(state, { {} }, decodingOptions).front();
+			if (result.hypotheses.empty())
+			{
+				return std::vector<size_t>();
+			}
+
+			std::vector<size_t> ids = std::move(result.hypotheses[0]);
+			ids.erase(std::remove_if(ids.begin(), ids.end(), [&runner](size_t id) { return id == runner.endId() || id == runner.startId(); }), ids.end());
+			return ids;
+		}, interactiveDeadlineFromNow());
+}
+
+ConfidenceThresholds CTranslate2WrapperImpl::calibrateAdaptiveDecoding(const std::vector<std::string>& texts, double targetAgreement) const
+{
+	ensureReady();
+	ctranslate2::DecodingOptions beamOptions = makeDecodingOptions(translationOptions, model->get_target_vocabulary());
+	beamOptions.num_hypotheses = 1;
+	ctranslate2::DecodingOptions greedyOptions = beamOptions;
+	greedyOptions.beam_size = 1;
+
+	// 1. Decode every sentence both ways from the same encoder output, in the
+	//    background: keystrokes still get a replica while calibration runs.
+	std::vector<std::future<CalibrationSample>> jobs;
+	jobs.reserve(texts.size());
+	for (const std::string& text : texts)
+	{
+		jobs.push_back(scheduler->post<CalibrationSample>(RequestClass::Background,
+			[sourceIds = encodeSourceIds(text), greedyOptions, beamOptions](ctranslate2::models::SequenceToSequenceReplica& replica)
+			{
+				EncoderDecoderRunner runner(replica);
+				ctranslate2::layers::DecoderState state = runner.encode({ sourceIds });
+				ctranslate2::layers::DecoderState encoded = state;
+
+				GreedyConfidenceProbe probe;
+				ctranslate2::DecodingOptions options = greedyOptions;
+				probe.attach(options);
+				const ctranslate2::DecodingResult greedy = runner.decode(state, { {} }, options).front();
+				const ctranslate2::DecodingResult beam = runner.decode(encoded, { {} }, beamOptions).front();
+
+				CalibrationSample sample;
+				sample.greedy = probe.confidence(greedy, greedyOptions.max_length);
+				sample.matchesBeam = !greedy.hypotheses.empty() && !beam.hypotheses.empty() && greedy.hypotheses[0] == beam.hypotheses[0];
+				return sample;
+			}));
+	}
+
+	// 2. Pick the thresholds and use them from now on.
+	std::vector<CalibrationSample> samples;
+	samples.reserve(jobs.size());
+	for (auto& job : jobs)
+	{
+		samples.push_back(job.get());
+	}
+	const ConfidenceThresholds thresholds = EscalationPolicy::calibrate(samples, targetAgreement);
+	escalation.setThresholds(thresholds);
+	return thresholds;
+}
+
+std::vector<std::string> CTranslate2WrapperImpl::translateBatch(const std::vector<std::string>& texts, size_t maxBatchSize, std::shared_ptr<const CancellationFlag> cancellation, RequestClass requestClass) const
+{
+	if (texts.empty())
+	{
+		return {};
+	}
+	ensureReady();
+	ScopedStageTimer timer(metrics, Stage::Batch);
+
+	// 1. Answer what we can from the translation memory, then from the cache.
+	const auto openMemory = memory();
+	const float acceptScore = memoryAcceptScore;
+	std::vector<std::string> translations(texts.size());
+	std::vector<std::string> cacheKeys;
+	std::vector<size_t> missing;
+	std::vector<std::string> missingTexts;
+	cacheKeys.reserve(texts.size());
+	for (size_t i = 0; i < texts.size(); ++i)
+	{
+		cacheKeys.push_back(TranslationCache::makeKey(nativeModelPath, translationOptions, texts[i]));
+		if (openMemory)
+		{
+			if (auto match = openMemory->find(texts[i], acceptScore))
+			{
+				translations[i] = std::move(match->target);
+				continue;
+			}
+		}
+		if (auto cached = cache.find(cacheKeys.back()))
+		{
+			translations[i] = std::move(*cached);
+			continue;
+		}
+		missing.push_back(i);
+		missingTexts.push_back(texts[i]);
+	}
+
+	if (missing.empty())
+	{
+		return translations;
+	}
+	if (cancellation)
+	{
+		cancellation->throwIfCanceled();
+	}
+
+	// 2. Translate the rest. The vocabulary map is keyed by piece strings, so with it
+	//    the batches are translated as pieces; otherwise ids end to end.
+	const bool usePieces = !pieceIds || (translationOptions.use_vmap && model->get_vocabulary_map());
+	const std::vector<std::optional<std::string>> results = usePieces
+		? translatePieceBatch(missingTexts, maxBatchSize, cancellation, requestClass)
+		: translateIdBatch(missingTexts, maxBatchSize, cancellation, requestClass);
+
+	// 3. Fill in the results in input order.
+	for (size_t i = 0; i < results.size() && i < missing.size(); ++i)
+	{
+		if (!results[i])
+		{
+			continue;
+		}
+
+		const size_t index = missing[i];
+		translations[index] = *results[i];
+		cache.insert(cacheKeys[index], translations[index]);
+	}
+	return translations;
+}
+
+std::vector<std::optional<std::string>> CTranslate2WrapperImpl::translatePieceBatch(const std::vector<std::string>& texts, size_t maxBatchSize, const std::shared_ptr<const CancellationFlag>& cancellation, RequestClass requestClass) const
+{
+	// 1. Tokenize with the source SentencePiece model.
+	std::vector<std::vector<std::string>> batch_tokens;
+	std::vector<size_t> lengths;
+	batch_tokens.reserve(texts.size());
+	lengths.reserve(texts.size());
+	for (const std::string& text : texts)
+	{
+		std::vector<std::string> tokens = tokenizer->encode(text);
+		// opusmt does not need BOS tokens, only EOS
+		tokens.push_back("</s>");
+		lengths.push_back(tokens.size());
+		batch_tokens.push_back(std::move(tokens));
+	}
+
+	// 2. Cut the batches like translate_batch does and post each one through the
+	//    scheduler. The replica's translate has no hook into beam search, so
+	//    cancellation is only checked before a batch starts.
+	std::vector<std::pair<std::vector<size_t>, std::future<std::vector<ctranslate2::TranslationResult>>>> jobs;
+	for (std::vector<size_t>& indices : cutBatches(lengths, spreadBatchBudget(lengths, maxBatchSize, config.replicas)))
+	{
+		std::vector<std::vector<std::string>> batch;
+		batch.reserve(indices.size());
+		for (const size_t index : indices)
+		{
+			batch.push_back(std::move(batch_tokens[index]));
+		}
+
+		auto future = scheduler->post<std::vector<ctranslate2::TranslationResult>>(requestClass,
+			[batch = std::move(batch), options = translationOptions, cancellation](ctranslate2::models::SequenceToSequenceReplica& replica)
+			{
+				if (cancellation)
+				{
+					cancellation->throwIfCanceled();
+				}
+				return replica.translate(batch, {}, options);
+			});
+		jobs.emplace_back(std::move(indices), std::move(future));
+	}
+
+	// 3. Detokenize with the target model; the hypotheses are made of target pieces.
+	std::vector<std::optional<std::string>> translations(texts.size());
+	for (auto& [indices, future] : jobs)
+	{
+		const std::vector<ctranslate2::TranslationResult> results = future.get();
+		for (size_t i = 0; i < results.size() && i < indices.size(); ++i)
+		{
+			if (results[i].hypotheses.empty())
+			{
+				continue;
+			}
+
+			// Remove BOS/EOS tokens
+			auto hypothesis = results[i].hypotheses[0];
+			if (!hypothesis.empty() && hypothesis.front() == "<s>")
+				hypothesis.erase(hypothesis.begin());
+			if (!hypothesis.empty() && hypothesis.back() == "</s>")
+				hypothesis.pop_back();
+
+			translations[indices[i]] = tokenizer->decode(hypothesis);
+		}
+	}
+	return translations;
+}
+
+std::vector<std::optional<std::string>> CTranslate2WrapperImpl::translateIdBatch(const std::vector<std::string>& texts, size_t maxBatchSize, const std::shared_ptr<const CancellationFlag>& cancellation, RequestClass requestClass) const
+{
+	// 1. Text to model ids through the SentencePiece id tables.
+	std::vector<std::vector<size_t>> sourceIds;
+	std::vector<size_t> lengths;
+	sourceIds.reserve(texts.size());
+	lengths.reserve(texts.size());
+	for (const std::string& text : texts)
+	{
+		sourceIds.push_back(encodeSourceIds(text));
+		lengths.push_back(sourceIds.back().size());
+	}
+
+	// 2. Same batching as translate_batch with BatchType::Tokens, each batch posted
+	//    through the scheduler.
+	ctranslate2::DecodingOptions decodingOptions = makeDecodingOptions(translationOptions, model->get_target_vocabulary());
+	if (cancellation)
+	{
+		decodingOptions.logits_processors.emplace_back(std::make_shared<CancellationCheck>(cancellation));
+	}
+	std::vector<std::pair<std::vector<size_t>, std::future<std::vector<ctranslate2::DecodingResult>>>> jobs;
+	for (std::vector<size_t>& indices : cutBatches(lengths, spreadBatchBudget(lengths, maxBatchSize, config.replicas)))
+	{
+		std::vector<std::vector<size_t>> batch;
+		batch.reserve(indices.size());
+		for (const size_t index : indices)
+		{
+			batch.push_back(std::move(sourceIds[index]));
+		}
+
+		auto future = scheduler->post<std::vector<ctranslate2::DecodingResult>>(requestClass,
+			[batch = std::move(batch), decodingOptions, cancellation](ctranslate2::models::SequenceToSequenceReplica& replica)
+			{
+				if (cancellation)
+				{
+					cancellation->throwIfCanceled();
+				}
+
+				EncoderDecoderRunner runner(replica);
+				ctranslate2::layers::DecoderState state = runner.encode(batch);
+				return runner.decode(state, std::vector<std::vector<size_t>>(batch.size()), decodingOptions);
+			});
+		jobs.emplace_back(std::move(indices), std::move(future));
+	}
+
+	// 3. Detokenize the target ids straight with the target SentencePiece model.
+	std::vector<std::optional<std::string>> translations(texts.size());
+	for (auto& [indices, future] : jobs)
+	{
+		const std::vector<ctranslate2::DecodingResult> results = future.get();
+		for (size_t i = 0; i < results.size() && i < indices.size(); ++i)
+		{
+			if (!results[i].hypotheses.empty())
+			{
+				translations[indices[i]] = decodeTargetIds(results[i].hypotheses[0]);
+			}
+		}
+	}
+	return translations;
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+// Native half of the wrapper. Nothing in here may depend on C++/CLI, so the
+// translation core can be compiled as plain C++ and shared between targets.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ctranslate2/translator.h>
+
+#include "AdaptiveDecoding.h"
+#include "AutoTuner.h"
+#include "Cancellation.h"
+#include "CompactVocabulary.h"
+#include "ContinuousBatcher.h"
+#include "PieceIdMap.h"
+#include "PivotPipeline.h"
+#include "RequestScheduler.h"
+#include "SelfSpeculativeDecoding.h"
+#include "SentenceSegmenter.h"
+#include "SpeculativeDraft.h"
+#include "StageMetrics.h"
+#include "TokenizerService.h"
+#include "TranslationCache.h"
+#include "TranslationMemory.h"
+#include "TranslationStream.h"
+#include "TranslatorConfig.h"
+
+// This is the Private Implementation (PImpl) idiom.
+// It hides the native C++ types from the header file, which improves compile times
+// and prevents issues with including native headers in C# projects.
+class CTranslate2WrapperImpl
+{
+public:
+    enum class LoadMode
+    {
+        // The constructor returns once the model is loaded and throws if it fails.
+        Synchronous,
+        // The constructor returns at once and the model loads on a background thread.
+        // Every translate call waits for it; a load error is thrown from there.
+        Background,
+    };
+
+    // Wall-clock time spent loading, in milliseconds. The CTranslate2 model and the
+    // SentencePiece models are loaded concurrently, so total is about the larger of both.
+    struct LoadTimings
+    {
+        double model = 0;
+        double tokenizer = 0;
+        double total = 0;
+    };
+
+    // The configuration is resolved and validated before loading starts, so an invalid
+    // one throws std::invalid_argument from here even in LoadMode::Background.
+    explicit CTranslate2WrapperImpl(const std::string& modelPath,
+                                    const CTranslate2Wrapper::Native::TranslatorConfig& config = {},
+                                    LoadMode loadMode = LoadMode::Synchronous);
+    ~CTranslate2WrapperImpl();
+
+    CTranslate2WrapperImpl(const CTranslate2WrapperImpl&) = delete;
+    CTranslate2WrapperImpl& operator=(const CTranslate2WrapperImpl&) = delete;
+
+    // True once loading has finished, successfully or not. Never blocks.
+    bool isReady() const;
+    // Blocks until the model is loaded; rethrows the load error if there was one.
+    void ensureReady() const;
+    // Waits for loading to finish without rethrowing a load error.
+    void waitUntilReady() const;
+    // Same, for at most timeout; returns isReady().
+    bool waitUntilReady(std::chrono::milliseconds timeout) const;
+    // Only meaningful once ready.
+    const LoadTimings& loadTimings() const { return timings; }
+
+    // Default token budget of one batch handed to a replica by translateBatch.
+    static constexpr size_t defaultMaxBatchSize = 1024;
+
+    // Translates UTF-8 text and returns the UTF-8 result. Text of several sentences (see
+    // segmentSentences) is translated as one batch of sentences spread over the replicas
+    // and put back together with its original whitespace, so a pasted paragraph takes
+    // about as long as its longest sentence and is not cut at max_input_length.
+    // When a cancellation flag is given, it is checked before the request reaches a
+    // replica and at every decoding step; a canceled request throws TranslationCanceled.
+    std::string translate(const std::string& text,
+                          std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> cancellation = nullptr) const;
+
+    // Same as translate, but reports the translation decoded so far through onPartial
+    // while the decoder is running. The callback is invoked on the replica thread.
+    // The sentences of longer text are decoded in parallel, one request each and at most
+    // one per replica at a time; what is reported is the finished sentences in order,
+    // followed by the first unfinished one as it grows. A sentence answered by the cache
+    // or the translation memory is reported on the calling thread.
+    std::string translateStreaming(const std::string& text,
+                                   CTranslate2Wrapper::Native::PartialTranslationCallback onPartial,
+                                   std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> cancellation = nullptr) const;
+
+    // Translates several UTF-8 sentences. They are sorted by length and cut into
+    // batches of at most maxBatchSize tokens (BatchType::Tokens), and into at least as
+    // many batches as there are replicas when the sentences allow it. Results are
+    // returned in input order. The cancellation flag works as in translate. The batches
+    // queue behind interactive requests unless requestClass says otherwise.
+    std::vector<std::string> translateBatch(const std::vector<std::string>& texts,
+                                            size_t maxBatchSize = defaultMaxBatchSize,
+                                            std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> cancellation = nullptr,
+                                            CTranslate2Wrapper::Native::RequestClass requestClass = CTranslate2Wrapper::Native::RequestClass::Bulk) const;
+
+    // Translates with this model and feeds the result to next, returning next's output.
+    // The intermediate text is handed over piece by piece, sentence by sentence
+    // (see PivotPipeline).
+    std::string translatePivot(const CTranslate2WrapperImpl& next,
+                               const std::string& text,
+                               std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> cancellation = nullptr) const;
+
+    // Posts one example of model source ids (end token included) to the first free
+    // replica, as an interactive request. The future yields the best hypothesis as target ids, without start or end
+    // token. Nothing is cached; this is the building block of multi-model pipelines.
+    std::future<std::vector<size_t>> translateIdsAsync(std::vector<size_t> sourceIds,
+                                                       std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag> cancellation = nullptr) const;
+
+    // Decodes every sentence greedily and with beam_size, and sets the escalation
+    // thresholds to the ones that escalate the fewest of them while the greedy output
+    // kept matches beam search for at least targetAgreement of it. Returns them.
+    CTranslate2Wrapper::Native::ConfidenceThresholds calibrateAdaptiveDecoding(const std::vector<std::string>& texts,
+                                                                              double targetAgreement = 0.95) const;
+
+    // Model source ids (end token included) of a UTF-8 sentence, and the text of model
+    // target ids. Both go id to id through pieceIds when the model allows it.
+    std::vector<size_t> encodeSourceIds(const std::string& text) const;
+    std::string decodeTargetIds(const std::vector<size_t>& targetIds) const;
+    // Model target ids of a UTF-8 translation, without start or end token.
+    std::vector<size_t> encodeTargetIds(const std::string& text) const;
+
+    // Opens the translation memory stored at path (see TranslationMemory), which is
+    // created by its first save if it does not exist, in place of the current one.
+    // Requests already running keep the memory they started with.
+    void openTranslationMemory(const std::string& path);
+    void closeTranslationMemory();
+    // The open translation memory, or nullptr.
+    std::shared_ptr<CTranslate2Wrapper::Native::TranslationMemory> memory() const;
+
+    const std::string nativeModelPath;
+    // Profile saved by AutoTuner for this model and machine, if it was applied.
+    const std::optional<CTranslate2Wrapper::Native::TunedProfile> tunedProfile;
+    // Replica and thread layout the translator was built with, automatic values resolved.
+    const CTranslate2Wrapper::Native::TranslatorConfig config;
+    // Orders every request posted to the replicas. Declared before translator: pull
+    // jobs still queued when the pool shuts down run against it.
+    std::unique_ptr<CTranslate2Wrapper::Native::RequestScheduler> scheduler;
+    // Shared greedy decoding loops for continuousBatching; same lifetime rule.
+    std::unique_ptr<CTranslate2Wrapper::Native::ContinuousBatcher> batcher;
+    // This holds the pointer to the actual CTranslate2 engine.
+    std::unique_ptr<ctranslate2::Translator> translator;
+    // The loaded model, shared by all replicas. Used for vocabulary lookups outside the replicas.
+    std::shared_ptr<const ctranslate2::models::SequenceToSequenceModel> model;
+    // Source/target SentencePiece models, shared with other translators on the same directory.
+    std::shared_ptr<const CTranslate2Wrapper::Native::TokenizerService> tokenizer;
+    // Compiled source vocabulary used for piece -> id lookups, when the model has one.
+    std::shared_ptr<const CTranslate2Wrapper::Native::CompactVocabulary> sourceVocabulary;
+    // SentencePiece id <-> model id tables, or nullptr if the model adds source start or
+    // end tokens (the piece path handles those).
+    std::shared_ptr<const CTranslate2Wrapper::Native::PieceIdMap> pieceIds;
+    // True once loaded if the model directory has a vmap.txt (see VocabularyMapBuilder).
+    bool hasVocabularyMap() const { return model && model->get_vocabulary_map() != nullptr; }
+    // Decoding options used for every request of this translator. use_vmap follows
+    // config.useVocabularyMap and only has an effect when the model has a vmap.txt.
+    ctranslate2::TranslationOptions translationOptions;
+    // Token budget per batch used when the caller does not pass one.
+    size_t maxBatchSize = defaultMaxBatchSize;
+    // Finished translations keyed by normalized text, model and decoding options.
+    // Sized by config.cacheCapacityBytes.
+    mutable CTranslate2Wrapper::Native::TranslationCache cache;
+    // When set, translate uses the previous keystroke's hypothesis as a draft that is
+    // verified in one decoder pass; decoding resumes at the first rejected token.
+    // Verification checks the draft against greedy search, so drafts are only used when
+    // the request decodes greedily (beam_size 1); with beam search, adaptiveDecoding
+    // included, they are ignored and the output is the beam search one.
+    std::atomic<bool> speculativeDrafts{ false };
+    // Last hypothesis and draft counters for speculativeDrafts.
+    mutable CTranslate2Wrapper::Native::DraftStore drafts;
+    // When above zero and translate decodes greedily, the first selfSpeculativeLayers
+    // decoder layers draft selfSpeculativeDraftTokens tokens at a time and the full
+    // decoder verifies them in one pass (see decodeSelfSpeculative, also for how its
+    // output can differ from greedy search). A keystroke draft from speculativeDrafts is
+    // used first when there is one.
+    std::atomic<size_t> selfSpeculativeLayers{ 0 };
+    std::atomic<size_t> selfSpeculativeDraftTokens{ 4 };
+    // Counters for selfSpeculativeLayers.
+    mutable CTranslate2Wrapper::Native::SelfSpeculativeCounters selfSpeculation;
+    // When set, translate decodes greedily first and only decodes again with beam_size
+    // when the greedy hypothesis is below the escalation thresholds. Streaming requests
+    // and batches always use beam_size.
+    std::atomic<bool> adaptiveDecoding{ false };
+    // Confidence thresholds and escalation counters for adaptiveDecoding.
+    mutable CTranslate2Wrapper::Native::EscalationPolicy escalation;
+    // When set, translate decodes greedily in a decoding loop shared with the other
+    // requests in flight (see ContinuousBatcher): a request joins the loop at the next
+    // step and leaves it as soon as it is done. beam_size is not used; streaming and
+    // cancellation work, drafts and adaptive decoding do not apply. Text decoded with
+    // the vocabulary map keeps the regular path. Slower than the regular path for more
+    // staggered requests than replicas, hence off by default.
+    std::atomic<bool> continuousBatching{ false };
+    // Translation memory matches scoring at least memoryAcceptScore are returned by
+    // translate and translateBatch without running the model; 1 (the default) only
+    // returns exact matches. Below that, translate hands the target of a match scoring
+    // at least memoryHintScore to the decoder as a draft, verified like the keystroke
+    // drafts: the prefix the model agrees with is kept without decoding it step by step.
+    // As with speculativeDrafts, only greedy decoding takes the draft.
+    std::atomic<float> memoryAcceptScore{ 1.0f };
+    std::atomic<float> memoryHintScore{ 0.7f };
+    // How long a translate request may wait for a replica before it is dropped with
+    // DeadlineExceeded; zero waits forever. By then a newer keystroke has usually
+    // superseded it.
+    std::atomic<std::chrono::milliseconds> interactiveDeadline{ std::chrono::milliseconds(0) };
+    // Always-on latency histograms per translation stage and decode steps per request.
+    // The C++/CLI layer records its own marshaling stages here too.
+    mutable CTranslate2Wrapper::Native::StageMetrics metrics;
+
+private:
+    void load();
+
+    // Completed by load(). Every member filled in by load() is only read after waiting on it.
+    std::shared_future<void> loaded;
+    LoadTimings timings;
+
+    // Swapped with std::atomic_store, so a request can take it while another thread
+    // opens a new one.
+    std::shared_ptr<CTranslate2Wrapper::Native::TranslationMemory> translationMemory;
+
+    // Piece remap tables towards the models this one has been chained with, by model path.
+    mutable std::mutex pivotMutex;
+    mutable std::map<std::string, std::shared_ptr<const CTranslate2Wrapper::Native::PieceRemap>> pivotRemaps;
+
+    // translateBatch for the examples not in the cache: as piece strings or as
+    // SentencePiece ids, batch by batch through the scheduler. nullopt when the model
+    // returned no hypothesis.
+    std::vector<std::optional<std::string>> translatePieceBatch(const std::vector<std::string>& texts, size_t maxBatchSize,
+                                                                const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation,
+                                                                CTranslate2Wrapper::Native::RequestClass requestClass) const;
+    std::vector<std::optional<std::string>> translateIdBatch(const std::vector<std::string>& texts, size_t maxBatchSize,
+                                                             const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation,
+                                                             CTranslate2Wrapper::Native::RequestClass requestClass) const;
+
+    // Deadline of an interactive request posted now, if interactiveDeadline is set.
+    std::optional<CTranslate2Wrapper::Native::RequestScheduler::Clock::time_point> interactiveDeadlineFromNow() const;
+
+    // translate for text of several sentences.
+    std::string translateSegments(const std::vector<CTranslate2Wrapper::Native::SentenceSegment>& segments,
+                                  const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation) const;
+    // translateStreaming for text of several sentences.
+    std::string translateSegmentsStreaming(const std::vector<CTranslate2Wrapper::Native::SentenceSegment>& segments,
+                                           const CTranslate2Wrapper::Native::PartialTranslationCallback& onPartial,
+                                           const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation) const;
+
+    std::string translateOne(const std::string& text,
+                             const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation,
+                             CTranslate2Wrapper::Native::TranslationStream* stream) const;
+
+    // translateOne between posting its job and waiting for it, so a caller can keep
+    // several requests in flight from one thread. The job writes into it, so it stays
+    // where startOne allocated it, and the stream stays alive, until finishOne returns.
+    struct PendingTranslation
+    {
+        std::string text;
+        std::chrono::steady_clock::time_point start;
+        // Set when the translation memory or the cache answered without a replica.
+        std::optional<std::string> translation;
+        std::string cacheKey;
+        bool useDrafts = false;
+        bool greedy = false;
+        bool adaptive = false;
+        size_t draftTokens = 0;
+        // Filled by the replica job.
+        CTranslate2Wrapper::Native::GreedyConfidenceProbe probe;
+        std::shared_ptr<CTranslate2Wrapper::Native::DecodeStepCounter> stepCounter;
+        size_t acceptedTokens = 0;
+        size_t prefixTokens = 0;
+        bool escalated = false;
+        // The self-speculative loop runs the decoder without the step counter.
+        bool selfSpeculated = false;
+        // One of these is valid unless translation is set.
+        std::future<ctranslate2::DecodingResult> decoding;
+        std::future<std::vector<size_t>> continuous;
+    };
+    std::unique_ptr<PendingTranslation> startOne(const std::string& text,
+                                                 const std::shared_ptr<const CTranslate2Wrapper::Native::CancellationFlag>& cancellation,
+                                                 CTranslate2Wrapper::Native::TranslationStream* stream) const;
+    // Waits for the job, then detokenizes, caches and records the translation.
+    std::string finishOne(PendingTranslation& pending) const;
+};
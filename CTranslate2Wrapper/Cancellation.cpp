@@ -0,0 +1,20 @@
+#include "Cancellation.h"
+
+namespace CTranslate2Wrapper::Native {
+
+	CancellationCheck::CancellationCheck(std::shared_ptr<const CancellationFlag> flag)
+		: m_flag(std::move(flag))
+	{
+	}
+
+	void CancellationCheck::apply(ctranslate2::dim_t,
+	                              ctranslate2::StorageView&,
+	                              ctranslate2::DisableTokens&,
+	                              const ctranslate2::StorageView&,
+	                              const std::vector<ctranslate2::dim_t>&,
+	                              const std::vector<std::vector<size_t>>*)
+	{
+		m_flag->throwIfCanceled();
+	}
+
+}
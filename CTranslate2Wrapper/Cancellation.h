@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+#include <ctranslate2/decoding_utils.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    // Thrown out of the decoding loop when the caller gave up on a request.
+    class TranslationCanceled : public std::runtime_error
+    {
+    public:
+        TranslationCanceled()
+            : std::runtime_error("The translation was canceled.")
+        {
+        }
+
+    protected:
+        explicit TranslationCanceled(const char* message)
+            : std::runtime_error(message)
+        {
+        }
+    };
+
+    // Shared flag between the thread that requests the cancellation and the
+    // replica thread that is decoding. Setting it is the only synchronization.
+    class CancellationFlag
+    {
+    public:
+        void cancel() { m_canceled.store(true, std::memory_order_relaxed); }
+        bool isCanceled() const { return m_canceled.load(std::memory_order_relaxed); }
+
+        void throwIfCanceled() const
+        {
+            if (isCanceled())
+            {
+                throw TranslationCanceled();
+            }
+        }
+
+    private:
+        std::atomic<bool> m_canceled{ false };
+    };
+
+    // Logits processors run once per decoding step in both BeamSearch::search and
+    // GreedySearch::search, before the next tokens are selected. Throwing from here
+    // aborts the search loop, so the replica is released within one step instead of
+    // finishing a hypothesis nobody is waiting for anymore.
+    class CancellationCheck : public ctranslate2::LogitsProcessor
+    {
+    public:
+        explicit CancellationCheck(std::shared_ptr<const CancellationFlag> flag);
+
+        bool apply_first() const override { return true; }
+
+        void apply(ctranslate2::dim_t step,
+                   ctranslate2::StorageView& logits,
+                   ctranslate2::DisableTokens& disable_tokens,
+                   const ctranslate2::StorageView& sequences,
+                   const std::vector<ctranslate2::dim_t>& batch_offset,
+                   const std::vector<std::vector<size_t>>* prefix) override;
+
+    private:
+        const std::shared_ptr<const CancellationFlag> m_flag;
+    };
+
+}
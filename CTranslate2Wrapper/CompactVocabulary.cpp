@@ -0,0 +1,420 @@
+#include "CompactVocabulary.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		constexpr char magic[8] = { 'C', 'T', '2', 'V', 'O', 'C', 'A', 'B' };
+		constexpr uint32_t formatVersion = 1;
+		constexpr uint32_t textSafeFlag = 1;
+		// Average number of keys per hash bucket.
+		constexpr size_t keysPerBucket = 3;
+
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t tokenCount;
+			uint32_t keyCount;
+			uint32_t bucketCount;
+			uint32_t flags;
+			uint32_t reserved;
+			uint64_t sourceSize;
+			int64_t sourceTime;
+			uint64_t stringBytes;
+		};
+
+		uint64_t fnv1a(std::string_view text)
+		{
+			uint64_t hash = 0xcbf29ce484222325ull;
+			for (const char c : text)
+			{
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 0x100000001b3ull;
+			}
+			return hash;
+		}
+
+		// splitmix64 finalizer: spreads the displaced hash over all bits before the modulo.
+		uint64_t mix(uint64_t value)
+		{
+			value ^= value >> 30;
+			value *= 0xbf58476d1ce4e5b9ull;
+			value ^= value >> 27;
+			value *= 0x94d049bb133111ebull;
+			value ^= value >> 31;
+			return value;
+		}
+
+		size_t slotFor(uint64_t hash, uint32_t displacement, size_t keyCount)
+		{
+			return static_cast<size_t>(mix(hash ^ (displacement * 0x9e3779b97f4a7c15ull)) % keyCount);
+		}
+
+		bool allTextSafe(const std::vector<std::string>& tokens)
+		{
+			return std::none_of(tokens.begin(), tokens.end(), [](const std::string& token)
+				{
+					return token.empty() || token.find_first_of("\r\n") != std::string::npos;
+				});
+		}
+
+		template <typename T>
+		void append(std::string& bytes, const T* values, size_t count)
+		{
+			bytes.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+		}
+
+		struct SourceStamp
+		{
+			uint64_t size = 0;
+			int64_t time = 0;
+		};
+
+		std::optional<SourceStamp> stampOf(const std::filesystem::path& path)
+		{
+			std::error_code error;
+			const uintmax_t size = std::filesystem::file_size(path, error);
+			if (error)
+			{
+				return std::nullopt;
+			}
+			const auto time = std::filesystem::last_write_time(path, error);
+			if (error)
+			{
+				return std::nullopt;
+			}
+			return SourceStamp{ static_cast<uint64_t>(size), static_cast<int64_t>(time.time_since_epoch().count()) };
+		}
+
+		// Next to the JSON first, then a per-path file in the temporary directory.
+		std::vector<std::filesystem::path> candidatePaths(const std::filesystem::path& jsonPath)
+		{
+			std::vector<std::filesystem::path> paths;
+			std::filesystem::path besideJson = jsonPath;
+			besideJson.replace_extension(CompactVocabulary::extension);
+			paths.push_back(besideJson);
+
+			std::error_code error;
+			const std::filesystem::path temporary = std::filesystem::temp_directory_path(error);
+			if (!error)
+			{
+				const std::string absolute = std::filesystem::absolute(jsonPath, error).u8string();
+				char name[32];
+				std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fnv1a(absolute)));
+				paths.push_back(temporary / "ct2palette" / (std::string(name) + CompactVocabulary::extension));
+			}
+			return paths;
+		}
+
+		// Best effort: a read-only location is not an error, the next candidate is tried.
+		bool tryWrite(const std::filesystem::path& path, const std::string& bytes)
+		{
+			std::error_code error;
+			std::filesystem::create_directories(path.parent_path(), error);
+
+			// Another process may be compiling the same vocabulary; never share the temporary file.
+			std::filesystem::path temporaryPath = path;
+			temporaryPath += ".tmp" + std::to_string(std::random_device()());
+			{
+				std::ofstream file(temporaryPath, std::ios::binary);
+				if (!file || !file.write(bytes.data(), static_cast<std::streamsize>(bytes.size())) || !file.flush())
+				{
+					file.close();
+					std::filesystem::remove(temporaryPath, error);
+					return false;
+				}
+			}
+			std::filesystem::rename(temporaryPath, path, error);
+			if (error)
+			{
+				std::filesystem::remove(temporaryPath, error);
+				return false;
+			}
+			return true;
+		}
+	}
+
+	std::string CompactVocabulary::compile(const std::vector<std::string>& tokens, uint64_t sourceSize, int64_t sourceTime)
+	{
+		if (tokens.size() >= std::numeric_limits<uint32_t>::max())
+		{
+			throw std::invalid_argument("The vocabulary is too large to compile.");
+		}
+
+		// 1. Keys are the distinct tokens; a duplicate keeps the first id, like ctranslate2::Vocabulary.
+		std::vector<uint32_t> keys;
+		std::vector<uint64_t> hashes;
+		{
+			std::unordered_map<std::string_view, uint32_t> seen;
+			std::unordered_map<uint64_t, uint32_t> hashOwners;
+			for (uint32_t id = 0; id < tokens.size(); ++id)
+			{
+				if (!seen.emplace(tokens[id], id).second)
+				{
+					continue;
+				}
+				const uint64_t hash = fnv1a(tokens[id]);
+				if (!hashOwners.emplace(hash, id).second)
+				{
+					throw std::runtime_error("Hash collision between vocabulary tokens '" + tokens[hashOwners[hash]] + "' and '" + tokens[id] + "'.");
+				}
+				keys.push_back(id);
+				hashes.push_back(hash);
+			}
+		}
+
+		// 2. Hash and displace: place the fullest buckets first, each with the first
+		//    displacement that sends all its keys to free, distinct slots.
+		const size_t keyCount = keys.size();
+		const size_t bucketCount = std::max<size_t>(1, keyCount / keysPerBucket);
+		std::vector<std::vector<uint32_t>> buckets(bucketCount);
+		for (uint32_t key = 0; key < keyCount; ++key)
+		{
+			buckets[hashes[key] % bucketCount].push_back(key);
+		}
+		std::vector<uint32_t> order(bucketCount);
+		for (uint32_t bucket = 0; bucket < bucketCount; ++bucket)
+		{
+			order[bucket] = bucket;
+		}
+		std::stable_sort(order.begin(), order.end(),
+			[&buckets](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+		std::vector<uint32_t> displacements(bucketCount, 0);
+		std::vector<uint32_t> slots(keyCount, 0);
+		std::vector<bool> taken(keyCount, false);
+		std::vector<size_t> placed;
+		for (const uint32_t bucket : order)
+		{
+			const std::vector<uint32_t>& members = buckets[bucket];
+			if (members.empty())
+			{
+				break;
+			}
+
+			for (uint32_t displacement = 0;; ++displacement)
+			{
+				if (displacement == std::numeric_limits<uint32_t>::max())
+				{
+					throw std::runtime_error("Failed to build the perfect hash of the vocabulary.");
+				}
+
+				placed.clear();
+				bool fits = true;
+				for (const uint32_t key : members)
+				{
+					const size_t slot = slotFor(hashes[key], displacement, keyCount);
+					if (taken[slot] || std::find(placed.begin(), placed.end(), slot) != placed.end())
+					{
+						fits = false;
+						break;
+					}
+					placed.push_back(slot);
+				}
+				if (!fits)
+				{
+					continue;
+				}
+
+				displacements[bucket] = displacement;
+				for (size_t i = 0; i < members.size(); ++i)
+				{
+					taken[placed[i]] = true;
+					slots[placed[i]] = keys[members[i]];
+				}
+				break;
+			}
+		}
+
+		// 3. Serialize.
+		std::vector<uint32_t> offsets;
+		offsets.reserve(tokens.size() + 1);
+		uint64_t stringBytes = 0;
+		for (const std::string& token : tokens)
+		{
+			offsets.push_back(static_cast<uint32_t>(stringBytes));
+			stringBytes += token.size();
+		}
+		offsets.push_back(static_cast<uint32_t>(stringBytes));
+		if (stringBytes >= std::numeric_limits<uint32_t>::max())
+		{
+			throw std::invalid_argument("The vocabulary is too large to compile.");
+		}
+
+		Header header{};
+		std::memcpy(header.magic, magic, sizeof(magic));
+		header.version = formatVersion;
+		header.tokenCount = static_cast<uint32_t>(tokens.size());
+		header.keyCount = static_cast<uint32_t>(keyCount);
+		header.bucketCount = static_cast<uint32_t>(bucketCount);
+		header.flags = allTextSafe(tokens) ? textSafeFlag : 0;
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+		header.stringBytes = stringBytes;
+
+		std::string bytes;
+		bytes.reserve(sizeof(Header) + (bucketCount + keyCount + offsets.size()) * sizeof(uint32_t) + stringBytes);
+		append(bytes, &header, 1);
+		append(bytes, displacements.data(), displacements.size());
+		append(bytes, slots.data(), slots.size());
+		append(bytes, offsets.data(), offsets.size());
+		for (const std::string& token : tokens)
+		{
+			bytes += token;
+		}
+		return bytes;
+	}
+
+	std::shared_ptr<const CompactVocabulary> CompactVocabulary::fromBytes(std::shared_ptr<const void> owner,
+	                                                                      const char* data,
+	                                                                      size_t size,
+	                                                                      uint64_t sourceSize,
+	                                                                      int64_t sourceTime)
+	{
+		if (size < sizeof(Header))
+		{
+			return nullptr;
+		}
+		Header header;
+		std::memcpy(&header, data, sizeof(Header));
+		if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != formatVersion
+			|| header.sourceSize != sourceSize || header.sourceTime != sourceTime
+			|| header.keyCount > header.tokenCount || (header.keyCount > 0 && header.bucketCount == 0))
+		{
+			return nullptr;
+		}
+
+		const uint64_t tables = (uint64_t(header.bucketCount) + header.keyCount + header.tokenCount + 1) * sizeof(uint32_t);
+		if (size != sizeof(Header) + tables + header.stringBytes)
+		{
+			return nullptr;
+		}
+
+		std::shared_ptr<CompactVocabulary> vocabulary(new CompactVocabulary());
+		vocabulary->m_owner = std::move(owner);
+		vocabulary->m_tokenCount = header.tokenCount;
+		vocabulary->m_bucketCount = header.bucketCount;
+		vocabulary->m_displacements = reinterpret_cast<const uint32_t*>(data + sizeof(Header));
+		vocabulary->m_slots = vocabulary->m_displacements + header.bucketCount;
+		vocabulary->m_offsets = vocabulary->m_slots + header.keyCount;
+		vocabulary->m_strings = reinterpret_cast<const char*>(vocabulary->m_offsets + header.tokenCount + 1);
+		vocabulary->m_textSafe = (header.flags & textSafeFlag) != 0;
+		vocabulary->m_keyCount = header.keyCount;
+
+		// A truncated or damaged file must not send a lookup out of the mapping: every
+		// slot names a token, and the offsets run from 0 to the end of the strings.
+		const uint32_t* slots = vocabulary->m_slots;
+		if (std::any_of(slots, slots + header.keyCount, [&header](uint32_t id) { return id >= header.tokenCount; }))
+		{
+			return nullptr;
+		}
+		const uint32_t* offsets = vocabulary->m_offsets;
+		if (offsets[0] != 0 || offsets[header.tokenCount] != header.stringBytes
+			|| std::adjacent_find(offsets, offsets + header.tokenCount + 1, std::greater<uint32_t>()) != offsets + header.tokenCount + 1)
+		{
+			return nullptr;
+		}
+		return vocabulary;
+	}
+
+	std::shared_ptr<const CompactVocabulary> CompactVocabulary::forJson(const std::string& jsonPath)
+	{
+		const std::filesystem::path path = std::filesystem::u8path(jsonPath);
+		const std::optional<SourceStamp> stamp = stampOf(path);
+		if (!stamp)
+		{
+			return nullptr;
+		}
+
+		// 1. An up-to-date compiled file: map it.
+		const std::vector<std::filesystem::path> candidates = candidatePaths(path);
+		for (const std::filesystem::path& candidate : candidates)
+		{
+			std::shared_ptr<const MappedFile> file;
+			try
+			{
+				file = MappedFile::open(candidate.u8string());
+			}
+			catch (const std::exception&)
+			{
+				continue;
+			}
+			if (file)
+			{
+				const char* data = file->data();
+				const size_t size = file->size();
+				if (auto vocabulary = fromBytes(std::move(file), data, size, stamp->size, stamp->time))
+				{
+					return vocabulary;
+				}
+			}
+		}
+
+		// 2. Compile it from the JSON once and keep it for the next load.
+		std::ifstream jsonFile(path);
+		if (!jsonFile)
+		{
+			return nullptr;
+		}
+		const std::vector<std::string> tokens = nlohmann::json::parse(jsonFile).get<std::vector<std::string>>();
+		auto bytes = std::make_shared<const std::string>(compile(tokens, stamp->size, stamp->time));
+		for (const std::filesystem::path& candidate : candidates)
+		{
+			if (tryWrite(candidate, *bytes))
+			{
+				break;
+			}
+		}
+
+		const char* data = bytes->data();
+		const size_t size = bytes->size();
+		return fromBytes(std::move(bytes), data, size, stamp->size, stamp->time);
+	}
+
+	std::string_view CompactVocabulary::token(size_t id) const
+	{
+		if (id >= m_tokenCount)
+		{
+			throw std::out_of_range("Vocabulary id " + std::to_string(id) + " is out of range.");
+		}
+		return std::string_view(m_strings + m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+	}
+
+	size_t CompactVocabulary::find(std::string_view token) const
+	{
+		if (m_keyCount == 0)
+		{
+			return npos;
+		}
+		const uint64_t hash = fnv1a(token);
+		const uint32_t displacement = m_displacements[hash % m_bucketCount];
+		const size_t id = m_slots[slotFor(hash, displacement, m_keyCount)];
+		return this->token(id) == token ? id : npos;
+	}
+
+	std::string CompactVocabulary::toText() const
+	{
+		std::string text;
+		text.reserve(m_offsets[m_tokenCount] + m_tokenCount);
+		for (size_t id = 0; id < m_tokenCount; ++id)
+		{
+			text += token(id);
+			text += '\n';
+		}
+		return text;
+	}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MmapModelReader.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // Precompiled form of a CTranslate2 vocabulary JSON (shared_vocabulary.json, ...),
+    // stored next to it as <name>.ct2vocab and read through a memory mapping.
+    //
+    // Lookups go through a minimal perfect hash (hash and displace): one hash of the
+    // string_view, one displacement read, one string compare. Nothing is parsed or
+    // allocated at load time, unlike ctranslate2::Vocabulary, which parses the JSON and
+    // fills an unordered_map<std::string, size_t>.
+    //
+    // Layout, all integers little endian:
+    //   Header
+    //   uint32 displacements[bucketCount]
+    //   uint32 slots[tokenCount]          slot -> token id
+    //   uint32 offsets[tokenCount + 1]    token id -> offset in the string blob
+    //   char   strings[stringBytes]
+    class CompactVocabulary
+    {
+    public:
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr const char* extension = ".ct2vocab";
+
+        // Returns the compiled vocabulary of a JSON vocabulary file. A missing or stale
+        // <name>.ct2vocab is compiled first, next to the JSON or, if that directory is
+        // read-only (packaged app), in the temporary directory. Returns nullptr if the
+        // JSON does not exist.
+        static std::shared_ptr<const CompactVocabulary> forJson(const std::string& jsonPath);
+
+        // Compiles tokens into the binary format. sourceSize and sourceTime identify the
+        // JSON it was compiled from, so a changed JSON is detected.
+        static std::string compile(const std::vector<std::string>& tokens, uint64_t sourceSize, int64_t sourceTime);
+
+        size_t size() const { return m_tokenCount; }
+        std::string_view token(size_t id) const;
+        // Id of token, or npos if it is not in the vocabulary.
+        size_t find(std::string_view token) const;
+
+        // True if ctranslate2::Vocabulary::from_text_file reads toText() back to the
+        // same tokens: no token is empty or contains a line break.
+        bool isTextSafe() const { return m_textSafe; }
+        // One token per line, in id order.
+        std::string toText() const;
+
+    private:
+        CompactVocabulary() = default;
+
+        // Validates the header against the JSON it should have been compiled from, and
+        // the tables against the size of the data; returns nullptr when either fails.
+        static std::shared_ptr<const CompactVocabulary> fromBytes(std::shared_ptr<const void> owner,
+                                                                  const char* data,
+                                                                  size_t size,
+                                                                  uint64_t sourceSize,
+                                                                  int64_t sourceTime);
+
+        std::shared_ptr<const void> m_owner;
+        size_t m_tokenCount = 0;
+        // Distinct tokens, i.e. slots of the perfect hash.
+        size_t m_keyCount = 0;
+        size_t m_bucketCount = 0;
+        const uint32_t* m_displacements = nullptr;
+        const uint32_t* m_slots = nullptr;
+        const uint32_t* m_offsets = nullptr;
+        const char* m_strings = nullptr;
+        bool m_textSafe = false;
+    };
+
+}
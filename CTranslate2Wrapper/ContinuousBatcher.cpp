@@ -0,0 +1,271 @@
+#include "ContinuousBatcher.h"
+
+#include "ReplicaRunner.h"
+
+#include <algorithm>
+
+namespace CTranslate2Wrapper::Native {
+
+	ContinuousBatcher::ContinuousBatcher(RequestScheduler& scheduler, size_t maxLoops, size_t maxRows)
+		: m_scheduler(scheduler)
+		, m_maxLoops(std::max<size_t>(maxLoops, 1))
+		, m_maxRows(std::max<size_t>(maxRows, 1))
+	{
+	}
+
+	std::future<std::vector<size_t>> ContinuousBatcher::submit(std::vector<size_t> sourceIds,
+	                                                          ctranslate2::DecodingOptions options,
+	                                                          std::shared_ptr<const CancellationFlag> cancellation)
+	{
+		auto sequence = std::make_unique<Sequence>();
+		sequence->sourceIds = std::move(sourceIds);
+		sequence->options = std::move(options);
+		sequence->cancellation = std::move(cancellation);
+		std::future<std::vector<size_t>> future = sequence->promise.get_future();
+		m_requests.fetch_add(1, std::memory_order_relaxed);
+
+		bool post = false;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pending.push_back(std::move(sequence));
+			// A new loop while a replica has none and the loops already starting do not
+			// cover the queue.
+			if (m_loops < m_maxLoops && m_pending.size() > m_starting)
+			{
+				++m_loops;
+				++m_starting;
+				post = true;
+			}
+		}
+		if (post)
+		{
+			postLoop();
+		}
+		return future;
+	}
+
+	void ContinuousBatcher::postLoop()
+	{
+		// The future is not needed: every sequence reports through its own promise.
+		m_scheduler.post<bool>(RequestClass::Interactive, [this](RequestScheduler::Replica& replica)
+			{
+				runLoop(replica);
+				return true;
+			});
+	}
+
+	std::vector<std::unique_ptr<ContinuousBatcher::Sequence>> ContinuousBatcher::admit(size_t count, bool idle, bool& starting, bool& leave)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (starting)
+		{
+			// An even share of the queue, so a burst is spread over the loops started for it.
+			count = std::min(count, (m_pending.size() + m_starting - 1) / m_starting);
+			--m_starting;
+			starting = false;
+		}
+		else if (!idle && m_starting > 0)
+		{
+			// Another cohort would slow every row of this loop; the loops starting on
+			// other replicas take the queue.
+			count = 0;
+		}
+
+		std::vector<std::unique_ptr<Sequence>> admitted;
+		while (admitted.size() < count && !m_pending.empty())
+		{
+			admitted.push_back(std::move(m_pending.front()));
+			m_pending.pop_front();
+		}
+		leave = idle && admitted.empty();
+		if (leave)
+		{
+			--m_loops;
+		}
+		return admitted;
+	}
+
+	void ContinuousBatcher::runLoop(RequestScheduler::Replica& replica)
+	{
+		struct Cohort
+		{
+			ctranslate2::layers::DecoderState state;
+			size_t step = 0;
+			std::vector<std::unique_ptr<Sequence>> rows;
+		};
+
+		EncoderDecoderRunner runner(replica);
+		const size_t vocabularySize = runner.model().get_target_vocabulary().size();
+		std::vector<Cohort> cohorts;
+		size_t rows = 0;
+		bool starting = true;
+
+		// Hands a sequence back and frees its slot.
+		const auto finish = [&rows](Sequence& sequence, std::exception_ptr error)
+		{
+			if (error)
+			{
+				sequence.promise.set_exception(error);
+			}
+			else
+			{
+				sequence.promise.set_value(std::move(sequence.ids));
+			}
+			--rows;
+		};
+
+		for (;;)
+		{
+			// 1. Admit the requests queued since the last iteration as a new cohort.
+			bool leave = false;
+			std::vector<std::unique_ptr<Sequence>> admitted = admit(m_maxRows - rows, cohorts.empty(), starting, leave);
+			if (leave)
+			{
+				return;
+			}
+			rows += admitted.size();
+
+			std::vector<std::unique_ptr<Sequence>> live;
+			for (auto& sequence : admitted)
+			{
+				if (sequence->cancellation && sequence->cancellation->isCanceled())
+				{
+					finish(*sequence, std::make_exception_ptr(TranslationCanceled()));
+					continue;
+				}
+				live.push_back(std::move(sequence));
+			}
+			if (!live.empty())
+			{
+				std::vector<std::vector<size_t>> sourceIds;
+				sourceIds.reserve(live.size());
+				for (const auto& sequence : live)
+				{
+					sourceIds.push_back(sequence->sourceIds);
+				}
+				try
+				{
+					cohorts.push_back({ runner.encode(sourceIds), 0, std::move(live) });
+				}
+				catch (...)
+				{
+					for (auto& sequence : live)
+					{
+						finish(*sequence, std::current_exception());
+					}
+				}
+			}
+
+			// 2. One step for every cohort; finished and canceled rows leave at once.
+			for (Cohort& cohort : cohorts)
+			{
+				try
+				{
+					std::vector<size_t> keep;
+					std::vector<size_t> inputIds;
+					inputIds.reserve(cohort.rows.size());
+					for (const auto& sequence : cohort.rows)
+					{
+						inputIds.push_back(sequence->ids.empty() ? runner.startId() : sequence->ids.back());
+					}
+					const ctranslate2::StorageView logits = runner.step(cohort.state, cohort.step, inputIds);
+					const size_t stride = static_cast<size_t>(logits.dim(-1));
+					const float* data = logits.data<float>();
+					m_steps.fetch_add(1, std::memory_order_relaxed);
+					m_rows.fetch_add(cohort.rows.size(), std::memory_order_relaxed);
+
+					for (size_t row = 0; row < cohort.rows.size(); ++row)
+					{
+						Sequence& sequence = *cohort.rows[row];
+						if (sequence.cancellation && sequence.cancellation->isCanceled())
+						{
+							finish(sequence, std::make_exception_ptr(TranslationCanceled()));
+							cohort.rows[row].reset();
+							continue;
+						}
+
+						const ctranslate2::DecodingOptions& options = sequence.options;
+						const size_t position = sequence.ids.size();
+						const size_t id = selectGreedyToken(data + row * stride, std::min(vocabularySize, stride),
+						                                    sequence.ids, position, options, runner.endId());
+						const bool ended = id == runner.endId();
+						const bool last = ended || position + 1 >= options.max_length;
+						if (!ended || options.include_eos_in_hypotheses)
+						{
+							sequence.ids.push_back(id);
+						}
+
+						bool stop = false;
+						if (options.callback && (!ended || options.include_eos_in_hypotheses))
+						{
+							ctranslate2::DecodingStepResult result;
+							result.step = position;
+							result.batch_id = 0;
+							result.token_id = id;
+							result.hypothesis_id = 0;
+							result.is_last = last;
+							stop = options.callback(std::move(result));
+						}
+
+						if (last || stop)
+						{
+							finish(sequence, nullptr);
+							cohort.rows[row].reset();
+							continue;
+						}
+						keep.push_back(row);
+					}
+
+					if (keep.size() < cohort.rows.size())
+					{
+						std::vector<std::unique_ptr<Sequence>> kept;
+						kept.reserve(keep.size());
+						for (const size_t row : keep)
+						{
+							kept.push_back(std::move(cohort.rows[row]));
+						}
+						cohort.rows = std::move(kept);
+						if (!cohort.rows.empty())
+						{
+							runner.keepRows(cohort.state, keep);
+						}
+					}
+				}
+				catch (...)
+				{
+					// The cohort's state cannot be trusted anymore; fail its remaining rows.
+					for (auto& sequence : cohort.rows)
+					{
+						if (sequence)
+						{
+							finish(*sequence, std::current_exception());
+						}
+					}
+					cohort.rows.clear();
+					continue;
+				}
+				++cohort.step;
+			}
+
+			cohorts.erase(std::remove_if(cohorts.begin(), cohorts.end(),
+				[](const Cohort& cohort) { return cohort.rows.empty(); }), cohorts.end());
+		}
+	}
+
+	ContinuousBatchingStatistics ContinuousBatcher::statistics() const
+	{
+		ContinuousBatchingStatistics statistics;
+		statistics.requests = m_requests.load(std::memory_order_relaxed);
+		statistics.steps = m_steps.load(std::memory_order_relaxed);
+		statistics.rows = m_rows.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	void ContinuousBatcher::resetStatistics()
+	{
+		m_requests.store(0, std::memory_order_relaxed);
+		m_steps.store(0, std::memory_order_relaxed);
+		m_rows.store(0, std::memory_order_relaxed);
+	}
+
+}
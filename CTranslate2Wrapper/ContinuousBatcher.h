@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+
+#include "Cancellation.h"
+#include "RequestScheduler.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    struct ContinuousBatchingStatistics
+    {
+        size_t requests = 0;
+        // Decoder calls, one per cohort per iteration.
+        size_t steps = 0;
+        // Rows decoded over all steps; rows / steps is the average batch.
+        size_t rows = 0;
+    };
+
+    // Greedy decoding loop shared by the concurrent requests of one translator.
+    //
+    // ctranslate2::decode runs a batch until its longest hypothesis is done, and requests
+    // that arrive meanwhile wait for the next one. Here a loop job holds a replica and
+    // advances every sequence it owns by one token per iteration. Between iterations it
+    // admits the requests queued since the last one (their encoder pass runs right there
+    // and gives them a decoder state slot) and hands back every sequence that finished,
+    // whose rows leave the state at once.
+    //
+    // The decoder of a CTranslate2 replica takes one step position per call, so sequences
+    // admitted together form a cohort that is stepped in one decoder call; an iteration
+    // makes one call per live cohort. Tokens are picked like greedy search picks them
+    // (see selectGreedyToken), so the output matches decode() with beam_size 1.
+    //
+    // While fewer loops run than there are replicas, a request starts a loop on another
+    // replica instead of joining a busy one, and a burst is shared out between the loops
+    // started for it. Once every replica runs a loop, queued requests join them.
+    //
+    // Cohorts are never merged: the step call has no per-row position or cache mask, so
+    // padding one cohort's cache to another's step would change its output. Every live
+    // cohort costs a decoder call per iteration, and requests that arrive one by one on
+    // busy loops are decoded more slowly than on their own. With more staggered requests
+    // than replicas this is slower than plain decoding, so the mode is off by default.
+    class ContinuousBatcher
+    {
+    public:
+        // Rows one loop decodes at most; further requests wait for a slot or a new loop.
+        static constexpr size_t defaultMaxRows = 16;
+
+        // The batcher must outlive the pool's worker threads, like the scheduler.
+        ContinuousBatcher(RequestScheduler& scheduler, size_t maxLoops, size_t maxRows = defaultMaxRows);
+
+        ContinuousBatcher(const ContinuousBatcher&) = delete;
+        ContinuousBatcher& operator=(const ContinuousBatcher&) = delete;
+
+        // Decodes one example of model source ids (end token included). The future yields
+        // the target ids without the start token. Of the options, max_length,
+        // min_length, repetition_penalty, disable_ids, disable_ids_begin,
+        // include_eos_in_hypotheses and callback are used; beam search, sampling and
+        // logits processors are not. A canceled request leaves the loop at the next
+        // iteration with TranslationCanceled.
+        std::future<std::vector<size_t>> submit(std::vector<size_t> sourceIds,
+                                                ctranslate2::DecodingOptions options,
+                                                std::shared_ptr<const CancellationFlag> cancellation = nullptr);
+
+        ContinuousBatchingStatistics statistics() const;
+        void resetStatistics();
+
+    private:
+        struct Sequence
+        {
+            std::vector<size_t> sourceIds;
+            ctranslate2::DecodingOptions options;
+            std::shared_ptr<const CancellationFlag> cancellation;
+            std::promise<std::vector<size_t>> promise;
+            std::vector<size_t> ids;
+        };
+
+        // Body of a loop job: runs until no sequence is left to decode or admit.
+        void runLoop(RequestScheduler::Replica& replica);
+        // Takes up to count queued sequences, or gives the loop up when there are none
+        // and it has nothing left to decode. starting is set on a loop's first call and
+        // cleared by it. Locked inside.
+        std::vector<std::unique_ptr<Sequence>> admit(size_t count, bool idle, bool& starting, bool& leave);
+        void postLoop();
+
+        RequestScheduler& m_scheduler;
+        const size_t m_maxLoops;
+        const size_t m_maxRows;
+
+        std::mutex m_mutex;
+        std::deque<std::unique_ptr<Sequence>> m_pending;
+        size_t m_loops = 0;
+        // Loops posted that have not admitted their first requests yet.
+        size_t m_starting = 0;
+
+        std::atomic<size_t> m_requests{ 0 };
+        std::atomic<size_t> m_steps{ 0 };
+        std::atomic<size_t> m_rows{ 0 };
+    };
+
+}
@@ -0,0 +1,363 @@
+#include "LanguageIdentifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "LanguageProfiles.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define LANGUAGE_IDENTIFIER_SSE2 1
+#endif
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		enum Script
+		{
+			Latin,
+			Han,
+			Kana,
+			Hangul,
+			Cyrillic,
+			Greek,
+			Arabic,
+			Hebrew,
+			Thai,
+			Devanagari,
+			ScriptCount
+		};
+
+		struct ScriptRange
+		{
+			char32_t first;
+			char32_t last;
+			Script script;
+		};
+
+		// Letter ranges of the scripts we route on, sorted by first code point.
+		constexpr ScriptRange scriptRanges[] = {
+			{ 0x00C0, 0x024F, Latin },      // Latin-1 Supplement letters, Latin Extended-A/B
+			{ 0x0370, 0x03FF, Greek },
+			{ 0x0400, 0x04FF, Cyrillic },
+			{ 0x0590, 0x05FF, Hebrew },
+			{ 0x0600, 0x06FF, Arabic },
+			{ 0x0750, 0x077F, Arabic },
+			{ 0x0900, 0x097F, Devanagari },
+			{ 0x0E00, 0x0E7F, Thai },
+			{ 0x1100, 0x11FF, Hangul },     // Jamo
+			{ 0x1E00, 0x1EFF, Latin },      // Latin Extended Additional (Vietnamese)
+			{ 0x3040, 0x30FF, Kana },       // Hiragana, Katakana
+			{ 0x3130, 0x318F, Hangul },     // Compatibility Jamo
+			{ 0x31F0, 0x31FF, Kana },
+			{ 0x3400, 0x4DBF, Han },        // Extension A
+			{ 0x4E00, 0x9FFF, Han },
+			{ 0xAC00, 0xD7AF, Hangul },     // Syllables
+			{ 0xF900, 0xFAFF, Han },        // Compatibility Ideographs
+			{ 0xFF21, 0xFF3A, Latin },      // Full-width A-Z
+			{ 0xFF41, 0xFF5A, Latin },      // Full-width a-z
+			{ 0xFF66, 0xFF9F, Kana },       // Half-width Katakana
+			{ 0x20000, 0x2FFFF, Han },      // Extensions B and later
+		};
+
+		// Languages of scripts that are (for routing purposes) used by one language only.
+		constexpr const char* scriptLanguages[ScriptCount] = {
+			"en", "zh", "ja", "ko", "ru", "el", "ar", "he", "th", "hi"
+		};
+
+		// Upper bound on the Latin text scored with trigrams, to keep the cost bounded.
+		constexpr size_t maxTrigramText = 1024;
+		// Latin text with fewer words or letters is too short to tell languages apart.
+		constexpr size_t minLatinWords = 3;
+		constexpr size_t minLatinLetters = 12;
+		// Trigrams of one text are far from independent; the evidence of a longer text is
+		// counted as if it had this many, so a single sentence is not overconfident.
+		constexpr double maxIndependentTrigrams = 8;
+		// Prior log odds of English against any other language: palette input is mostly
+		// English, and the training text (legal prose) is far from everyday English.
+		constexpr double englishPrior = 3.0;
+
+		constexpr size_t englishProfile = []
+		{
+			for (size_t language = 0; language < LanguageProfiles::languageCount; ++language)
+			{
+				const char* code = LanguageProfiles::languages[language];
+				if (code[0] == 'e' && code[1] == 'n' && code[2] == '\0')
+					return language;
+			}
+			return LanguageProfiles::languageCount;
+		}();
+		static_assert(englishProfile < LanguageProfiles::languageCount, "The Latin profiles must include English.");
+
+		constexpr uint32_t packTrigram(unsigned char a, unsigned char b, unsigned char c)
+		{
+			return (uint32_t(a) << 16) | (uint32_t(b) << 8) | uint32_t(c);
+		}
+
+		bool isAsciiLetter(unsigned char c)
+		{
+			return static_cast<unsigned char>((c | 0x20) - 'a') < 26;
+		}
+
+		// Counts the ASCII letters of [text, text + size) until the first non-ASCII byte.
+		// Returns the number of bytes consumed.
+		size_t scanAscii(const unsigned char* text, size_t size, size_t& letters)
+		{
+			size_t i = 0;
+#ifdef LANGUAGE_IDENTIFIER_SSE2
+			// (c | 0x20) - ('a' + 128) lands in [-128, -103] exactly for ASCII letters.
+			const __m128i lowerCase = _mm_set1_epi8(0x20);
+			const __m128i bias = _mm_set1_epi8(static_cast<char>('a' + 128));
+			const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+			for (; i + 16 <= size; i += 16)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+				const int nonAscii = _mm_movemask_epi8(chunk);
+				if (nonAscii != 0)
+				{
+					break;
+				}
+				const __m128i shifted = _mm_sub_epi8(_mm_or_si128(chunk, lowerCase), bias);
+				const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(shifted, limit)));
+				for (unsigned bits = mask; bits != 0; bits &= bits - 1)
+				{
+					++letters;
+				}
+			}
+#endif
+			for (; i < size && text[i] < 0x80; ++i)
+			{
+				if (isAsciiLetter(text[i]))
+				{
+					++letters;
+				}
+			}
+			return i;
+		}
+
+		// Decodes the UTF-8 sequence at text[i], advancing i. Invalid bytes decode as U+FFFD.
+		char32_t decodeUtf8(const unsigned char* text, size_t size, size_t& i)
+		{
+			const unsigned char lead = text[i++];
+			size_t length = 0;
+			char32_t codePoint = 0;
+			if ((lead & 0xE0) == 0xC0) { length = 1; codePoint = lead & 0x1F; }
+			else if ((lead & 0xF0) == 0xE0) { length = 2; codePoint = lead & 0x0F; }
+			else if ((lead & 0xF8) == 0xF0) { length = 3; codePoint = lead & 0x07; }
+			else return 0xFFFD;
+
+			for (size_t k = 0; k < length; ++k)
+			{
+				if (i >= size || (text[i] & 0xC0) != 0x80)
+				{
+					return 0xFFFD;
+				}
+				codePoint = (codePoint << 6) | (text[i++] & 0x3F);
+			}
+			return codePoint;
+		}
+
+		int scriptOf(char32_t codePoint)
+		{
+			const auto range = std::upper_bound(std::begin(scriptRanges), std::end(scriptRanges), codePoint,
+				[](char32_t value, const ScriptRange& r) { return value < r.first; });
+			if (range == std::begin(scriptRanges))
+			{
+				return -1;
+			}
+			const ScriptRange& candidate = *(range - 1);
+			// U+00D7 and U+00F7 (multiplication and division signs) sit inside Latin-1 letters.
+			if (codePoint > candidate.last || codePoint == 0xD7 || codePoint == 0xF7)
+			{
+				return -1;
+			}
+			return candidate.script;
+		}
+
+		// The Latin letters of [text, text + size) as LanguageIdentifier::latinTrigrams
+		// describes them, one byte each: a leading space, words separated by single
+		// spaces, and a trailing space unless the text was cut at maxTrigramText.
+		std::string normalizeLatin(const unsigned char* text, size_t size)
+		{
+			std::string normalized(1, ' ');
+			normalized.reserve(std::min(size, maxTrigramText) + 2);
+			size_t i = 0;
+			while (i < size && normalized.size() < maxTrigramText)
+			{
+				const unsigned char c = text[i];
+				if (c < 0x80)
+				{
+					++i;
+					if (isAsciiLetter(c))
+						normalized.push_back(static_cast<char>(c | 0x20));
+					else if (normalized.back() != ' ')
+						normalized.push_back(' ');
+					continue;
+				}
+
+				char32_t codePoint = decodeUtf8(text, size, i);
+				if (scriptOf(codePoint) != Latin)
+				{
+					if (normalized.back() != ' ')
+						normalized.push_back(' ');
+					continue;
+				}
+				if (codePoint >= 0xFF21)
+				{
+					// Full-width letters are ASCII letters.
+					normalized.push_back(static_cast<char>('a' + (codePoint - 0xFF21) % 0x20));
+					continue;
+				}
+				if (codePoint >= 0xC0 && codePoint <= 0xDE)
+				{
+					codePoint += 0x20;
+				}
+				normalized.push_back(static_cast<char>(codePoint < 0x100 ? codePoint : 0x80));
+			}
+			if (normalized.back() != ' ')
+			{
+				normalized.push_back(' ');
+			}
+			return normalized;
+		}
+
+		// Naive Bayes over the trigrams of the Latin profiles. Short text, or text that
+		// no language explains clearly better than the others, falls back to English.
+		LanguageIdentification identifyLatin(const unsigned char* text, size_t size, float share)
+		{
+			const std::string normalized = normalizeLatin(text, size);
+			const size_t words = static_cast<size_t>(std::count(normalized.begin(), normalized.end(), ' ')) - 1;
+			const size_t letters = normalized.size() - words - 1;
+
+			LanguageIdentification guess;
+			guess.language = LanguageProfiles::languages[englishProfile];
+			guess.confidence = 0.5f * share;
+			if (words < minLatinWords || letters < minLatinLetters)
+			{
+				return guess;
+			}
+
+			std::array<double, LanguageProfiles::languageCount> scores{};
+			size_t scored = 0;
+			for (size_t i = 0; i + 3 <= normalized.size(); ++i)
+			{
+				const uint32_t trigram = packTrigram(normalized[i], normalized[i + 1], normalized[i + 2]);
+				const auto entry = std::lower_bound(std::begin(LanguageProfiles::trigrams), std::end(LanguageProfiles::trigrams), trigram,
+					[](const LanguageProfiles::TrigramWeights& e, uint32_t value) { return e.trigram < value; });
+				if (entry == std::end(LanguageProfiles::trigrams) || entry->trigram != trigram)
+				{
+					continue;
+				}
+				for (size_t language = 0; language < LanguageProfiles::languageCount; ++language)
+				{
+					scores[language] += entry->logProbability[language];
+				}
+				++scored;
+			}
+			if (scored == 0)
+			{
+				return guess;
+			}
+
+			// Posterior of the best language, with the evidence scaled down to at most
+			// maxIndependentTrigrams trigrams.
+			const double scale = std::min(1.0, maxIndependentTrigrams / static_cast<double>(scored));
+			for (double& score : scores)
+			{
+				score *= scale;
+			}
+			scores[englishProfile] += englishPrior;
+			const size_t best = static_cast<size_t>(std::max_element(scores.begin(), scores.end()) - scores.begin());
+			double total = 0;
+			for (const double score : scores)
+			{
+				total += std::exp(score - scores[best]);
+			}
+			const float confidence = share * static_cast<float>(1.0 / total);
+			if (best != englishProfile && confidence < LanguageIdentifier::confidenceThreshold)
+			{
+				return guess;
+			}
+
+			LanguageIdentification result;
+			result.language = LanguageProfiles::languages[best];
+			result.confidence = confidence;
+			return result;
+		}
+	}
+
+	LanguageIdentification LanguageIdentifier::identify(const std::string& utf8Text)
+	{
+		const auto* text = reinterpret_cast<const unsigned char*>(utf8Text.data());
+		const size_t size = utf8Text.size();
+
+		// 1. Count letters per script.
+		std::array<size_t, ScriptCount> letters{};
+		size_t i = 0;
+		while (i < size)
+		{
+			i += scanAscii(text + i, size - i, letters[Latin]);
+			if (i >= size)
+			{
+				break;
+			}
+
+			const char32_t codePoint = decodeUtf8(text, size, i);
+			const int script = scriptOf(codePoint);
+			if (script < 0)
+			{
+				continue;
+			}
+			++letters[script];
+		}
+
+		size_t total = 0;
+		size_t dominant = Latin;
+		for (size_t script = 0; script < ScriptCount; ++script)
+		{
+			total += letters[script];
+			if (letters[script] > letters[dominant])
+				dominant = script;
+		}
+
+		LanguageIdentification result;
+		if (total == 0)
+		{
+			return result;
+		}
+
+		// 2. Scripts that name their language directly. Japanese mixes kanji with kana,
+		//    so any kana next to Han characters makes it Japanese.
+		if (dominant == Han && letters[Kana] > 0)
+		{
+			dominant = Kana;
+		}
+		if (dominant != Latin)
+		{
+			size_t count = letters[dominant];
+			if (dominant == Kana)
+				count += letters[Han];
+			result.language = scriptLanguages[dominant];
+			result.confidence = static_cast<float>(count) / static_cast<float>(total);
+			return result;
+		}
+
+		// 3. Latin script: character trigrams.
+		return identifyLatin(text, size, static_cast<float>(letters[Latin]) / static_cast<float>(total));
+	}
+
+	std::vector<uint32_t> LanguageIdentifier::latinTrigrams(const std::string& utf8Text)
+	{
+		const std::string normalized = normalizeLatin(reinterpret_cast<const unsigned char*>(utf8Text.data()), utf8Text.size());
+		std::vector<uint32_t> trigrams;
+		for (size_t i = 0; i + 3 <= normalized.size(); ++i)
+		{
+			trigrams.push_back(packTrigram(normalized[i], normalized[i + 1], normalized[i + 2]));
+		}
+		return trigrams;
+	}
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CTranslate2Wrapper::Native {
+
+    struct LanguageIdentification
+    {
+        // ISO 639-1 code, or "und" when the text has no letters.
+        const char* language = "und";
+        // 0..1, how strongly the text points at that language.
+        float confidence = 0.0f;
+    };
+
+    // Script and language identification for palette-sized input, meant to run before
+    // any model so input is routed to the right translator, or to none.
+    //
+    // Letters are first counted per Unicode script. Runs of ASCII are skipped 16 bytes at
+    // a time with SSE2; only non-ASCII code points are decoded and looked up in the
+    // script ranges. A script used by a single language decides on its own (Han without
+    // kana is Chinese, Hangul is Korean, ...).
+    //
+    // Latin text is scored against per-language character trigram models trained on
+    // running text (LanguageProfiles.h, built by ct2palette-langid). A few words carry
+    // too little evidence to tell languages apart, so short or ambiguous Latin text is
+    // reported as English with a confidence below confidenceThreshold: English is what
+    // most palette queries are, and the direct en->zh route is the cheapest one.
+    class LanguageIdentifier
+    {
+    public:
+        // Below this confidence an identification is a guess, and callers should keep
+        // their default route.
+        static constexpr float confidenceThreshold = 0.8f;
+
+        static LanguageIdentification identify(const std::string& utf8Text);
+
+        // The features the Latin models are scored on: trigrams of the lower-cased
+        // letters, words separated by a single space and padded with one on each side.
+        // Latin-1 letters are kept as their code point, other Latin letters become 0x80.
+        static std::vector<uint32_t> latinTrigrams(const std::string& utf8Text);
+    };
+
+}
@@ -0,0 +1,3826 @@
+#pragma once
+
+// Generated by ct2palette-langid (Benchmark/ct2palette_langid.cpp) from the corpus in
+// Benchmark/langid, 2000 trigrams per language. Do not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CTranslate2Wrapper::Native::LanguageProfiles {
+
+    constexpr size_t languageCount = 7;
+
+    constexpr const char* languages[languageCount] = { "en", "fr", "de", "es", "it", "pt", "nl" };
+
+    struct TrigramWeights
+    {
+        uint32_t trigram;
+        // Log probability of the trigram in each language; a language that does not
+        // keep the trigram gets the probability of an unseen one.
+        float logProbability[languageCount];
+    };
+
+    // Sorted by trigram, as packed by LanguageIdentifier::latinTrigrams.
+    constexpr TrigramWeights trigrams[] = {
+        { 0x206120, { -6.17f, -6.08f, -9.66f, -5.08f, -6.21f, -4.88f, -9.70f } },
+        { 0x206161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x206162, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x206163, { -6.59f, -6.69f, -8.05f, -6.91f, -8.04f, -6.64f, -8.09f } },
+        { 0x206164, { -8.44f, -9.63f, -9.66f, -7.67f, -6.28f, -8.49f, -9.70f } },
+        { 0x206166, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x206167, { -6.97f, -8.02f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x206169, { -9.54f, -8.02f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x20616B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20616C, { -6.40f, -9.63f, -5.94f, -7.05f, -5.64f, -6.88f, -5.90f } },
+        { 0x20616D, { -7.93f, -8.53f, -9.66f, -7.67f, -8.04f, -7.64f, -9.70f } },
+        { 0x20616E, { -4.51f, -9.63f, -5.81f, -8.01f, -9.65f, -9.59f, -7.14f } },
+        { 0x20616F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x206170, { -8.44f, -7.69f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x206172, { -5.36f, -5.70f, -5.85f, -5.72f, -5.71f, -5.69f, -5.99f } },
+        { 0x206173, { -6.10f, -6.69f, -8.56f, -6.67f, -7.25f, -6.22f, -8.09f } },
+        { 0x206174, { -6.97f, -7.69f, -9.66f, -8.01f, -7.45f, -7.19f, -9.70f } },
+        { 0x206175, { -9.54f, -6.08f, -5.73f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x206176, { -9.54f, -7.69f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x206179, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20617A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x206261, { -7.93f, -8.53f, -8.56f, -7.42f, -8.04f, -8.49f, -8.61f } },
+        { 0x206265, { -5.46f, -9.63f, -5.65f, -9.62f, -9.65f, -8.49f, -5.39f } },
+        { 0x206269, { -8.44f, -8.02f, -8.56f, -9.62f, -8.55f, -9.59f, -7.51f } },
+        { 0x20626F, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206272, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x206275, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x206279, { -6.71f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2062E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206361, { -8.44f, -8.02f, -9.66f, -6.78f, -7.70f, -7.02f, -9.70f } },
+        { 0x206365, { -9.54f, -6.27f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0x206368, { -7.14f, -6.80f, -8.56f, -9.62f, -6.03f, -9.59f, -9.70f } },
+        { 0x206369, { -9.54f, -8.53f, -9.66f, -8.52f, -7.45f, -8.49f, -9.70f } },
+        { 0x20636F, { -5.61f, -5.10f, -9.66f, -4.91f, -5.05f, -4.95f, -8.61f } },
+        { 0x206372, { -7.59f, -7.69f, -9.66f, -7.42f, -7.45f, -7.64f, -9.70f } },
+        { 0x206375, { -9.54f, -8.02f, -9.66f, -6.40f, -7.25f, -7.98f, -9.70f } },
+        { 0x206420, { -9.54f, -6.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206461, { -9.54f, -6.50f, -5.29f, -9.62f, -6.28f, -5.54f, -6.34f } },
+        { 0x206465, { -6.24f, -4.23f, -5.00f, -3.89f, -5.03f, -4.46f, -4.61f } },
+        { 0x206469, { -6.40f, -6.59f, -5.15f, -6.25f, -4.20f, -4.97f, -6.76f } },
+        { 0x20646F, { -9.54f, -7.44f, -9.66f, -8.01f, -7.45f, -5.62f, -6.09f } },
+        { 0x206472, { -9.54f, -5.29f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206475, { -7.93f, -7.07f, -6.71f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x2064E9, { -9.54f, -6.27f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206520, { -9.54f, -9.63f, -9.66f, -7.42f, -5.01f, -4.91f, -9.70f } },
+        { 0x206561, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206562, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206563, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x206564, { -8.44f, -9.63f, -9.66f, -8.01f, -6.94f, -8.49f, -9.70f } },
+        { 0x206565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.29f } },
+        { 0x206566, { -7.93f, -7.44f, -9.66f, -7.67f, -8.04f, -7.64f, -9.70f } },
+        { 0x206567, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x206568, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206569, { -8.44f, -9.63f, -5.55f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x20656C, { -9.54f, -8.02f, -9.66f, -5.41f, -9.65f, -7.98f, -8.09f } },
+        { 0x20656D, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -5.97f, -9.70f } },
+        { 0x20656E, { -6.40f, -5.78f, -8.05f, -5.44f, -8.04f, -6.88f, -4.91f } },
+        { 0x206571, { -6.71f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x206572, { -9.54f, -9.63f, -6.36f, -9.62f, -9.65f, -8.49f, -6.87f } },
+        { 0x206573, { -7.93f, -6.34f, -8.05f, -5.76f, -5.98f, -5.97f, -9.70f } },
+        { 0x206574, { -9.54f, -4.94f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x206575, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206576, { -5.93f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x206578, { -7.93f, -7.69f, -9.66f, -7.67f, -9.65f, -7.39f, -9.70f } },
+        { 0x206661, { -6.97f, -6.92f, -7.46f, -7.42f, -7.25f, -6.75f, -9.70f } },
+        { 0x206665, { -8.44f, -8.02f, -8.05f, -8.52f, -8.55f, -8.49f, -7.51f } },
+        { 0x206669, { -9.54f, -9.63f, -9.66f, -7.67f, -7.45f, -7.64f, -9.70f } },
+        { 0x20666F, { -6.40f, -6.34f, -7.46f, -8.52f, -6.81f, -7.39f, -8.61f } },
+        { 0x206672, { -5.69f, -8.02f, -5.94f, -8.01f, -7.45f, -7.98f, -9.70f } },
+        { 0x206675, { -6.59f, -8.53f, -8.56f, -6.78f, -8.55f, -6.88f, -7.76f } },
+        { 0x2066E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x2066F6, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2066FC, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206761, { -9.54f, -8.53f, -8.56f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x206765, { -7.93f, -9.63f, -5.02f, -8.52f, -8.04f, -8.49f, -5.01f } },
+        { 0x206769, { -9.54f, -9.63f, -8.56f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x20676C, { -9.54f, -9.63f, -6.52f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x20676F, { -8.44f, -9.63f, -8.56f, -9.62f, -8.04f, -9.59f, -7.14f } },
+        { 0x206772, { -7.59f, -8.53f, -6.16f, -8.52f, -9.65f, -8.49f, -6.66f } },
+        { 0x206775, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2067E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206861, { -5.69f, -8.02f, -5.48f, -6.91f, -5.88f, -9.59f, -7.14f } },
+        { 0x206865, { -7.14f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -4.84f } },
+        { 0x206869, { -6.17f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x20686F, { -7.59f, -6.59f, -8.56f, -6.91f, -9.65f, -6.64f, -7.76f } },
+        { 0x206875, { -6.59f, -7.23f, -9.66f, -6.67f, -9.65f, -6.88f, -7.00f } },
+        { 0x2068F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206920, { -9.54f, -9.63f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x206964, { -8.44f, -8.02f, -8.56f, -8.01f, -8.04f, -7.64f, -8.61f } },
+        { 0x206965, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.85f } },
+        { 0x206966, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206967, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -6.75f, -9.70f } },
+        { 0x206968, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20696C, { -9.54f, -6.92f, -9.66f, -9.62f, -5.93f, -9.59f, -9.70f } },
+        { 0x20696D, { -7.34f, -7.07f, -8.05f, -7.67f, -7.45f, -7.39f, -9.70f } },
+        { 0x20696E, { -5.01f, -5.92f, -5.65f, -5.68f, -4.77f, -5.58f, -5.33f } },
+        { 0x206972, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206973, { -6.59f, -9.63f, -6.82f, -9.62f, -8.04f, -9.59f, -7.00f } },
+        { 0x206974, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206A65, { -9.54f, -9.63f, -5.99f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x206A75, { -7.59f, -7.07f, -9.66f, -6.78f, -9.65f, -7.02f, -8.09f } },
+        { 0x206B61, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x206B65, { -8.44f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x206B69, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206B6C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x206B6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x206B72, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x206B75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206BFC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206C20, { -9.54f, -5.56f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x206C61, { -6.40f, -5.00f, -7.46f, -4.77f, -6.09f, -9.59f, -7.31f } },
+        { 0x206C65, { -8.44f, -5.06f, -7.26f, -7.05f, -6.43f, -7.19f, -7.31f } },
+        { 0x206C68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x206C69, { -7.14f, -5.97f, -9.66f, -5.90f, -5.93f, -5.97f, -8.09f } },
+        { 0x206C6F, { -9.54f, -7.23f, -9.66f, -5.76f, -7.45f, -9.59f, -9.70f } },
+        { 0x206C75, { -9.54f, -8.02f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0x206CE4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206CE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206CED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x206D61, { -6.49f, -7.07f, -8.05f, -6.91f, -7.08f, -6.88f, -6.76f } },
+        { 0x206D65, { -6.83f, -7.23f, -6.05f, -7.22f, -7.25f, -6.88f, -5.73f } },
+        { 0x206D69, { -8.44f, -8.53f, -6.71f, -7.22f, -8.04f, -8.49f, -7.51f } },
+        { 0x206D6F, { -8.44f, -7.23f, -9.66f, -7.42f, -7.08f, -7.64f, -9.70f } },
+        { 0x206D75, { -9.54f, -9.63f, -9.66f, -7.42f, -8.55f, -7.02f, -9.70f } },
+        { 0x206DE1, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x206DE4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206DE9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206DEA, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206E61, { -6.17f, -6.14f, -6.36f, -5.72f, -6.51f, -5.69f, -5.81f } },
+        { 0x206E65, { -8.44f, -6.20f, -9.66f, -8.52f, -5.64f, -7.19f, -9.70f } },
+        { 0x206E69, { -9.54f, -7.23f, -6.29f, -7.05f, -9.65f, -6.75f, -6.66f } },
+        { 0x206E6F, { -5.93f, -7.69f, -7.26f, -6.91f, -6.70f, -6.29f, -7.51f } },
+        { 0x206E75, { -9.54f, -6.69f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x206EE3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.88f, -9.70f } },
+        { 0x206EE9, { -9.54f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x206EFA, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x206F20, { -9.54f, -9.63f, -9.66f, -6.00f, -5.84f, -5.44f, -9.70f } },
+        { 0x206F62, { -7.34f, -7.69f, -8.56f, -7.42f, -9.65f, -7.98f, -9.70f } },
+        { 0x206F64, { -9.54f, -9.63f, -5.85f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x206F66, { -4.83f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -5.85f } },
+        { 0x206F67, { -9.54f, -9.63f, -9.66f, -9.62f, -5.84f, -9.59f, -8.61f } },
+        { 0x206F68, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206F6D, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -6.41f } },
+        { 0x206F6E, { -6.24f, -6.92f, -9.66f, -9.62f, -8.55f, -9.59f, -5.73f } },
+        { 0x206F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x206F70, { -7.14f, -7.23f, -9.66f, -7.05f, -7.45f, -7.39f, -5.53f } },
+        { 0x206F72, { -5.65f, -7.44f, -8.56f, -7.42f, -8.04f, -7.64f, -8.09f } },
+        { 0x206F73, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -6.15f, -9.70f } },
+        { 0x206F74, { -6.97f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x206F75, { -8.44f, -5.97f, -9.66f, -9.62f, -9.65f, -5.58f, -9.70f } },
+        { 0x206F76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x206F77, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x206FED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x206FF9, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207061, { -9.54f, -5.74f, -9.66f, -6.18f, -6.60f, -6.29f, -8.61f } },
+        { 0x207065, { -5.98f, -5.63f, -7.71f, -5.81f, -6.03f, -5.51f, -7.76f } },
+        { 0x207066, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207069, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x20706C, { -7.93f, -6.69f, -9.66f, -7.67f, -9.65f, -7.64f, -8.61f } },
+        { 0x20706F, { -7.59f, -6.80f, -8.05f, -5.90f, -6.03f, -5.78f, -7.76f } },
+        { 0x207072, { -5.65f, -5.63f, -8.05f, -5.54f, -5.50f, -5.35f, -8.09f } },
+        { 0x207075, { -7.14f, -7.69f, -9.66f, -7.67f, -7.25f, -8.49f, -9.70f } },
+        { 0x2070E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2070FA, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x207175, { -9.54f, -5.43f, -9.66f, -6.00f, -6.09f, -5.47f, -9.70f } },
+        { 0x207261, { -7.93f, -7.69f, -8.05f, -7.67f, -7.08f, -7.39f, -8.09f } },
+        { 0x207265, { -5.65f, -5.92f, -5.39f, -5.72f, -6.35f, -5.65f, -5.31f } },
+        { 0x207269, { -5.36f, -8.53f, -9.66f, -9.62f, -5.93f, -8.49f, -9.70f } },
+        { 0x207275, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2072E9, { -9.54f, -6.69f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x2072FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207320, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207361, { -9.54f, -5.97f, -9.66f, -8.52f, -7.70f, -8.49f, -8.61f } },
+        { 0x207363, { -9.54f, -9.63f, -6.61f, -9.62f, -7.45f, -9.59f, -8.09f } },
+        { 0x207365, { -6.71f, -6.08f, -5.81f, -5.57f, -6.70f, -5.19f, -9.70f } },
+        { 0x207366, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x207368, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207369, { -9.54f, -8.02f, -6.44f, -7.22f, -6.35f, -8.49f, -9.70f } },
+        { 0x20736B, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20736C, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x20736F, { -6.97f, -5.63f, -6.36f, -6.67f, -6.15f, -6.54f, -8.09f } },
+        { 0x207370, { -7.59f, -9.63f, -8.56f, -9.62f, -7.70f, -9.59f, -8.61f } },
+        { 0x207374, { -6.59f, -8.53f, -5.99f, -9.62f, -6.35f, -9.59f, -6.04f } },
+        { 0x207375, { -6.97f, -7.44f, -8.05f, -5.68f, -6.09f, -5.87f, -8.61f } },
+        { 0x207376, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x2073E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x2073F3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x2073FB, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207461, { -9.54f, -8.02f, -8.05f, -6.78f, -7.45f, -7.19f, -8.61f } },
+        { 0x207465, { -7.34f, -6.80f, -9.66f, -7.22f, -7.45f, -5.92f, -5.31f } },
+        { 0x207468, { -4.31f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207469, { -7.93f, -9.63f, -9.66f, -5.85f, -8.04f, -8.49f, -7.76f } },
+        { 0x20746F, { -4.87f, -5.43f, -9.66f, -5.61f, -8.55f, -5.58f, -6.66f } },
+        { 0x207472, { -6.97f, -7.69f, -8.56f, -7.22f, -7.25f, -7.64f, -8.61f } },
+        { 0x207475, { -9.54f, -8.53f, -9.66f, -9.62f, -6.43f, -8.49f, -8.61f } },
+        { 0x207479, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x2074EA, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x207520, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x207564, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x207567, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x207569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x20756C, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x20756D, { -9.54f, -9.63f, -9.66f, -9.62f, -6.60f, -6.54f, -9.70f } },
+        { 0x20756E, { -6.32f, -5.63f, -4.65f, -5.85f, -5.75f, -6.88f, -8.61f } },
+        { 0x20756F, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x207570, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207661, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -4.88f } },
+        { 0x207665, { -9.54f, -9.63f, -5.51f, -8.52f, -8.04f, -9.59f, -5.59f } },
+        { 0x207669, { -7.93f, -7.23f, -9.66f, -7.42f, -7.25f, -7.19f, -9.70f } },
+        { 0x20766F, { -9.54f, -9.63f, -6.36f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x207672, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x207675, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x2076F6, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207761, { -7.34f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -6.49f } },
+        { 0x207765, { -8.44f, -9.63f, -5.77f, -9.62f, -9.65f, -9.59f, -6.15f } },
+        { 0x207768, { -6.17f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207769, { -6.32f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x20776F, { -6.97f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -5.99f } },
+        { 0x207772, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x2077E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x2077FC, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x207920, { -9.54f, -8.53f, -9.66f, -4.94f, -9.65f, -9.59f, -9.70f } },
+        { 0x207A61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x207A65, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x207A69, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -5.59f } },
+        { 0x207A6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x207A75, { -9.54f, -9.63f, -5.42f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x207A77, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x20E020, { -9.54f, -5.40f, -9.66f, -9.62f, -9.65f, -6.45f, -9.70f } },
+        { 0x20E267, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E820, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x20E920, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x20E964, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E967, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E96C, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E970, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E971, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20E974, { -9.54f, -6.50f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20EA74, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20ED6E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x20F372, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x20F666, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x20FC62, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x612061, { -8.44f, -9.63f, -9.66f, -6.48f, -6.60f, -5.65f, -9.70f } },
+        { 0x612062, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x612063, { -7.93f, -6.80f, -9.66f, -6.25f, -6.28f, -6.45f, -9.70f } },
+        { 0x612064, { -9.54f, -6.27f, -7.46f, -6.06f, -5.44f, -6.03f, -9.70f } },
+        { 0x612065, { -9.54f, -9.63f, -7.71f, -6.00f, -6.43f, -6.29f, -9.70f } },
+        { 0x612066, { -7.93f, -7.23f, -9.66f, -7.05f, -6.94f, -6.75f, -9.70f } },
+        { 0x612067, { -9.54f, -9.63f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x612068, { -8.44f, -9.63f, -9.66f, -7.67f, -8.55f, -7.39f, -9.70f } },
+        { 0x612069, { -9.54f, -8.53f, -8.56f, -7.22f, -6.81f, -6.64f, -9.70f } },
+        { 0x61206A, { -9.54f, -8.53f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x61206C, { -8.44f, -6.14f, -9.66f, -5.41f, -5.75f, -6.54f, -9.70f } },
+        { 0x61206D, { -9.54f, -8.02f, -9.66f, -7.42f, -8.04f, -7.19f, -9.70f } },
+        { 0x61206E, { -8.44f, -8.02f, -8.56f, -6.91f, -6.51f, -6.15f, -9.70f } },
+        { 0x61206F, { -9.54f, -9.63f, -9.66f, -7.05f, -7.08f, -6.88f, -9.70f } },
+        { 0x612070, { -7.14f, -6.20f, -9.66f, -5.38f, -5.68f, -5.35f, -9.70f } },
+        { 0x612071, { -9.54f, -9.63f, -9.66f, -8.52f, -7.70f, -7.19f, -9.70f } },
+        { 0x612072, { -9.54f, -6.69f, -9.66f, -7.67f, -6.70f, -7.64f, -9.70f } },
+        { 0x612073, { -8.44f, -7.07f, -9.66f, -6.25f, -5.88f, -5.74f, -9.70f } },
+        { 0x612074, { -9.54f, -7.23f, -9.66f, -5.95f, -6.81f, -6.22f, -9.70f } },
+        { 0x612075, { -9.54f, -9.63f, -9.66f, -7.22f, -7.25f, -9.59f, -9.70f } },
+        { 0x612076, { -9.54f, -7.69f, -8.56f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x612077, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x612079, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -9.59f, -9.70f } },
+        { 0x6120E0, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6120E8, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6120E9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6120ED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x616164, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x61616B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x61616C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x61616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x61616E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.99f } },
+        { 0x616172, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x616174, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x616261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x616262, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x616265, { -9.54f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616268, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616269, { -9.54f, -8.53f, -9.66f, -8.52f, -7.25f, -8.49f, -9.70f } },
+        { 0x61626C, { -7.93f, -7.44f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x616272, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x616274, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616363, { -7.93f, -7.69f, -9.66f, -8.52f, -8.04f, -9.59f, -9.70f } },
+        { 0x616365, { -7.34f, -8.02f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x616368, { -7.14f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x616369, { -9.54f, -8.53f, -9.66f, -5.25f, -8.55f, -6.54f, -9.70f } },
+        { 0x61636B, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616374, { -6.97f, -7.07f, -9.66f, -7.42f, -9.65f, -7.02f, -9.70f } },
+        { 0x616375, { -9.54f, -8.02f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x616379, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6163E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6163E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6163ED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x616420, { -8.44f, -9.63f, -9.66f, -5.57f, -6.35f, -9.59f, -9.70f } },
+        { 0x616461, { -9.54f, -8.53f, -9.66f, -7.05f, -8.04f, -6.75f, -9.70f } },
+        { 0x616465, { -7.93f, -9.63f, -9.66f, -7.22f, -9.65f, -5.41f, -8.09f } },
+        { 0x616469, { -8.44f, -9.63f, -9.66f, -6.78f, -7.45f, -9.59f, -9.70f } },
+        { 0x61646D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x61646F, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -6.03f, -9.70f } },
+        { 0x616476, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x616477, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x616572, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x616573, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x616620, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x616662, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x616665, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616666, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x616668, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x616669, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x61666B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x616672, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616674, { -9.54f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616676, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x616720, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x616761, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616765, { -6.97f, -6.92f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x616767, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x616769, { -9.54f, -8.02f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x61676C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x616774, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6167E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61686D, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616872, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x616965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61696D, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61696E, { -7.14f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616972, { -8.44f, -6.92f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616973, { -9.54f, -6.92f, -9.66f, -9.62f, -9.65f, -6.22f, -9.70f } },
+        { 0x616974, { -8.44f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616978, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616A61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x616A6F, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x616B20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x616B6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x616B74, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x616C20, { -5.14f, -6.59f, -8.56f, -5.57f, -6.81f, -5.69f, -6.21f } },
+        { 0x616C61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -8.09f } },
+        { 0x616C62, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616C63, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x616C64, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x616C65, { -9.54f, -6.50f, -6.95f, -6.48f, -5.80f, -9.59f, -7.31f } },
+        { 0x616C67, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -7.64f, -8.09f } },
+        { 0x616C69, { -6.83f, -6.80f, -9.66f, -6.91f, -6.35f, -6.88f, -7.51f } },
+        { 0x616C6C, { -5.73f, -9.63f, -6.16f, -9.62f, -6.09f, -9.59f, -6.57f } },
+        { 0x616C6D, { -9.54f, -9.63f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x616C6F, { -7.93f, -8.53f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x616C71, { -9.54f, -9.63f, -9.66f, -6.91f, -9.65f, -7.19f, -9.70f } },
+        { 0x616C73, { -8.44f, -9.63f, -7.09f, -9.62f, -7.45f, -9.59f, -6.66f } },
+        { 0x616C74, { -8.44f, -9.63f, -6.95f, -9.62f, -7.08f, -7.64f, -9.70f } },
+        { 0x616C76, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616CE9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x616D20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -8.61f } },
+        { 0x616D61, { -9.54f, -9.63f, -9.66f, -7.67f, -8.04f, -7.39f, -9.70f } },
+        { 0x616D62, { -9.54f, -9.63f, -9.66f, -7.42f, -8.55f, -8.49f, -9.70f } },
+        { 0x616D65, { -7.34f, -7.23f, -7.46f, -6.48f, -6.28f, -6.09f, -7.00f } },
+        { 0x616D69, { -7.34f, -7.23f, -7.26f, -7.05f, -7.25f, -8.49f, -9.70f } },
+        { 0x616D6D, { -9.54f, -8.02f, -7.46f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x616D6E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616D6F, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616D70, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -8.49f, -9.70f } },
+        { 0x616DE9, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616DED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x616E20, { -6.04f, -9.63f, -7.46f, -6.91f, -9.65f, -9.59f, -4.65f } },
+        { 0x616E61, { -9.54f, -9.63f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x616E63, { -7.34f, -6.92f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x616E64, { -4.68f, -8.02f, -5.65f, -6.91f, -9.65f, -6.75f, -5.44f } },
+        { 0x616E65, { -9.54f, -8.53f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616E67, { -7.59f, -7.69f, -6.71f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x616E69, { -8.44f, -7.69f, -9.66f, -7.67f, -6.51f, -7.19f, -8.61f } },
+        { 0x616E6B, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x616E6E, { -8.44f, -8.53f, -7.46f, -9.62f, -6.60f, -9.59f, -7.51f } },
+        { 0x616E6F, { -8.44f, -9.63f, -9.66f, -6.91f, -7.45f, -7.19f, -9.70f } },
+        { 0x616E73, { -9.54f, -6.20f, -6.61f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x616E74, { -7.34f, -5.87f, -8.56f, -6.25f, -6.70f, -6.75f, -7.51f } },
+        { 0x616E79, { -6.40f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x616E7A, { -9.54f, -9.63f, -8.05f, -8.01f, -6.35f, -9.59f, -9.70f } },
+        { 0x616EE7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x616EED, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x616F20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x616F73, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x617020, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x61706C, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x617070, { -8.44f, -8.02f, -9.66f, -9.62f, -7.70f, -9.59f, -7.31f } },
+        { 0x617072, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617175, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x617220, { -8.44f, -6.69f, -8.05f, -6.48f, -8.55f, -6.15f, -6.76f } },
+        { 0x617261, { -7.14f, -7.23f, -8.56f, -6.57f, -6.81f, -6.54f, -9.70f } },
+        { 0x617262, { -7.14f, -7.23f, -7.71f, -7.22f, -7.25f, -7.19f, -7.76f } },
+        { 0x617263, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x617264, { -7.14f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -6.87f } },
+        { 0x617265, { -6.97f, -9.63f, -7.71f, -8.52f, -6.70f, -8.49f, -7.31f } },
+        { 0x617266, { -9.54f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617267, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617268, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x617269, { -7.34f, -7.23f, -9.66f, -6.91f, -6.70f, -7.64f, -7.31f } },
+        { 0x61726C, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61726D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61726F, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x617272, { -7.14f, -8.53f, -9.66f, -8.52f, -8.55f, -9.59f, -8.61f } },
+        { 0x617273, { -9.54f, -9.63f, -9.66f, -7.67f, -8.55f, -9.59f, -8.61f } },
+        { 0x617274, { -5.69f, -5.74f, -5.73f, -5.76f, -5.80f, -5.74f, -5.85f } },
+        { 0x617279, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61727A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6172E0, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6172E1, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x6172E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617320, { -5.30f, -7.44f, -6.10f, -5.50f, -9.65f, -5.32f, -7.76f } },
+        { 0x617361, { -9.54f, -9.63f, -9.66f, -8.01f, -8.55f, -7.64f, -9.70f } },
+        { 0x617363, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -7.98f, -9.70f } },
+        { 0x617365, { -8.44f, -9.63f, -9.66f, -7.42f, -8.55f, -9.59f, -9.70f } },
+        { 0x617369, { -8.44f, -8.02f, -9.66f, -8.52f, -7.25f, -8.49f, -8.61f } },
+        { 0x61736F, { -8.44f, -9.63f, -9.66f, -7.42f, -9.65f, -8.49f, -9.70f } },
+        { 0x617370, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -9.59f, -8.61f } },
+        { 0x617373, { -7.14f, -7.07f, -7.09f, -9.62f, -7.45f, -7.19f, -7.76f } },
+        { 0x617374, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x617375, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617379, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6173ED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x617420, { -6.83f, -8.02f, -6.05f, -9.62f, -9.65f, -9.59f, -6.09f } },
+        { 0x617461, { -9.54f, -9.63f, -9.66f, -7.42f, -7.45f, -7.64f, -9.70f } },
+        { 0x617465, { -6.97f, -8.53f, -7.46f, -8.01f, -7.70f, -8.49f, -7.76f } },
+        { 0x617469, { -5.14f, -5.21f, -6.52f, -9.62f, -7.08f, -7.64f, -5.85f } },
+        { 0x61746C, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61746D, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61746F, { -9.54f, -9.63f, -9.66f, -8.52f, -5.50f, -8.49f, -9.70f } },
+        { 0x617472, { -9.54f, -9.63f, -9.66f, -7.42f, -7.70f, -8.49f, -8.61f } },
+        { 0x617473, { -9.54f, -8.02f, -6.95f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x617474, { -7.93f, -7.69f, -8.56f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x617475, { -7.59f, -8.02f, -9.66f, -8.52f, -7.70f, -7.19f, -7.76f } },
+        { 0x6174E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6174FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617520, { -9.54f, -7.23f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617562, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617563, { -9.54f, -7.44f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617565, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617566, { -9.54f, -9.63f, -5.90f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617572, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x617573, { -9.54f, -8.02f, -7.71f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x617574, { -9.54f, -6.92f, -8.56f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x617575, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617578, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617661, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -7.98f, -9.70f } },
+        { 0x617665, { -6.40f, -7.69f, -7.71f, -8.52f, -7.70f, -8.49f, -7.76f } },
+        { 0x617669, { -8.44f, -9.63f, -9.66f, -8.01f, -7.70f, -9.59f, -9.70f } },
+        { 0x61766F, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x617675, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x617676, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6176E8, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6176E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x617720, { -6.71f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617920, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617961, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x61796F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x617973, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x617A20, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x617A61, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x617A65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x617A69, { -9.54f, -9.63f, -9.66f, -9.62f, -5.50f, -9.59f, -9.70f } },
+        { 0x617A7A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x617AE3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x617AF3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x617AF5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x61DF6E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x61E761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x61E7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -5.97f, -9.70f } },
+        { 0x61E7F5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.64f, -9.70f } },
+        { 0x61ED73, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -7.19f, -9.70f } },
+        { 0x622061, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x622064, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x622065, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x622074, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x626161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x62616A, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x62616E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x626172, { -7.93f, -8.02f, -7.26f, -8.01f, -8.04f, -8.49f, -7.14f } },
+        { 0x626173, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x626265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x626269, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x62626C, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x626520, { -5.98f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x626564, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x626565, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x626566, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x626567, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x626568, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x626569, { -7.93f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62656B, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62656C, { -6.97f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -7.76f } },
+        { 0x62656D, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62656E, { -9.54f, -9.63f, -6.10f, -8.01f, -9.65f, -8.49f, -6.76f } },
+        { 0x626570, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x626572, { -7.34f, -6.41f, -7.26f, -6.12f, -6.09f, -6.15f, -7.76f } },
+        { 0x626573, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x626574, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x626576, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x626577, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x62657A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6268E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x626961, { -9.54f, -9.63f, -9.66f, -8.01f, -8.04f, -9.59f, -9.70f } },
+        { 0x626964, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x626965, { -9.54f, -8.02f, -8.05f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x62696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x62696C, { -9.54f, -8.02f, -8.56f, -8.01f, -7.08f, -7.98f, -9.70f } },
+        { 0x62696E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x626972, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x626973, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x626974, { -7.14f, -7.44f, -9.66f, -7.42f, -7.25f, -7.39f, -9.70f } },
+        { 0x6269E9, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x626A65, { -7.59f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x626C65, { -7.93f, -7.69f, -9.66f, -7.67f, -8.55f, -8.49f, -9.70f } },
+        { 0x626C69, { -7.34f, -7.07f, -9.66f, -7.22f, -7.70f, -7.64f, -8.61f } },
+        { 0x626C6F, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x626C79, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x626CE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x626D65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x626F64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x626F6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x626F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x626F72, { -7.93f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x626F73, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x626F74, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x627261, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x627265, { -9.54f, -6.92f, -8.05f, -6.57f, -9.65f, -9.59f, -8.09f } },
+        { 0x627269, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -7.98f, -8.61f } },
+        { 0x62726F, { -8.44f, -9.63f, -9.66f, -7.67f, -9.65f, -7.64f, -8.61f } },
+        { 0x6272FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x627365, { -7.59f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x627374, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x627420, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62756E, { -7.93f, -8.53f, -8.56f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x627572, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x627573, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x627574, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x627920, { -6.71f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62E172, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x62E96E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x62E972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x632068, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63206C, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63206F, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x632071, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x632074, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636120, { -9.54f, -9.63f, -9.66f, -6.91f, -7.45f, -7.02f, -9.70f } },
+        { 0x636162, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x636163, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x636164, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x63616C, { -7.59f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63616D, { -9.54f, -9.63f, -9.66f, -7.67f, -8.55f, -8.49f, -9.70f } },
+        { 0x636172, { -9.54f, -9.63f, -9.66f, -7.67f, -7.70f, -7.98f, -9.70f } },
+        { 0x636173, { -8.44f, -8.53f, -9.66f, -7.42f, -8.55f, -7.19f, -9.70f } },
+        { 0x636174, { -8.44f, -7.69f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x636175, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x63617A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6361E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x636368, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x636369, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -9.59f, -9.70f } },
+        { 0x63636F, { -7.93f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636375, { -9.54f, -8.02f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x636520, { -5.73f, -5.87f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0x636562, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x636566, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636569, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63656C, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x63656D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x63656E, { -8.44f, -8.02f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x636570, { -9.54f, -8.53f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x636572, { -9.54f, -9.63f, -9.66f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x636573, { -8.44f, -7.69f, -9.66f, -8.52f, -8.04f, -7.64f, -9.70f } },
+        { 0x636574, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636576, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x63657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x636820, { -6.49f, -9.63f, -5.29f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x636861, { -7.14f, -7.23f, -6.36f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x636862, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636865, { -9.54f, -7.44f, -5.24f, -9.62f, -5.84f, -9.59f, -6.57f } },
+        { 0x636867, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636868, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636869, { -7.34f, -9.63f, -7.71f, -9.62f, -6.94f, -9.59f, -8.09f } },
+        { 0x63686B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63686C, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63686F, { -9.54f, -8.53f, -9.66f, -5.25f, -9.65f, -9.59f, -9.70f } },
+        { 0x636872, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x636873, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636874, { -9.54f, -9.63f, -4.85f, -9.62f, -9.65f, -9.59f, -4.96f } },
+        { 0x636875, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x636877, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6368E9, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6368FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x636961, { -7.14f, -7.44f, -9.66f, -5.72f, -6.94f, -6.22f, -8.61f } },
+        { 0x636962, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x636964, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x636965, { -6.97f, -7.44f, -9.66f, -7.22f, -7.08f, -7.98f, -9.70f } },
+        { 0x636966, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x63696C, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x63696D, { -9.54f, -9.63f, -9.66f, -7.22f, -7.45f, -7.19f, -9.70f } },
+        { 0x63696F, { -9.54f, -9.63f, -9.66f, -5.76f, -8.55f, -6.54f, -9.70f } },
+        { 0x636970, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x636972, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x636973, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x636974, { -8.44f, -9.63f, -9.66f, -9.62f, -7.08f, -8.49f, -9.70f } },
+        { 0x636975, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6369E9, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6369EA, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6369F3, { -9.54f, -9.63f, -9.66f, -5.30f, -9.65f, -9.59f, -9.70f } },
+        { 0x636B6C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636B73, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636B75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636B7A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636C61, { -6.97f, -6.41f, -9.66f, -6.57f, -8.04f, -6.75f, -8.61f } },
+        { 0x636C65, { -5.83f, -5.92f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x636C75, { -7.59f, -8.53f, -9.66f, -7.67f, -7.45f, -8.49f, -9.70f } },
+        { 0x636F20, { -8.44f, -9.63f, -9.66f, -7.67f, -7.45f, -7.39f, -9.70f } },
+        { 0x636F67, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x636F6C, { -8.44f, -8.53f, -9.66f, -7.42f, -5.84f, -7.64f, -9.70f } },
+        { 0x636F6D, { -6.59f, -6.50f, -9.66f, -6.00f, -6.43f, -6.09f, -9.70f } },
+        { 0x636F6E, { -6.59f, -5.32f, -9.66f, -5.30f, -5.47f, -5.29f, -8.61f } },
+        { 0x636F6F, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x636F72, { -7.93f, -8.53f, -9.66f, -8.52f, -7.70f, -7.64f, -9.70f } },
+        { 0x636F73, { -9.54f, -9.63f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x636F75, { -6.97f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x637265, { -9.54f, -9.63f, -9.66f, -7.67f, -7.70f, -8.49f, -9.70f } },
+        { 0x637269, { -7.14f, -7.69f, -9.66f, -8.01f, -7.70f, -7.64f, -9.70f } },
+        { 0x63726F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637275, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x637420, { -7.34f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637465, { -7.34f, -7.23f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x637469, { -6.40f, -6.08f, -9.66f, -6.91f, -9.65f, -7.19f, -8.61f } },
+        { 0x63746F, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.19f, -9.70f } },
+        { 0x637473, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637475, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637561, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -9.59f, -9.70f } },
+        { 0x637563, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x637569, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x63756C, { -9.54f, -7.69f, -9.66f, -5.76f, -8.55f, -7.64f, -8.61f } },
+        { 0x63756D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x63756E, { -9.54f, -7.07f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x637572, { -7.93f, -9.63f, -9.66f, -8.01f, -8.55f, -7.19f, -9.70f } },
+        { 0x637573, { -9.54f, -8.02f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x637574, { -7.93f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x637579, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x63757A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x637920, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63E176, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x63E7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.88f, -9.70f } },
+        { 0x63E7F5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x63E873, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63E973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x63ED66, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x63ED6C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x63ED70, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x642061, { -6.32f, -7.44f, -7.46f, -8.01f, -7.45f, -9.59f, -8.09f } },
+        { 0x642062, { -7.14f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x642063, { -7.93f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x642064, { -9.54f, -8.53f, -6.22f, -6.67f, -9.65f, -9.59f, -7.76f } },
+        { 0x642065, { -7.14f, -7.44f, -7.09f, -9.62f, -7.45f, -9.59f, -6.87f } },
+        { 0x642066, { -6.71f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x642067, { -7.93f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x642068, { -7.93f, -9.63f, -7.71f, -9.62f, -8.55f, -9.59f, -7.31f } },
+        { 0x642069, { -6.04f, -8.53f, -7.71f, -8.01f, -8.04f, -9.59f, -8.61f } },
+        { 0x64206A, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x64206B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x64206C, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x64206D, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x64206E, { -7.14f, -9.63f, -7.71f, -7.67f, -9.65f, -9.59f, -8.61f } },
+        { 0x64206F, { -6.40f, -7.44f, -8.56f, -8.52f, -7.70f, -9.59f, -6.76f } },
+        { 0x642070, { -7.59f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x642072, { -7.14f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x642073, { -7.34f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x642074, { -5.69f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x642075, { -9.54f, -7.23f, -7.46f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x642076, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.49f } },
+        { 0x642077, { -6.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x642079, { -9.54f, -9.63f, -9.66f, -6.91f, -9.65f, -9.59f, -9.70f } },
+        { 0x64207A, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x6420F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646120, { -9.54f, -9.63f, -6.82f, -5.72f, -7.25f, -5.14f, -9.70f } },
+        { 0x646161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x646163, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x646164, { -9.54f, -9.63f, -9.66f, -5.95f, -9.65f, -5.38f, -9.70f } },
+        { 0x64616C, { -9.54f, -9.63f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x64616D, { -7.34f, -7.23f, -8.05f, -7.42f, -7.25f, -7.02f, -7.76f } },
+        { 0x64616E, { -9.54f, -6.20f, -8.05f, -8.52f, -7.70f, -8.49f, -8.09f } },
+        { 0x646172, { -7.93f, -9.63f, -6.52f, -8.52f, -8.55f, -7.64f, -9.70f } },
+        { 0x646173, { -9.54f, -9.63f, -6.05f, -6.78f, -9.65f, -6.22f, -9.70f } },
+        { 0x646174, { -8.44f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -6.41f } },
+        { 0x646176, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x646261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x646465, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x646520, { -7.59f, -4.42f, -6.82f, -4.47f, -8.04f, -4.34f, -4.44f } },
+        { 0x646561, { -8.44f, -9.63f, -8.56f, -8.52f, -8.55f, -8.49f, -8.61f } },
+        { 0x646562, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x646563, { -7.34f, -9.63f, -9.66f, -7.42f, -8.55f, -7.02f, -9.70f } },
+        { 0x646564, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x646565, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x646566, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x646567, { -8.44f, -9.63f, -9.66f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x646569, { -9.54f, -9.63f, -7.71f, -9.62f, -6.60f, -8.49f, -9.70f } },
+        { 0x64656C, { -9.54f, -9.63f, -8.56f, -6.25f, -5.41f, -7.64f, -6.66f } },
+        { 0x64656D, { -9.54f, -8.53f, -7.09f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x64656E, { -7.14f, -8.53f, -5.73f, -7.42f, -7.45f, -7.39f, -5.41f } },
+        { 0x646570, { -7.34f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x646572, { -7.14f, -8.02f, -4.49f, -5.10f, -6.70f, -6.75f, -4.96f } },
+        { 0x646573, { -7.93f, -5.87f, -6.82f, -6.91f, -9.65f, -6.29f, -8.61f } },
+        { 0x646574, { -7.59f, -9.63f, -7.46f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x646576, { -8.44f, -7.69f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x64657A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x646672, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646765, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646865, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x646920, { -9.54f, -9.63f, -9.66f, -9.62f, -4.83f, -9.59f, -9.70f } },
+        { 0x646961, { -8.44f, -9.63f, -9.66f, -8.01f, -8.55f, -9.59f, -9.70f } },
+        { 0x646963, { -7.93f, -8.02f, -9.66f, -6.67f, -6.94f, -7.98f, -8.61f } },
+        { 0x646964, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x646965, { -9.54f, -9.63f, -5.15f, -6.57f, -8.55f, -9.59f, -6.49f } },
+        { 0x646966, { -9.54f, -9.63f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x646967, { -7.59f, -7.69f, -6.82f, -7.67f, -7.70f, -7.64f, -6.57f } },
+        { 0x64696E, { -7.14f, -9.63f, -8.56f, -9.62f, -7.25f, -9.59f, -8.09f } },
+        { 0x64696F, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x646970, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x646971, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646972, { -9.54f, -8.53f, -9.66f, -8.52f, -5.33f, -5.19f, -9.70f } },
+        { 0x646973, { -6.83f, -7.07f, -8.05f, -6.67f, -6.70f, -6.88f, -8.61f } },
+        { 0x646974, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x646976, { -8.44f, -7.44f, -9.66f, -7.22f, -5.75f, -7.02f, -8.61f } },
+        { 0x64697A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6469E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x646C61, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646C65, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646C69, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646C75, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646C79, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646D69, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x646E69, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646F20, { -9.54f, -9.63f, -9.66f, -5.44f, -6.60f, -5.07f, -9.70f } },
+        { 0x646F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x646F69, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646F6C, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x646F6D, { -6.10f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -7.76f } },
+        { 0x646F6E, { -9.54f, -8.53f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x646F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x646F73, { -9.54f, -9.63f, -9.66f, -6.18f, -9.65f, -5.51f, -9.70f } },
+        { 0x646F74, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x646F75, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x646F76, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x646F77, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x647265, { -9.54f, -7.69f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x647269, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x64726F, { -9.54f, -5.29f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647275, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6472E1, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x6472FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647320, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647363, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x647364, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x64736C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x647374, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6473E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647420, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x647520, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x647561, { -8.44f, -9.63f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x647563, { -8.44f, -8.53f, -9.66f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x647565, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647569, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64756D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x64756F, { -9.54f, -9.63f, -9.66f, -7.67f, -5.75f, -7.19f, -9.70f } },
+        { 0x647572, { -8.44f, -8.53f, -6.71f, -8.52f, -8.55f, -8.49f, -8.61f } },
+        { 0x647573, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64757A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x647665, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -8.61f } },
+        { 0x647765, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x64776F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x647920, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x647A61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x64E36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x64E920, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E961, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E963, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E965, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E966, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E967, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E96C, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E970, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E972, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E974, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64E976, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x64EA6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x652061, { -5.78f, -5.83f, -6.29f, -7.42f, -6.15f, -5.87f, -6.66f } },
+        { 0x652062, { -7.14f, -8.02f, -7.46f, -8.52f, -9.65f, -7.98f, -6.04f } },
+        { 0x652063, { -6.40f, -5.63f, -9.66f, -6.32f, -5.88f, -6.45f, -8.61f } },
+        { 0x652064, { -7.14f, -5.06f, -6.82f, -5.54f, -4.92f, -5.22f, -6.66f } },
+        { 0x652065, { -5.69f, -5.97f, -6.71f, -6.00f, -6.03f, -6.03f, -6.66f } },
+        { 0x652066, { -6.97f, -6.92f, -6.95f, -8.01f, -8.04f, -7.02f, -7.76f } },
+        { 0x652067, { -7.59f, -8.53f, -6.71f, -9.62f, -7.25f, -9.59f, -6.41f } },
+        { 0x652068, { -5.78f, -8.02f, -7.46f, -7.05f, -7.70f, -9.59f, -7.31f } },
+        { 0x652069, { -6.40f, -7.07f, -7.09f, -6.67f, -5.68f, -6.75f, -6.87f } },
+        { 0x65206A, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.98f, -8.61f } },
+        { 0x65206B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x65206C, { -7.14f, -5.02f, -8.56f, -5.17f, -5.98f, -7.19f, -7.00f } },
+        { 0x65206D, { -7.34f, -6.69f, -6.71f, -8.52f, -7.70f, -7.39f, -6.15f } },
+        { 0x65206E, { -6.59f, -5.97f, -7.71f, -7.22f, -6.03f, -6.29f, -6.49f } },
+        { 0x65206F, { -6.32f, -6.50f, -8.05f, -7.67f, -6.43f, -5.97f, -6.27f } },
+        { 0x652070, { -6.32f, -5.29f, -8.56f, -6.67f, -6.28f, -6.09f, -8.09f } },
+        { 0x652071, { -9.54f, -6.69f, -9.66f, -7.67f, -7.70f, -7.19f, -9.70f } },
+        { 0x652072, { -5.57f, -6.27f, -7.26f, -6.91f, -7.45f, -6.45f, -6.21f } },
+        { 0x652073, { -6.04f, -5.46f, -6.36f, -6.12f, -6.35f, -6.29f, -6.49f } },
+        { 0x652074, { -6.24f, -5.83f, -8.56f, -7.05f, -6.94f, -6.88f, -7.51f } },
+        { 0x652075, { -7.34f, -9.63f, -6.16f, -6.91f, -7.08f, -6.75f, -8.61f } },
+        { 0x652076, { -9.54f, -8.53f, -7.09f, -7.67f, -8.04f, -7.64f, -5.44f } },
+        { 0x652077, { -6.83f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x652079, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x65207A, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6520E0, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6520E8, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6520E9, { -9.54f, -7.69f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x6520FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656120, { -9.54f, -9.63f, -9.66f, -8.01f, -8.55f, -9.59f, -9.70f } },
+        { 0x656161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656163, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656164, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656166, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x65616C, { -8.44f, -9.63f, -8.56f, -8.01f, -7.70f, -7.98f, -9.70f } },
+        { 0x65616E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x656172, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656173, { -6.49f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656174, { -7.93f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x656175, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656176, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656262, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x656265, { -8.44f, -9.63f, -7.26f, -7.42f, -9.65f, -8.49f, -9.70f } },
+        { 0x656269, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x65626C, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x65626F, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x656272, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x656275, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656320, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656361, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x656363, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x656365, { -7.93f, -8.53f, -9.66f, -8.01f, -8.55f, -7.64f, -9.70f } },
+        { 0x656368, { -8.44f, -9.63f, -5.19f, -5.27f, -9.65f, -9.59f, -5.19f } },
+        { 0x656369, { -9.54f, -9.63f, -9.66f, -8.01f, -8.55f, -7.02f, -9.70f } },
+        { 0x65636C, { -7.34f, -9.63f, -9.66f, -7.42f, -9.65f, -7.39f, -9.70f } },
+        { 0x65636F, { -7.34f, -7.07f, -9.66f, -7.22f, -8.04f, -7.39f, -9.70f } },
+        { 0x656374, { -6.32f, -6.59f, -9.66f, -7.22f, -9.65f, -7.39f, -9.70f } },
+        { 0x656375, { -7.34f, -9.63f, -9.66f, -7.67f, -8.55f, -7.64f, -9.70f } },
+        { 0x6563E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x656420, { -5.28f, -9.63f, -7.71f, -9.62f, -7.08f, -9.59f, -7.00f } },
+        { 0x656461, { -9.54f, -9.63f, -8.05f, -7.22f, -9.65f, -7.39f, -7.76f } },
+        { 0x656464, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656465, { -9.54f, -9.63f, -5.85f, -9.62f, -8.55f, -9.59f, -5.47f } },
+        { 0x656467, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656469, { -8.44f, -9.63f, -8.05f, -7.42f, -8.55f, -8.49f, -7.31f } },
+        { 0x65646C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65646F, { -6.10f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x656472, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656473, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656475, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -7.98f, -9.70f } },
+        { 0x656477, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656479, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65647A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656520, { -7.93f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x656563, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656564, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656566, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.09f } },
+        { 0x656569, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65656B, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65656C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x65656D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x65656E, { -7.93f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -5.13f } },
+        { 0x656570, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656572, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x656573, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656620, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656665, { -8.44f, -9.63f, -9.66f, -7.42f, -9.65f, -7.39f, -9.70f } },
+        { 0x656666, { -7.93f, -7.44f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x656669, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x65666F, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656674, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.99f } },
+        { 0x656675, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656677, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6566FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656761, { -7.93f, -8.53f, -8.05f, -9.62f, -8.55f, -8.49f, -8.61f } },
+        { 0x656764, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x656765, { -9.54f, -9.63f, -6.16f, -9.62f, -9.65f, -9.59f, -5.94f } },
+        { 0x656767, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x656769, { -9.54f, -9.63f, -8.56f, -8.01f, -9.65f, -8.49f, -8.09f } },
+        { 0x65676C, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x65676E, { -9.54f, -9.63f, -8.56f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x656772, { -8.44f, -9.63f, -9.66f, -8.01f, -8.55f, -7.98f, -7.76f } },
+        { 0x656775, { -9.54f, -9.63f, -9.66f, -7.42f, -7.08f, -7.64f, -9.70f } },
+        { 0x6567FA, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x656861, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656865, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656869, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65686F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x656872, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656874, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656875, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6568F6, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656920, { -9.54f, -9.63f, -6.36f, -9.62f, -6.51f, -7.39f, -9.70f } },
+        { 0x656961, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x656962, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656963, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656964, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -5.73f } },
+        { 0x656965, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656966, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656967, { -8.44f, -8.02f, -7.46f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x656968, { -9.54f, -9.63f, -6.29f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656969, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65696B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x65696C, { -9.54f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65696E, { -7.93f, -6.80f, -4.63f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x65696F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656972, { -7.34f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656973, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656974, { -8.44f, -9.63f, -5.48f, -9.62f, -9.65f, -5.10f, -6.76f } },
+        { 0x656976, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656A61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.02f, -9.70f } },
+        { 0x656B20, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656B65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x656B6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656B72, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C20, { -8.44f, -7.44f, -5.85f, -5.27f, -6.51f, -8.49f, -5.66f } },
+        { 0x656C61, { -8.44f, -8.53f, -9.66f, -8.52f, -7.70f, -6.75f, -7.76f } },
+        { 0x656C62, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C63, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C64, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x656C65, { -9.54f, -9.63f, -8.56f, -7.22f, -9.65f, -7.98f, -6.57f } },
+        { 0x656C66, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656C68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656C69, { -6.71f, -7.23f, -7.26f, -6.48f, -7.08f, -6.64f, -5.59f } },
+        { 0x656C6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x656C6C, { -7.34f, -6.50f, -7.26f, -8.01f, -5.18f, -9.59f, -7.51f } },
+        { 0x656C6E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C6F, { -7.59f, -8.02f, -9.66f, -9.62f, -9.65f, -7.39f, -8.09f } },
+        { 0x656C71, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C73, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C74, { -9.54f, -9.63f, -7.26f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C75, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C76, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656C79, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656D20, { -9.54f, -9.63f, -6.52f, -9.62f, -9.65f, -4.91f, -7.76f } },
+        { 0x656D61, { -9.54f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x656D62, { -7.14f, -7.44f, -9.66f, -7.67f, -7.45f, -7.39f, -9.70f } },
+        { 0x656D64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656D65, { -7.34f, -5.97f, -6.82f, -7.67f, -8.55f, -7.64f, -7.31f } },
+        { 0x656D69, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656D6D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656D6F, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x656D70, { -8.44f, -8.53f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656D73, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656DE1, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x656DE4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656DFC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656E20, { -6.83f, -5.97f, -3.77f, -5.22f, -9.65f, -9.59f, -3.48f } },
+        { 0x656E61, { -6.97f, -9.63f, -8.56f, -7.05f, -7.25f, -7.02f, -9.70f } },
+        { 0x656E62, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x656E63, { -6.24f, -7.23f, -9.66f, -6.32f, -9.65f, -7.39f, -9.70f } },
+        { 0x656E64, { -6.97f, -7.69f, -6.44f, -7.67f, -7.45f, -7.64f, -6.04f } },
+        { 0x656E65, { -8.44f, -9.63f, -7.46f, -5.81f, -7.70f, -8.49f, -8.61f } },
+        { 0x656E67, { -9.54f, -8.02f, -8.56f, -9.62f, -8.55f, -9.59f, -7.31f } },
+        { 0x656E68, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x656E69, { -8.44f, -8.53f, -8.05f, -8.01f, -9.65f, -9.59f, -6.15f } },
+        { 0x656E6A, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656E6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656E6D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656E6E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x656E6F, { -9.54f, -9.63f, -8.05f, -7.67f, -8.04f, -8.49f, -8.61f } },
+        { 0x656E72, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x656E73, { -9.54f, -7.44f, -5.85f, -7.42f, -7.45f, -7.39f, -5.59f } },
+        { 0x656E74, { -5.53f, -5.12f, -6.82f, -5.32f, -5.36f, -5.07f, -7.51f } },
+        { 0x656E75, { -8.44f, -8.02f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x656E76, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x656E77, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x656E7A, { -9.54f, -9.63f, -8.05f, -9.62f, -6.43f, -9.59f, -8.09f } },
+        { 0x656EE1, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x656F20, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x656F70, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657020, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x657061, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x657063, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x657065, { -7.93f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -8.09f } },
+        { 0x657069, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657072, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657073, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x657074, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x657075, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6570E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x657175, { -6.71f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x657220, { -6.04f, -6.02f, -4.25f, -6.06f, -6.94f, -5.78f, -5.53f } },
+        { 0x657261, { -7.93f, -6.69f, -7.26f, -6.40f, -6.70f, -6.22f, -7.76f } },
+        { 0x657262, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x657263, { -9.54f, -8.02f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x657264, { -9.54f, -8.53f, -6.22f, -9.62f, -9.65f, -6.37f, -7.51f } },
+        { 0x657265, { -6.10f, -9.63f, -5.99f, -5.13f, -5.64f, -7.19f, -5.31f } },
+        { 0x657266, { -7.59f, -9.63f, -6.82f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x657267, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x657268, { -8.44f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657269, { -9.54f, -9.63f, -8.05f, -8.01f, -7.25f, -8.49f, -7.76f } },
+        { 0x65726B, { -9.54f, -9.63f, -6.36f, -9.62f, -9.65f, -9.59f, -6.41f } },
+        { 0x65726C, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x65726D, { -7.59f, -9.63f, -8.56f, -8.52f, -8.04f, -9.59f, -7.31f } },
+        { 0x65726E, { -7.34f, -7.44f, -6.52f, -7.42f, -7.45f, -7.19f, -7.31f } },
+        { 0x65726F, { -9.54f, -8.53f, -9.66f, -8.52f, -8.04f, -9.59f, -8.09f } },
+        { 0x657270, { -9.54f, -9.63f, -8.05f, -9.62f, -8.55f, -9.59f, -8.09f } },
+        { 0x657272, { -7.93f, -7.44f, -7.71f, -7.22f, -8.04f, -7.39f, -8.61f } },
+        { 0x657273, { -6.17f, -5.97f, -6.22f, -5.81f, -6.35f, -7.19f, -6.49f } },
+        { 0x657274, { -7.34f, -6.41f, -7.71f, -6.18f, -6.21f, -8.49f, -7.51f } },
+        { 0x657275, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x657276, { -7.34f, -8.53f, -9.66f, -8.01f, -7.70f, -8.49f, -7.00f } },
+        { 0x657277, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x657279, { -5.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65727A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6572E1, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.02f, -9.70f } },
+        { 0x6572E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657320, { -5.93f, -4.27f, -5.73f, -5.08f, -9.65f, -5.27f, -6.76f } },
+        { 0x657361, { -9.54f, -9.63f, -9.66f, -7.67f, -8.55f, -8.49f, -9.70f } },
+        { 0x657363, { -9.54f, -7.69f, -6.71f, -7.42f, -9.65f, -7.19f, -7.14f } },
+        { 0x657364, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657365, { -7.93f, -9.63f, -5.90f, -7.67f, -6.94f, -7.19f, -9.70f } },
+        { 0x657366, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x657369, { -8.44f, -9.63f, -8.56f, -7.22f, -7.25f, -8.49f, -9.70f } },
+        { 0x65736C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x65736D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x65736F, { -8.44f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -8.61f } },
+        { 0x657370, { -7.59f, -7.23f, -9.66f, -7.42f, -8.55f, -6.88f, -9.70f } },
+        { 0x657373, { -6.71f, -6.80f, -8.56f, -9.62f, -5.38f, -5.62f, -9.70f } },
+        { 0x657374, { -7.34f, -6.80f, -8.05f, -5.90f, -6.60f, -6.45f, -6.66f } },
+        { 0x657375, { -7.93f, -8.53f, -9.66f, -8.01f, -8.55f, -7.98f, -9.70f } },
+        { 0x657420, { -8.44f, -4.91f, -7.46f, -9.62f, -9.65f, -9.59f, -5.07f } },
+        { 0x657461, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x657465, { -7.34f, -9.63f, -8.05f, -7.42f, -7.70f, -7.98f, -7.14f } },
+        { 0x657468, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657469, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.64f, -9.70f } },
+        { 0x65746F, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x657472, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -7.76f } },
+        { 0x657473, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657474, { -8.44f, -8.53f, -9.66f, -9.62f, -6.51f, -9.59f, -9.70f } },
+        { 0x657475, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657477, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657479, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65747A, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6574E0, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x6574E9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657520, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x657567, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657568, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65756C, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65756E, { -9.54f, -9.63f, -8.56f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x657570, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657572, { -9.54f, -6.59f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x657573, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x657574, { -9.54f, -6.92f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657577, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x657578, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657661, { -9.54f, -7.69f, -9.66f, -7.67f, -9.65f, -9.59f, -8.09f } },
+        { 0x657665, { -5.78f, -8.53f, -9.66f, -9.62f, -8.55f, -8.49f, -6.66f } },
+        { 0x657669, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x65766F, { -9.54f, -8.53f, -9.66f, -9.62f, -7.70f, -7.98f, -7.31f } },
+        { 0x6576F6, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657761, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x657769, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6577E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657820, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657861, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x657865, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657869, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x65786F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x657870, { -8.44f, -8.02f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x657920, { -7.93f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x657A61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x657A65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x657A69, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -7.76f } },
+        { 0x657A6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x657A75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657A77, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x657A7A, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x65DF65, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65DF6C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65DF74, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65DF75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x65F161, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x662061, { -6.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x662062, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x662064, { -9.54f, -8.02f, -7.71f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x662065, { -8.44f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x662066, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662067, { -8.44f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x662068, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x662069, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x66206B, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66206C, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66206D, { -7.14f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x66206E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x66206F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x662070, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662072, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662073, { -7.34f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662074, { -5.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662075, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x662076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x662077, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x66207A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x666163, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x666168, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666169, { -7.93f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66616C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x66616D, { -7.34f, -7.44f, -7.71f, -7.42f, -7.45f, -7.39f, -9.70f } },
+        { 0x66616E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666172, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x666173, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666176, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x66617A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6661E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x666261, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x666265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x666420, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x666520, { -7.93f, -9.63f, -7.46f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x666561, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666563, { -7.93f, -7.69f, -9.66f, -7.67f, -9.65f, -7.64f, -9.70f } },
+        { 0x666564, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x666569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -7.51f } },
+        { 0x66656D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66656E, { -7.14f, -8.53f, -6.95f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x666572, { -7.59f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x666573, { -8.44f, -8.53f, -7.71f, -8.52f, -8.04f, -7.98f, -9.70f } },
+        { 0x666574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x666665, { -6.97f, -7.69f, -7.26f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x666669, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x66666F, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x666861, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x666865, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666963, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -7.98f, -9.70f } },
+        { 0x666964, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x66696D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x66696E, { -9.54f, -8.53f, -9.66f, -8.01f, -7.45f, -8.49f, -8.61f } },
+        { 0x666971, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x666972, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x666B6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x666C69, { -9.54f, -8.53f, -7.71f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x666CF6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x666F69, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x666F6C, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x666F6E, { -9.54f, -6.69f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x666F72, { -6.24f, -7.23f, -7.46f, -7.42f, -7.70f, -7.39f, -9.70f } },
+        { 0x666F75, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x667261, { -9.54f, -8.53f, -8.05f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x667265, { -5.98f, -9.63f, -5.90f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x667269, { -8.44f, -9.63f, -8.05f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x66726F, { -7.14f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x667275, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x667374, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x667420, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -6.04f } },
+        { 0x667465, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x667469, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x66746C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x667476, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x667565, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x66756C, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66756E, { -7.34f, -9.63f, -9.66f, -6.91f, -9.65f, -6.88f, -7.76f } },
+        { 0x667572, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x667574, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x667665, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x667769, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x66E468, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66E920, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x66F672, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66FC68, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66FC6C, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x66FC72, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672061, { -8.44f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672062, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672064, { -9.54f, -9.63f, -6.16f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x672065, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x672066, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672067, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x672068, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x672069, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x67206D, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x67206E, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x67206F, { -7.93f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x672070, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x672073, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672074, { -6.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x672075, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x672076, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -6.27f } },
+        { 0x672077, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x67207A, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x676120, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x676161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x676162, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676163, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x676164, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.98f, -8.09f } },
+        { 0x676167, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676169, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67616C, { -9.54f, -7.23f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x67616E, { -8.44f, -8.02f, -8.56f, -8.52f, -8.55f, -8.49f, -8.09f } },
+        { 0x676172, { -7.93f, -8.02f, -8.56f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x676174, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676175, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6761E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x676420, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x676465, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x676520, { -6.59f, -7.07f, -7.71f, -9.62f, -7.45f, -9.59f, -7.14f } },
+        { 0x676561, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x676562, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x676564, { -7.59f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x676565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x676566, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676567, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x676568, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x676569, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x67656C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -6.27f } },
+        { 0x67656D, { -9.54f, -8.53f, -6.52f, -9.62f, -9.65f, -8.49f, -7.14f } },
+        { 0x67656E, { -7.93f, -9.63f, -5.15f, -8.01f, -8.04f, -9.59f, -5.29f } },
+        { 0x676572, { -8.44f, -7.69f, -7.26f, -9.62f, -8.55f, -8.49f, -8.09f } },
+        { 0x676573, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x676574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x676576, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x676577, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x67657A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x676765, { -9.54f, -9.63f, -9.66f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x676769, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x676820, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676865, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x676874, { -5.33f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x676964, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x676965, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676966, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x676967, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67696C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67696D, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x67696E, { -8.44f, -8.53f, -9.66f, -8.01f, -8.55f, -9.59f, -6.41f } },
+        { 0x67696F, { -7.14f, -7.23f, -7.26f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x676972, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -7.98f, -9.70f } },
+        { 0x676973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676975, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x6769E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x6769F3, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x676B65, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676C61, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676C65, { -9.54f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676C69, { -9.54f, -9.63f, -7.71f, -9.62f, -6.09f, -9.59f, -9.70f } },
+        { 0x676E61, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x676E65, { -9.54f, -8.02f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676E69, { -6.97f, -7.69f, -9.66f, -7.67f, -5.68f, -7.64f, -9.70f } },
+        { 0x676E6F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x676E74, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676F20, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -5.87f, -9.70f } },
+        { 0x676F64, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -7.31f } },
+        { 0x676F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x676F74, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x676F76, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677261, { -7.93f, -8.02f, -8.56f, -8.01f, -8.55f, -7.98f, -9.70f } },
+        { 0x677265, { -7.59f, -8.53f, -8.05f, -7.67f, -8.04f, -7.64f, -8.09f } },
+        { 0x677269, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x67726F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x677275, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6772E8, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6772F6, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6772FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677320, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677366, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677374, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x677375, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6773E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677420, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677561, { -7.93f, -9.63f, -9.66f, -6.78f, -6.51f, -6.64f, -9.70f } },
+        { 0x677565, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x677569, { -7.93f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x67756D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x67756E, { -9.54f, -9.63f, -6.44f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x677572, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.98f, -9.70f } },
+        { 0x677574, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6775E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -9.70f } },
+        { 0x67E36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x67E920, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67E965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67E96E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67E973, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x67FA6E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x67FC6C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682061, { -6.97f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x682062, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682064, { -7.93f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682065, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682066, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682067, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682068, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x682069, { -7.59f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68206A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68206C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68206E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68206F, { -7.34f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x682070, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x682072, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682073, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682074, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682075, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x682076, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68207A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686120, { -9.54f, -9.63f, -9.66f, -8.52f, -6.28f, -9.59f, -9.70f } },
+        { 0x686162, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686163, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686164, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686166, { -9.54f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68616C, { -6.24f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68616E, { -7.59f, -8.02f, -6.71f, -7.42f, -6.94f, -9.59f, -6.57f } },
+        { 0x686170, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x686172, { -7.59f, -8.53f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x686173, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686174, { -7.59f, -9.63f, -6.16f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686175, { -9.54f, -8.02f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686176, { -6.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686179, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x686265, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686520, { -4.60f, -9.63f, -6.95f, -9.62f, -5.93f, -8.49f, -8.09f } },
+        { 0x686561, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686562, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x686563, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x686564, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x686565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.15f } },
+        { 0x686567, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686569, { -7.34f, -9.63f, -5.90f, -9.62f, -9.65f, -9.59f, -5.77f } },
+        { 0x68656C, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68656D, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x68656E, { -8.44f, -9.63f, -5.48f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x686572, { -5.78f, -7.44f, -6.95f, -9.62f, -9.65f, -7.64f, -7.14f } },
+        { 0x686573, { -7.59f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686574, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -5.44f } },
+        { 0x686576, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x686579, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x686765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6867FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686865, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686961, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x686962, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x686963, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686965, { -7.93f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x686967, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68696C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68696D, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68696E, { -7.59f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686970, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686973, { -5.88f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686974, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x686B65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686C20, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686C65, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686C69, { -9.54f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686C6F, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686D20, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686D65, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686E20, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686E65, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686E75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F20, { -9.54f, -9.63f, -9.66f, -5.68f, -9.65f, -8.49f, -9.70f } },
+        { 0x686F62, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F67, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x686F68, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F69, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F6C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F6D, { -8.44f, -6.69f, -9.66f, -7.05f, -9.65f, -6.75f, -9.70f } },
+        { 0x686F6E, { -8.44f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x686F6F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x686F72, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x686F73, { -9.54f, -9.63f, -9.66f, -6.25f, -9.65f, -9.59f, -9.70f } },
+        { 0x686F75, { -6.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x687220, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687265, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687269, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68726C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68726F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687274, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6872E4, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687365, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687374, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687420, { -5.88f, -9.63f, -5.61f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x687461, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687465, { -9.54f, -9.63f, -5.99f, -9.62f, -9.65f, -9.59f, -5.90f } },
+        { 0x687467, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x687469, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x68746C, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68746E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x687470, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687473, { -6.17f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x687475, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x68756C, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x68756D, { -6.49f, -7.07f, -9.66f, -6.57f, -9.65f, -6.75f, -9.70f } },
+        { 0x68756E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x687574, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x687577, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x687765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68E46E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68E920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x68E972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68F663, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68F672, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x68FC74, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x692061, { -9.54f, -8.02f, -9.66f, -8.01f, -6.28f, -9.59f, -9.70f } },
+        { 0x692062, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x692063, { -9.54f, -8.02f, -9.66f, -9.62f, -6.15f, -8.49f, -9.70f } },
+        { 0x692064, { -9.54f, -7.23f, -7.46f, -7.67f, -5.57f, -9.59f, -9.70f } },
+        { 0x692065, { -9.54f, -7.69f, -8.56f, -9.62f, -6.09f, -8.49f, -9.70f } },
+        { 0x692066, { -9.54f, -9.63f, -8.56f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x692067, { -9.54f, -9.63f, -8.56f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x692068, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x692069, { -9.54f, -8.53f, -9.66f, -9.62f, -5.68f, -9.59f, -9.70f } },
+        { 0x69206C, { -9.54f, -8.02f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x69206D, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x69206E, { -9.54f, -9.63f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x69206F, { -9.54f, -9.63f, -8.56f, -9.62f, -6.81f, -8.49f, -9.70f } },
+        { 0x692070, { -9.54f, -9.63f, -9.66f, -9.62f, -6.51f, -8.49f, -9.70f } },
+        { 0x692071, { -9.54f, -8.53f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x692072, { -9.54f, -8.53f, -9.66f, -9.62f, -6.21f, -9.59f, -9.70f } },
+        { 0x692073, { -9.54f, -8.53f, -9.66f, -8.52f, -5.88f, -9.59f, -9.70f } },
+        { 0x692074, { -9.54f, -8.53f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x692075, { -9.54f, -9.63f, -7.71f, -9.62f, -6.15f, -9.59f, -9.70f } },
+        { 0x692076, { -9.54f, -8.53f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x69207A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6920E0, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6920E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696120, { -8.44f, -9.63f, -9.66f, -5.95f, -6.03f, -6.15f, -9.70f } },
+        { 0x696163, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x696166, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696167, { -7.59f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69616C, { -6.97f, -7.69f, -8.05f, -7.05f, -7.70f, -7.19f, -8.61f } },
+        { 0x69616D, { -9.54f, -9.63f, -9.66f, -7.67f, -7.70f, -7.64f, -9.70f } },
+        { 0x69616E, { -9.54f, -9.63f, -9.66f, -8.01f, -7.45f, -9.59f, -9.70f } },
+        { 0x696172, { -9.54f, -9.63f, -9.66f, -7.67f, -6.94f, -8.49f, -9.70f } },
+        { 0x696173, { -9.54f, -9.63f, -9.66f, -7.22f, -7.45f, -7.19f, -9.70f } },
+        { 0x696174, { -7.59f, -8.02f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x696176, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x69617A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6961E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x696265, { -8.44f, -6.41f, -8.56f, -6.18f, -6.03f, -6.29f, -9.70f } },
+        { 0x696269, { -8.44f, -9.63f, -9.66f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x696272, { -9.54f, -7.44f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x696275, { -7.93f, -8.53f, -9.66f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x6962E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696320, { -7.59f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696361, { -7.34f, -7.69f, -9.66f, -6.57f, -7.25f, -6.64f, -9.70f } },
+        { 0x696363, { -9.54f, -9.63f, -9.66f, -7.67f, -8.55f, -9.59f, -9.70f } },
+        { 0x696365, { -7.93f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x696368, { -7.14f, -9.63f, -5.00f, -8.52f, -6.94f, -9.59f, -7.00f } },
+        { 0x696369, { -9.54f, -8.02f, -9.66f, -6.67f, -8.55f, -8.49f, -9.70f } },
+        { 0x69636B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69636C, { -5.83f, -5.92f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69636F, { -9.54f, -9.63f, -9.66f, -8.01f, -5.53f, -7.39f, -9.70f } },
+        { 0x696374, { -7.93f, -6.80f, -9.66f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x696375, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x6963E1, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6963E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6963ED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x696420, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.66f } },
+        { 0x696461, { -9.54f, -9.63f, -9.66f, -5.95f, -9.65f, -5.69f, -9.70f } },
+        { 0x696464, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x696465, { -7.93f, -8.02f, -8.56f, -6.67f, -6.60f, -6.54f, -8.61f } },
+        { 0x696469, { -9.54f, -7.44f, -8.56f, -8.52f, -7.70f, -9.59f, -8.61f } },
+        { 0x69646F, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -6.75f, -9.70f } },
+        { 0x696475, { -8.44f, -7.44f, -9.66f, -6.91f, -5.71f, -8.49f, -8.61f } },
+        { 0x6964E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6964E9, { -9.54f, -6.59f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6964EA, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x696520, { -9.54f, -6.92f, -5.21f, -6.67f, -7.25f, -8.49f, -6.41f } },
+        { 0x696564, { -8.44f, -9.63f, -6.71f, -7.42f, -9.65f, -7.39f, -5.56f } },
+        { 0x696566, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696568, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x69656C, { -9.54f, -8.02f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x69656D, { -9.54f, -9.63f, -6.82f, -7.67f, -9.65f, -9.59f, -6.76f } },
+        { 0x69656E, { -7.14f, -6.80f, -7.71f, -5.32f, -6.70f, -8.49f, -7.00f } },
+        { 0x696572, { -7.93f, -7.69f, -7.46f, -6.91f, -8.04f, -9.59f, -8.61f } },
+        { 0x696573, { -7.93f, -7.44f, -6.36f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x696574, { -7.59f, -9.63f, -8.05f, -9.62f, -7.25f, -8.49f, -7.51f } },
+        { 0x696575, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696576, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6965DF, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696620, { -8.44f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696665, { -7.59f, -8.53f, -8.56f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x696666, { -9.54f, -9.63f, -8.05f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696669, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696674, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x696675, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x696720, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x696761, { -8.44f, -8.53f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x696764, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x696765, { -9.54f, -9.63f, -6.36f, -8.52f, -9.65f, -8.49f, -6.76f } },
+        { 0x696768, { -5.33f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x696769, { -6.97f, -7.07f, -7.26f, -6.91f, -7.08f, -7.02f, -7.14f } },
+        { 0x69676B, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69676C, { -9.54f, -9.63f, -9.66f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x69676E, { -7.34f, -7.23f, -9.66f, -7.67f, -7.70f, -7.64f, -9.70f } },
+        { 0x69676F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -5.87f, -9.70f } },
+        { 0x696774, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696775, { -9.54f, -9.63f, -6.82f, -6.78f, -8.04f, -6.75f, -9.70f } },
+        { 0x6967E9, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696865, { -9.54f, -9.63f, -6.29f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69686D, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69686E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696872, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696973, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696A20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.27f } },
+        { 0x696A64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x696A65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x696A68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.34f } },
+        { 0x696A6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.73f } },
+        { 0x696A6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x696A73, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696A76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x696A7A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x696B65, { -9.54f, -9.63f, -5.94f, -9.62f, -9.65f, -9.59f, -5.94f } },
+        { 0x696B6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696C20, { -8.44f, -7.44f, -9.66f, -8.52f, -5.93f, -8.49f, -9.70f } },
+        { 0x696C61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x696C64, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696C65, { -8.44f, -7.44f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x696C69, { -9.54f, -8.53f, -7.71f, -7.05f, -7.45f, -8.49f, -9.70f } },
+        { 0x696C6C, { -9.54f, -7.23f, -7.26f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x696C6F, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x696C73, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696C74, { -7.93f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696C75, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696C79, { -6.97f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696CE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696D20, { -7.93f, -9.63f, -8.05f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x696D61, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x696D65, { -7.34f, -8.02f, -9.66f, -8.52f, -7.08f, -6.64f, -9.70f } },
+        { 0x696D69, { -6.97f, -7.69f, -8.05f, -6.40f, -7.25f, -7.64f, -9.70f } },
+        { 0x696D6D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696D6F, { -9.54f, -9.63f, -9.66f, -7.42f, -7.45f, -9.59f, -9.70f } },
+        { 0x696D70, { -7.34f, -7.44f, -9.66f, -7.67f, -7.45f, -7.39f, -9.70f } },
+        { 0x696D73, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x696E20, { -5.53f, -8.02f, -5.61f, -7.05f, -6.09f, -9.59f, -5.59f } },
+        { 0x696E61, { -6.97f, -7.69f, -8.56f, -7.05f, -6.60f, -7.64f, -7.76f } },
+        { 0x696E62, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696E63, { -6.83f, -7.44f, -9.66f, -6.91f, -7.25f, -7.64f, -9.70f } },
+        { 0x696E64, { -6.97f, -6.92f, -7.26f, -6.91f, -5.60f, -6.64f, -7.51f } },
+        { 0x696E65, { -7.93f, -6.80f, -5.24f, -9.62f, -7.45f, -8.49f, -9.70f } },
+        { 0x696E66, { -8.44f, -8.02f, -8.56f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x696E67, { -6.10f, -9.63f, -7.26f, -9.62f, -8.55f, -6.64f, -4.84f } },
+        { 0x696E68, { -7.93f, -8.02f, -7.71f, -8.52f, -9.65f, -8.49f, -8.61f } },
+        { 0x696E69, { -7.59f, -7.44f, -7.26f, -7.22f, -6.94f, -7.64f, -8.61f } },
+        { 0x696E6A, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x696E6C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x696E6D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x696E6E, { -8.44f, -8.53f, -7.46f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x696E6F, { -9.54f, -9.63f, -9.66f, -8.52f, -7.70f, -7.64f, -9.70f } },
+        { 0x696E71, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x696E73, { -7.14f, -7.23f, -7.09f, -8.01f, -8.04f, -7.64f, -7.76f } },
+        { 0x696E74, { -6.71f, -6.80f, -6.82f, -7.42f, -7.08f, -6.88f, -7.51f } },
+        { 0x696E75, { -9.54f, -9.63f, -7.71f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696E76, { -8.44f, -8.53f, -9.66f, -8.01f, -8.55f, -7.98f, -9.70f } },
+        { 0x696E7A, { -9.54f, -9.63f, -8.05f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x696EE7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x696F20, { -9.54f, -9.63f, -9.66f, -6.32f, -6.94f, -7.39f, -9.70f } },
+        { 0x696F67, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x696F6C, { -7.93f, -8.02f, -9.66f, -8.52f, -8.04f, -7.98f, -9.70f } },
+        { 0x696F6D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x696F6E, { -4.62f, -4.64f, -6.16f, -5.72f, -4.92f, -6.54f, -6.57f } },
+        { 0x696F72, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x696F73, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.64f, -9.70f } },
+        { 0x697020, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x697065, { -9.54f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x697069, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x69706C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697175, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x697220, { -7.14f, -6.92f, -9.66f, -7.42f, -9.65f, -7.19f, -9.70f } },
+        { 0x697261, { -8.44f, -8.53f, -8.05f, -8.01f, -8.04f, -7.39f, -8.61f } },
+        { 0x697263, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x697264, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697265, { -9.54f, -6.50f, -9.66f, -9.62f, -8.04f, -5.22f, -9.70f } },
+        { 0x697267, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697269, { -8.44f, -8.53f, -9.66f, -9.62f, -5.30f, -9.59f, -9.70f } },
+        { 0x69726B, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69726C, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x69726D, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x69726E, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x697274, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6972E1, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x697320, { -5.46f, -7.23f, -8.56f, -9.62f, -9.65f, -6.09f, -6.76f } },
+        { 0x697361, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x697363, { -7.59f, -8.02f, -7.26f, -8.01f, -7.25f, -7.98f, -8.09f } },
+        { 0x697364, { -7.93f, -9.63f, -9.66f, -8.01f, -8.55f, -7.98f, -8.09f } },
+        { 0x697365, { -9.54f, -8.02f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x697366, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -8.49f, -9.70f } },
+        { 0x697368, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697369, { -8.44f, -8.53f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x69736B, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69736F, { -9.54f, -8.53f, -9.66f, -8.01f, -7.70f, -9.59f, -9.70f } },
+        { 0x697370, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x697372, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697373, { -7.93f, -6.50f, -7.71f, -9.62f, -7.70f, -7.02f, -8.61f } },
+        { 0x697374, { -7.93f, -7.69f, -6.61f, -7.22f, -7.45f, -7.19f, -9.70f } },
+        { 0x697375, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6973E8, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6973E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x697420, { -6.97f, -5.32f, -5.55f, -9.62f, -9.65f, -9.59f, -6.49f } },
+        { 0x697461, { -7.93f, -8.02f, -9.66f, -8.01f, -6.70f, -7.19f, -9.70f } },
+        { 0x697464, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x697465, { -7.14f, -7.44f, -6.95f, -9.62f, -7.45f, -9.59f, -7.31f } },
+        { 0x697467, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x697468, { -6.17f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697469, { -6.97f, -7.69f, -7.71f, -9.62f, -7.45f, -9.59f, -7.31f } },
+        { 0x69746C, { -6.97f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69746F, { -7.93f, -7.69f, -9.66f, -6.78f, -7.45f, -5.07f, -9.70f } },
+        { 0x697470, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697472, { -7.34f, -7.44f, -9.66f, -7.42f, -7.45f, -7.39f, -9.70f } },
+        { 0x697473, { -8.44f, -6.20f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x697474, { -7.93f, -8.53f, -8.05f, -9.62f, -5.20f, -9.59f, -8.61f } },
+        { 0x697475, { -7.59f, -7.23f, -9.66f, -7.42f, -7.70f, -6.75f, -8.61f } },
+        { 0x697479, { -6.49f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69747A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6974E0, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x6974E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6974E9, { -9.54f, -6.27f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6974F3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6974F9, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x697567, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x69756E, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x697572, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x697573, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x697574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x697661, { -7.93f, -9.63f, -8.05f, -6.91f, -7.25f, -6.88f, -9.70f } },
+        { 0x697665, { -6.49f, -7.07f, -9.66f, -7.42f, -7.45f, -7.64f, -8.61f } },
+        { 0x697669, { -8.44f, -7.23f, -9.66f, -7.22f, -5.75f, -7.98f, -8.61f } },
+        { 0x69766F, { -9.54f, -9.63f, -9.66f, -7.22f, -7.45f, -7.64f, -9.70f } },
+        { 0x697672, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6976E9, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6976ED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x697820, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697874, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x697A61, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x697A69, { -9.54f, -9.63f, -9.66f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x697A7A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x69E36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -9.70f } },
+        { 0x69E761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x69E7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x69E7F5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x69E872, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69E96E, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x69E974, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x69EA6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x69F36E, { -9.54f, -9.63f, -9.66f, -5.00f, -9.65f, -9.59f, -9.70f } },
+        { 0x69F565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x69F920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6A2061, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A2064, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A2065, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6A2068, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6A206D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A206F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A207A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6A6120, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.39f, -9.70f } },
+        { 0x6A616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6A616E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6172, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6A6420, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6A6465, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6A6469, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6473, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6520, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6563, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6564, { -9.54f, -9.63f, -5.99f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6567, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6A656C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6572, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6574, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6865, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.34f } },
+        { 0x6A6B20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x6A6B65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x6A6B68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6E20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.85f } },
+        { 0x6A6E65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A6F20, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A6F79, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A7320, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6A7564, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A7569, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6A756C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6A7572, { -7.93f, -7.44f, -9.66f, -7.42f, -9.65f, -7.39f, -8.09f } },
+        { 0x6A7573, { -8.44f, -8.02f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x6A7665, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6A7A65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B2061, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B2062, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B2064, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B2065, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B2067, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B2069, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B206B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B206C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B206D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B206F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6B2072, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B2074, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B2076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B207A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B616E, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6B6265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B6520, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.81f } },
+        { 0x6B6564, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B6565, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B6568, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B6569, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B656C, { -9.54f, -9.63f, -5.94f, -9.62f, -9.65f, -9.59f, -5.77f } },
+        { 0x6B656E, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x6B6572, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6B6575, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6B6865, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B696E, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6B6B65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B6B69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6B6C61, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6B6C65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B6C75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B6CE4, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B6F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B6F6D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6B6F6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B7261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B7269, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B72E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7320, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7361, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7369, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7420, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6B7465, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7469, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6B756C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B756E, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6B7A75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6BFC6E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6BFC72, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C2061, { -6.24f, -7.07f, -7.26f, -8.52f, -7.70f, -8.49f, -7.51f } },
+        { 0x6C2062, { -6.40f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C2063, { -7.59f, -8.53f, -9.66f, -8.01f, -8.55f, -7.64f, -9.70f } },
+        { 0x6C2064, { -8.44f, -7.44f, -8.56f, -6.32f, -6.70f, -7.02f, -8.61f } },
+        { 0x6C2065, { -7.93f, -6.59f, -9.66f, -7.22f, -8.55f, -7.19f, -6.34f } },
+        { 0x6C2066, { -8.44f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x6C2067, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C2068, { -7.93f, -6.69f, -8.56f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C2069, { -7.34f, -7.69f, -9.66f, -8.52f, -7.70f, -8.49f, -7.51f } },
+        { 0x6C206A, { -8.44f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C206C, { -8.44f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C206D, { -8.44f, -9.63f, -9.66f, -6.78f, -7.08f, -9.59f, -8.61f } },
+        { 0x6C206E, { -8.44f, -6.59f, -7.46f, -8.52f, -8.55f, -8.49f, -7.51f } },
+        { 0x6C206F, { -6.59f, -7.44f, -9.66f, -8.01f, -7.70f, -7.39f, -7.00f } },
+        { 0x6C2070, { -7.14f, -9.63f, -9.66f, -6.57f, -7.08f, -7.98f, -9.70f } },
+        { 0x6C2071, { -9.54f, -8.02f, -9.66f, -7.67f, -8.55f, -7.98f, -9.70f } },
+        { 0x6C2072, { -7.14f, -9.63f, -9.66f, -7.22f, -7.25f, -9.59f, -8.61f } },
+        { 0x6C2073, { -7.93f, -9.63f, -8.56f, -8.01f, -8.04f, -9.59f, -8.61f } },
+        { 0x6C2074, { -6.83f, -9.63f, -9.66f, -7.42f, -8.04f, -9.59f, -8.09f } },
+        { 0x6C2075, { -9.54f, -9.63f, -9.66f, -9.62f, -7.08f, -9.59f, -9.70f } },
+        { 0x6C2076, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -8.09f } },
+        { 0x6C2077, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C2079, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C207A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C20E2, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C20E9, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6120, { -9.54f, -5.02f, -9.66f, -4.85f, -4.83f, -6.88f, -9.70f } },
+        { 0x6C6161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6162, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6163, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6164, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6167, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6169, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C616D, { -9.54f, -7.44f, -9.66f, -7.67f, -8.04f, -7.39f, -8.61f } },
+        { 0x6C616E, { -8.44f, -8.02f, -7.26f, -9.62f, -8.55f, -9.59f, -7.00f } },
+        { 0x6C6172, { -7.14f, -7.23f, -9.66f, -7.22f, -9.65f, -7.02f, -7.51f } },
+        { 0x6C6173, { -8.44f, -9.63f, -8.05f, -6.78f, -8.55f, -8.49f, -9.70f } },
+        { 0x6C6174, { -7.59f, -8.02f, -9.66f, -9.62f, -8.04f, -9.59f, -7.76f } },
+        { 0x6C6175, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6176, { -7.59f, -7.69f, -7.71f, -7.67f, -9.65f, -9.59f, -7.76f } },
+        { 0x6C6177, { -6.71f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C61E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6C6220, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6273, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6368, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C636F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6375, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x6C6420, { -6.83f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6C6461, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x6C6465, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6469, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6520, { -5.61f, -4.79f, -6.52f, -7.67f, -5.33f, -8.49f, -6.21f } },
+        { 0x6C6561, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C6562, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6563, { -9.54f, -8.53f, -8.56f, -8.01f, -9.65f, -8.49f, -8.09f } },
+        { 0x6C6564, { -6.49f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6C6565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6C6567, { -9.54f, -9.63f, -8.56f, -8.52f, -7.25f, -8.49f, -8.09f } },
+        { 0x6C6568, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6569, { -9.54f, -7.69f, -6.36f, -9.62f, -9.65f, -7.19f, -8.09f } },
+        { 0x6C656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6C656D, { -9.54f, -7.69f, -8.56f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x6C656E, { -9.54f, -9.63f, -6.82f, -7.42f, -9.65f, -7.64f, -6.76f } },
+        { 0x6C656F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C6572, { -9.54f, -7.69f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6573, { -6.97f, -5.40f, -9.66f, -6.25f, -7.70f, -9.59f, -9.70f } },
+        { 0x6C6574, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6575, { -9.54f, -6.92f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6576, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -7.76f } },
+        { 0x6C6579, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C6620, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6662, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6764, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6765, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6769, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6C6774, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6775, { -9.54f, -9.63f, -8.05f, -7.67f, -9.65f, -7.64f, -9.70f } },
+        { 0x6C6865, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6C686F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6920, { -9.54f, -9.63f, -9.66f, -9.62f, -5.64f, -9.59f, -9.70f } },
+        { 0x6C6961, { -9.54f, -9.63f, -9.66f, -7.42f, -6.94f, -7.39f, -9.70f } },
+        { 0x6C6962, { -8.44f, -6.08f, -9.66f, -6.00f, -6.09f, -6.29f, -9.70f } },
+        { 0x6C6963, { -7.34f, -6.92f, -5.73f, -7.05f, -7.45f, -6.88f, -8.09f } },
+        { 0x6C6964, { -9.54f, -9.63f, -9.66f, -6.91f, -9.65f, -6.75f, -8.09f } },
+        { 0x6C6965, { -7.34f, -8.02f, -6.52f, -8.52f, -8.55f, -8.49f, -8.61f } },
+        { 0x6C6966, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6967, { -6.97f, -6.80f, -7.26f, -6.91f, -7.25f, -7.02f, -8.61f } },
+        { 0x6C696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.70f } },
+        { 0x6C696D, { -7.93f, -8.53f, -9.66f, -7.67f, -7.70f, -8.49f, -9.70f } },
+        { 0x6C696E, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -6.49f } },
+        { 0x6C696F, { -8.44f, -9.63f, -9.66f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x6C6971, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6972, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6974, { -6.71f, -6.59f, -7.71f, -7.67f, -6.94f, -7.64f, -7.00f } },
+        { 0x6C6976, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6C697A, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C69E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C69F3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6B20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6B61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C6B65, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x6C6BFC, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6C20, { -5.53f, -9.63f, -8.56f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x6C6C61, { -9.54f, -9.63f, -9.66f, -8.01f, -5.18f, -9.59f, -9.70f } },
+        { 0x6C6C65, { -7.93f, -6.08f, -6.10f, -9.62f, -7.25f, -9.59f, -5.94f } },
+        { 0x6C6C67, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6C69, { -8.44f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -7.51f } },
+        { 0x6C6C6B, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6C6F, { -9.54f, -9.63f, -9.66f, -8.52f, -7.45f, -9.59f, -9.70f } },
+        { 0x6C6C73, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6C75, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6D65, { -9.54f, -9.63f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x6C6E20, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6E65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6F20, { -9.54f, -9.63f, -9.66f, -5.76f, -5.68f, -7.39f, -9.70f } },
+        { 0x6C6F63, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6F69, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6F6E, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6F70, { -8.44f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C6F72, { -9.54f, -8.53f, -9.66f, -8.01f, -7.08f, -8.49f, -9.70f } },
+        { 0x6C6F73, { -9.54f, -9.63f, -8.05f, -5.64f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C6F74, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6C6F75, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7020, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C7061, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C7065, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C7175, { -9.54f, -8.53f, -9.66f, -6.91f, -9.65f, -7.19f, -9.70f } },
+        { 0x6C7320, { -8.44f, -7.44f, -7.09f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x6C7363, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7369, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x6C736D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C7420, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7461, { -9.54f, -9.63f, -8.05f, -9.62f, -7.70f, -7.39f, -9.70f } },
+        { 0x6C7465, { -8.44f, -7.69f, -7.26f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6C7468, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7469, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C746F, { -9.54f, -9.63f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6C7472, { -9.54f, -9.63f, -9.66f, -8.52f, -7.08f, -9.59f, -9.70f } },
+        { 0x6C7473, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7475, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C7479, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7520, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7563, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7564, { -7.59f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C7567, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C7569, { -9.54f, -7.69f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6C756D, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C756E, { -9.54f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C756F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C7570, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6C7573, { -9.54f, -7.07f, -9.66f, -8.52f, -7.70f, -9.59f, -9.70f } },
+        { 0x6C7574, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C7579, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6C75E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C7665, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6C7669, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6C7920, { -6.32f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE46E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE472, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE920, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE967, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6CE96D, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6CED6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6CED74, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x6CF673, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D2061, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -6.37f, -8.09f } },
+        { 0x6D2062, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D2063, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x6D2064, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -5.74f, -8.09f } },
+        { 0x6D2065, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x6D2066, { -7.59f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D2067, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6D2069, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x6D206A, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D206C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D206D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D206E, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -7.39f, -8.61f } },
+        { 0x6D206F, { -7.14f, -9.63f, -8.56f, -9.62f, -9.65f, -6.64f, -9.70f } },
+        { 0x6D2070, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -6.64f, -9.70f } },
+        { 0x6D2071, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6D2072, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6D2073, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -6.88f, -8.61f } },
+        { 0x6D2074, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -8.09f } },
+        { 0x6D2075, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D2076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6D2077, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6D207A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6D20F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6120, { -9.54f, -9.63f, -9.66f, -7.67f, -7.45f, -6.64f, -9.70f } },
+        { 0x6D6161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6D6163, { -9.54f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6164, { -8.44f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D6167, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -7.76f } },
+        { 0x6D6169, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6D616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D616E, { -6.24f, -8.02f, -6.71f, -6.48f, -6.43f, -6.54f, -6.57f } },
+        { 0x6D6172, { -7.34f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6173, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6D6174, { -8.44f, -8.02f, -8.56f, -7.22f, -7.25f, -8.49f, -8.61f } },
+        { 0x6D6179, { -7.93f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D617A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D61DF, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D61E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D6265, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6269, { -9.54f, -9.63f, -9.66f, -7.67f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D626C, { -7.93f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6D626F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D6272, { -9.54f, -7.69f, -9.66f, -6.57f, -7.70f, -7.64f, -9.70f } },
+        { 0x6D6420, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6D6462, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6D6520, { -7.59f, -6.08f, -8.56f, -8.52f, -7.25f, -7.64f, -8.61f } },
+        { 0x6D6561, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D6564, { -7.14f, -9.63f, -8.56f, -7.42f, -8.55f, -8.49f, -8.61f } },
+        { 0x6D6565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6D6569, { -9.54f, -8.53f, -6.52f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D656C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D656D, { -7.59f, -7.69f, -9.66f, -9.62f, -7.70f, -6.54f, -9.70f } },
+        { 0x6D656E, { -6.17f, -5.59f, -5.85f, -5.90f, -5.71f, -5.44f, -5.66f } },
+        { 0x6D6572, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6573, { -8.44f, -7.23f, -8.56f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6D6574, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -7.64f, -6.66f } },
+        { 0x6D657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D6920, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6963, { -9.54f, -8.02f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6D6964, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6D6965, { -9.54f, -8.53f, -9.66f, -6.32f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6967, { -9.54f, -9.63f, -9.66f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x6D696C, { -7.34f, -7.44f, -7.71f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D696E, { -6.83f, -8.02f, -8.05f, -7.42f, -7.08f, -7.98f, -6.66f } },
+        { 0x6D6973, { -8.44f, -7.07f, -9.66f, -7.22f, -7.70f, -7.02f, -8.61f } },
+        { 0x6D6974, { -7.34f, -8.53f, -6.52f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x6D6978, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6C75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6D65, { -9.54f, -6.20f, -7.26f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D6D69, { -7.93f, -7.44f, -9.66f, -9.62f, -8.04f, -9.59f, -8.61f } },
+        { 0x6D6D6C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6D6F, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6D75, { -8.44f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6EE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6F20, { -9.54f, -9.63f, -9.66f, -6.57f, -7.45f, -6.75f, -9.70f } },
+        { 0x6D6F64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6D6F6C, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D6F6D, { -9.54f, -8.02f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x6D6F6E, { -7.14f, -8.02f, -9.66f, -7.42f, -7.25f, -9.59f, -9.70f } },
+        { 0x6D6F72, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D6F74, { -7.34f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D6F76, { -8.44f, -9.63f, -9.66f, -8.01f, -8.55f, -7.98f, -9.70f } },
+        { 0x6D6F79, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D7061, { -7.93f, -8.53f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6D7065, { -7.59f, -9.63f, -9.66f, -8.01f, -7.70f, -7.98f, -9.70f } },
+        { 0x6D7066, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D706C, { -9.54f, -7.44f, -9.66f, -8.01f, -9.65f, -7.64f, -9.70f } },
+        { 0x6D706F, { -7.93f, -8.53f, -9.66f, -7.42f, -8.04f, -8.49f, -9.70f } },
+        { 0x6D7072, { -9.54f, -8.53f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D7074, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D70E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D70F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D7320, { -6.97f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D7365, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D7374, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6D7564, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D7565, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D756A, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6D756C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6D756D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6D756E, { -8.44f, -7.44f, -9.66f, -7.67f, -7.45f, -7.98f, -9.70f } },
+        { 0x6D756F, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x6D7574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6D7661, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6DE173, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE46E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE4DF, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE920, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE963, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE970, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DE973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DEA6D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DED6C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6DF667, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DFA6E, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6DFC68, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E2061, { -5.93f, -6.80f, -6.44f, -6.91f, -7.45f, -9.59f, -6.49f } },
+        { 0x6E2062, { -6.97f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -6.41f } },
+        { 0x6E2063, { -7.59f, -6.69f, -9.66f, -6.25f, -6.81f, -9.59f, -9.70f } },
+        { 0x6E2064, { -7.93f, -6.27f, -5.61f, -5.64f, -8.55f, -9.59f, -5.09f } },
+        { 0x6E2065, { -7.59f, -6.80f, -6.61f, -6.18f, -7.70f, -9.59f, -5.24f } },
+        { 0x6E2066, { -7.34f, -8.02f, -7.26f, -8.52f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E2067, { -9.54f, -9.63f, -5.99f, -9.62f, -9.65f, -9.59f, -5.70f } },
+        { 0x6E2068, { -7.93f, -8.53f, -6.71f, -9.62f, -9.65f, -9.59f, -5.73f } },
+        { 0x6E2069, { -7.34f, -9.63f, -6.22f, -8.52f, -6.81f, -9.59f, -5.56f } },
+        { 0x6E206A, { -9.54f, -9.63f, -7.26f, -7.67f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E206C, { -8.44f, -8.53f, -8.05f, -6.67f, -8.04f, -9.59f, -8.61f } },
+        { 0x6E206D, { -7.93f, -8.02f, -7.71f, -7.42f, -8.04f, -9.59f, -6.76f } },
+        { 0x6E206E, { -7.59f, -9.63f, -6.71f, -8.52f, -9.65f, -9.59f, -6.76f } },
+        { 0x6E206F, { -5.83f, -7.23f, -6.82f, -7.22f, -8.55f, -9.59f, -5.90f } },
+        { 0x6E2070, { -6.71f, -6.80f, -7.71f, -6.48f, -6.94f, -9.59f, -7.76f } },
+        { 0x6E2071, { -9.54f, -7.23f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E2072, { -7.14f, -8.02f, -7.09f, -7.42f, -8.55f, -9.59f, -7.51f } },
+        { 0x6E2073, { -7.34f, -7.23f, -5.65f, -7.42f, -7.70f, -9.59f, -6.34f } },
+        { 0x6E2074, { -5.93f, -7.23f, -8.56f, -7.05f, -8.55f, -9.59f, -5.94f } },
+        { 0x6E2075, { -8.44f, -8.02f, -5.99f, -8.01f, -8.04f, -9.59f, -9.70f } },
+        { 0x6E2076, { -8.44f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -5.15f } },
+        { 0x6E2077, { -7.14f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x6E2079, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E207A, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -5.85f } },
+        { 0x6E20E0, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E20E9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E20F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6120, { -9.54f, -9.63f, -9.66f, -5.57f, -5.80f, -6.22f, -9.70f } },
+        { 0x6E6161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x6E6162, { -8.44f, -8.53f, -8.05f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E6163, { -9.54f, -9.63f, -7.26f, -5.85f, -9.65f, -6.54f, -7.76f } },
+        { 0x6E6164, { -9.54f, -9.63f, -9.66f, -6.48f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6166, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E6168, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6169, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E616B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E616C, { -5.78f, -6.20f, -7.26f, -6.06f, -6.43f, -6.29f, -6.76f } },
+        { 0x6E616D, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6E616E, { -9.54f, -9.63f, -8.56f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x6E6172, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E6173, { -9.54f, -9.63f, -9.66f, -8.52f, -8.04f, -7.64f, -9.70f } },
+        { 0x6E6174, { -5.78f, -5.97f, -6.52f, -8.52f, -7.70f, -7.98f, -6.04f } },
+        { 0x6E617A, { -9.54f, -9.63f, -9.66f, -9.62f, -6.21f, -9.59f, -9.70f } },
+        { 0x6E61E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.88f, -9.70f } },
+        { 0x6E6261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6E6265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6365, { -5.98f, -6.41f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E6368, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E6369, { -7.93f, -8.53f, -9.66f, -5.81f, -7.70f, -6.64f, -9.70f } },
+        { 0x6E636C, { -7.59f, -8.53f, -9.66f, -7.67f, -7.45f, -8.49f, -9.70f } },
+        { 0x6E636F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6E6374, { -7.93f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E63ED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6420, { -4.65f, -9.63f, -4.61f, -9.62f, -9.65f, -9.59f, -6.04f } },
+        { 0x6E6461, { -6.83f, -6.80f, -9.66f, -6.91f, -6.81f, -7.02f, -7.51f } },
+        { 0x6E6462, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6465, { -6.59f, -7.23f, -5.81f, -7.42f, -7.45f, -7.19f, -5.15f } },
+        { 0x6E6466, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6468, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6469, { -7.59f, -7.23f, -7.46f, -6.48f, -5.57f, -6.75f, -7.76f } },
+        { 0x6E646C, { -8.44f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E646E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E646F, { -8.44f, -9.63f, -9.66f, -6.48f, -7.08f, -6.37f, -7.76f } },
+        { 0x6E6472, { -9.54f, -8.02f, -8.56f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6473, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E6474, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6475, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6476, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E64E9, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E64EA, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6520, { -5.53f, -5.04f, -5.65f, -6.12f, -5.03f, -9.59f, -8.09f } },
+        { 0x6E6563, { -8.44f, -9.63f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E6564, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6566, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6569, { -9.54f, -9.63f, -8.05f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E656C, { -8.44f, -9.63f, -9.66f, -9.62f, -6.15f, -9.59f, -9.70f } },
+        { 0x6E656D, { -9.54f, -7.44f, -8.05f, -9.62f, -9.65f, -7.64f, -8.09f } },
+        { 0x6E656E, { -9.54f, -9.63f, -6.22f, -7.42f, -9.65f, -8.49f, -7.31f } },
+        { 0x6E6572, { -8.44f, -9.63f, -5.99f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x6E6573, { -9.54f, -8.02f, -7.46f, -6.25f, -6.70f, -9.59f, -9.70f } },
+        { 0x6E6574, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6575, { -9.54f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E657A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6669, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E666C, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E666F, { -8.44f, -8.53f, -8.56f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E6672, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6674, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6720, { -6.04f, -9.63f, -5.02f, -9.62f, -9.65f, -9.59f, -4.96f } },
+        { 0x6E6761, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E6765, { -7.93f, -8.02f, -5.77f, -9.62f, -8.55f, -9.59f, -6.09f } },
+        { 0x6E6769, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x6E6772, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6773, { -7.59f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E6774, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6775, { -8.44f, -8.53f, -8.05f, -9.62f, -8.55f, -6.64f, -9.70f } },
+        { 0x6E6861, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6865, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -7.19f, -7.76f } },
+        { 0x6E686F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6875, { -8.44f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E68E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6920, { -9.54f, -7.23f, -9.66f, -7.22f, -5.13f, -9.59f, -9.70f } },
+        { 0x6E6961, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -7.98f, -9.70f } },
+        { 0x6E6963, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6964, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -6.75f, -9.70f } },
+        { 0x6E6965, { -8.44f, -7.44f, -6.36f, -9.62f, -9.65f, -9.59f, -6.34f } },
+        { 0x6E6966, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E6967, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x6E696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E696D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E696E, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -7.31f } },
+        { 0x6E696F, { -7.59f, -7.23f, -9.66f, -7.05f, -6.94f, -9.59f, -9.70f } },
+        { 0x6E6972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6973, { -8.44f, -8.53f, -8.56f, -8.52f, -8.55f, -9.59f, -8.09f } },
+        { 0x6E6974, { -6.40f, -7.23f, -8.56f, -9.62f, -6.81f, -9.59f, -8.61f } },
+        { 0x6E6975, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E6976, { -7.59f, -7.69f, -9.66f, -7.42f, -7.70f, -7.64f, -8.61f } },
+        { 0x6E697A, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6E69E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6E69F3, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E69F5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6A61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6A65, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6A6F, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6B62, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6B65, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E6B69, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6B74, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6B75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6C69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E6C79, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6D65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6E6D69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6E20, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6E61, { -9.54f, -7.23f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6E6E65, { -9.54f, -6.27f, -6.95f, -9.62f, -8.55f, -9.59f, -7.31f } },
+        { 0x6E6E69, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -8.09f } },
+        { 0x6E6E6F, { -8.44f, -8.53f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x6E6E74, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6E75, { -9.54f, -8.53f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6E79, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6F20, { -6.59f, -9.63f, -9.66f, -6.57f, -5.75f, -6.22f, -9.70f } },
+        { 0x6E6F63, { -8.44f, -8.53f, -8.56f, -7.05f, -8.55f, -8.49f, -7.76f } },
+        { 0x6E6F64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6F6C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E6F6D, { -9.54f, -8.53f, -8.05f, -8.52f, -8.55f, -7.98f, -8.61f } },
+        { 0x6E6F6E, { -7.93f, -8.53f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x6E6F72, { -7.59f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x6E6F73, { -9.54f, -9.63f, -9.66f, -6.78f, -7.25f, -7.02f, -9.70f } },
+        { 0x6E6F74, { -7.34f, -8.53f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E6F75, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E6F76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E6F77, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7061, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7175, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E7261, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6E7265, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7320, { -6.59f, -5.34f, -8.56f, -9.62f, -9.65f, -7.64f, -6.27f } },
+        { 0x6E7361, { -9.54f, -9.63f, -8.05f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x6E7362, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7363, { -7.59f, -7.69f, -5.81f, -9.62f, -9.65f, -7.64f, -7.31f } },
+        { 0x6E7365, { -8.44f, -7.44f, -8.56f, -7.42f, -7.70f, -8.49f, -7.31f } },
+        { 0x6E7366, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7368, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7369, { -9.54f, -6.69f, -9.66f, -6.91f, -6.81f, -6.54f, -9.70f } },
+        { 0x6E736F, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E7370, { -9.54f, -9.63f, -6.82f, -8.52f, -9.65f, -8.49f, -7.76f } },
+        { 0x6E7373, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7374, { -6.71f, -7.23f, -7.46f, -7.67f, -9.65f, -7.02f, -6.66f } },
+        { 0x6E73E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7420, { -6.10f, -4.79f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7461, { -7.34f, -7.44f, -9.66f, -7.42f, -7.45f, -7.39f, -8.09f } },
+        { 0x6E7462, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7465, { -6.40f, -6.20f, -6.22f, -5.64f, -5.75f, -5.51f, -6.76f } },
+        { 0x6E7468, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7469, { -6.40f, -7.44f, -8.56f, -8.52f, -7.25f, -7.64f, -8.09f } },
+        { 0x6E746C, { -8.44f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E746E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E746F, { -8.44f, -9.63f, -9.66f, -6.06f, -5.98f, -5.92f, -9.70f } },
+        { 0x6E7472, { -7.14f, -6.69f, -8.05f, -6.25f, -6.94f, -6.22f, -9.70f } },
+        { 0x6E7473, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7475, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7476, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7477, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E7479, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E747A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E74E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E74ED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7520, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7562, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7563, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E7569, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E756C, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E756D, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E756E, { -9.54f, -9.63f, -6.82f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6E7572, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7573, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6E7665, { -9.54f, -8.53f, -8.56f, -8.52f, -9.65f, -9.59f, -8.09f } },
+        { 0x6E7669, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6E766F, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -7.39f, -9.70f } },
+        { 0x6E7765, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6E77E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7920, { -6.32f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6E7A61, { -9.54f, -9.63f, -9.66f, -8.01f, -5.88f, -9.59f, -9.70f } },
+        { 0x6E7A65, { -9.54f, -9.63f, -8.05f, -9.62f, -8.04f, -9.59f, -8.09f } },
+        { 0x6E7A69, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x6E7A75, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EE176, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6EE36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.88f, -9.70f } },
+        { 0x6EE761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6EE7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6EE920, { -9.54f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6EE963, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EE966, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EE972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EED61, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EF36D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6EFA62, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F2061, { -6.59f, -9.63f, -9.66f, -5.38f, -5.53f, -5.69f, -9.70f } },
+        { 0x6F2062, { -7.59f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F2063, { -7.59f, -9.63f, -9.66f, -6.91f, -6.09f, -6.37f, -9.70f } },
+        { 0x6F2064, { -8.44f, -9.63f, -8.56f, -5.68f, -5.20f, -4.89f, -9.70f } },
+        { 0x6F2065, { -7.34f, -9.63f, -9.66f, -6.32f, -6.09f, -5.47f, -9.70f } },
+        { 0x6F2066, { -7.14f, -9.63f, -9.66f, -8.52f, -7.70f, -7.64f, -9.70f } },
+        { 0x6F2067, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x6F2068, { -7.59f, -9.63f, -9.66f, -9.62f, -6.35f, -6.88f, -9.70f } },
+        { 0x6F2069, { -9.54f, -9.63f, -9.66f, -6.78f, -5.80f, -6.54f, -9.70f } },
+        { 0x6F206A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F206C, { -7.59f, -9.63f, -9.66f, -7.05f, -7.08f, -8.49f, -9.70f } },
+        { 0x6F206D, { -7.59f, -9.63f, -9.66f, -8.01f, -9.65f, -7.19f, -9.70f } },
+        { 0x6F206E, { -9.54f, -9.63f, -9.66f, -6.78f, -6.43f, -6.54f, -9.70f } },
+        { 0x6F206F, { -6.40f, -9.63f, -9.66f, -7.67f, -5.84f, -6.15f, -9.70f } },
+        { 0x6F2070, { -7.34f, -9.63f, -9.66f, -6.78f, -5.93f, -5.97f, -9.70f } },
+        { 0x6F2071, { -9.54f, -9.63f, -9.66f, -7.22f, -7.70f, -6.54f, -9.70f } },
+        { 0x6F2072, { -7.34f, -9.63f, -9.66f, -7.67f, -7.70f, -7.02f, -9.70f } },
+        { 0x6F2073, { -7.34f, -9.63f, -9.66f, -6.18f, -6.03f, -6.29f, -9.70f } },
+        { 0x6F2074, { -7.34f, -9.63f, -9.66f, -5.72f, -7.08f, -5.69f, -9.70f } },
+        { 0x6F2075, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -7.64f, -9.70f } },
+        { 0x6F2076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F2077, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F2079, { -9.54f, -9.63f, -9.66f, -7.05f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F20E0, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -9.70f } },
+        { 0x6F20E8, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6F6120, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.37f, -9.70f } },
+        { 0x6F616C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x6F6220, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6F6265, { -9.54f, -9.63f, -8.56f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F626A, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F626C, { -8.44f, -8.02f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6272, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6F6273, { -7.59f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6361, { -9.54f, -8.53f, -9.66f, -7.67f, -8.55f, -7.64f, -9.70f } },
+        { 0x6F6365, { -8.44f, -8.53f, -9.66f, -8.52f, -8.04f, -7.64f, -9.70f } },
+        { 0x6F6368, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6369, { -6.71f, -6.92f, -9.66f, -6.48f, -6.94f, -7.02f, -8.61f } },
+        { 0x6F636C, { -7.93f, -7.44f, -9.66f, -7.67f, -8.04f, -7.39f, -8.61f } },
+        { 0x6F636F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6375, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x6F63E8, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6420, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F6461, { -9.54f, -9.63f, -9.66f, -6.06f, -8.55f, -6.29f, -9.70f } },
+        { 0x6F6465, { -9.54f, -9.63f, -5.85f, -9.62f, -8.55f, -6.88f, -8.09f } },
+        { 0x6F6469, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F646F, { -9.54f, -9.63f, -9.66f, -6.67f, -9.65f, -6.22f, -9.70f } },
+        { 0x6F6472, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6473, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6F6520, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6564, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6567, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F656C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F656E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6570, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x6F6573, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F6576, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6620, { -4.90f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.77f } },
+        { 0x6F6664, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6666, { -7.34f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F6672, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F6765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F6767, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F676C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F676E, { -7.59f, -9.63f, -9.66f, -9.62f, -5.80f, -9.59f, -9.70f } },
+        { 0x6F676F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F6772, { -7.93f, -8.02f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x6F6773, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6865, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6869, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F686C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F686E, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6874, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6920, { -9.54f, -7.23f, -9.66f, -9.62f, -8.04f, -7.98f, -9.70f } },
+        { 0x6F6962, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F6965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6972, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6974, { -9.54f, -5.14f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6976, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6B20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6B65, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6C61, { -7.93f, -8.53f, -8.56f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6F6C63, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6C64, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6C65, { -9.54f, -8.53f, -9.66f, -7.22f, -7.70f, -7.64f, -9.70f } },
+        { 0x6F6C67, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6F6C68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F6C69, { -7.59f, -8.02f, -7.71f, -9.62f, -6.70f, -9.59f, -7.76f } },
+        { 0x6F6C6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6F6C6C, { -9.54f, -8.53f, -7.71f, -8.52f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6C6F, { -8.44f, -9.63f, -9.66f, -8.01f, -5.88f, -8.49f, -9.70f } },
+        { 0x6F6C70, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F6C74, { -9.54f, -8.02f, -8.56f, -9.62f, -7.70f, -7.98f, -8.61f } },
+        { 0x6F6C75, { -8.44f, -8.02f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F6C76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x6F6CED, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x6F6D20, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -6.34f } },
+        { 0x6F6D61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6D62, { -9.54f, -9.63f, -9.66f, -7.05f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6D64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6D65, { -7.59f, -7.69f, -9.66f, -6.91f, -7.08f, -6.29f, -8.09f } },
+        { 0x6F6D69, { -8.44f, -8.02f, -9.66f, -7.42f, -8.04f, -7.19f, -8.61f } },
+        { 0x6F6D6D, { -6.97f, -6.08f, -8.05f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6F6D6F, { -7.34f, -9.63f, -9.66f, -6.48f, -7.45f, -6.75f, -9.70f } },
+        { 0x6F6D70, { -7.59f, -7.69f, -9.66f, -7.22f, -8.04f, -7.39f, -9.70f } },
+        { 0x6F6D73, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F6D75, { -9.54f, -9.63f, -9.66f, -8.01f, -6.94f, -7.39f, -9.70f } },
+        { 0x6F6D76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F6DFA, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6E20, { -4.74f, -5.02f, -6.29f, -7.22f, -6.51f, -9.59f, -8.09f } },
+        { 0x6F6E61, { -6.32f, -6.50f, -7.26f, -5.61f, -6.51f, -6.37f, -6.41f } },
+        { 0x6F6E63, { -9.54f, -8.02f, -9.66f, -7.22f, -7.70f, -8.49f, -9.70f } },
+        { 0x6F6E64, { -8.44f, -6.20f, -9.66f, -7.05f, -6.21f, -7.39f, -5.90f } },
+        { 0x6F6E65, { -5.53f, -9.63f, -7.09f, -6.32f, -5.25f, -9.59f, -9.70f } },
+        { 0x6F6E66, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F6E67, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6E68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x6F6E69, { -9.54f, -9.63f, -9.66f, -7.42f, -6.28f, -9.59f, -9.70f } },
+        { 0x6F6E6C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6E6D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6E6E, { -9.54f, -5.92f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x6F6E6F, { -8.44f, -8.53f, -9.66f, -7.22f, -6.35f, -9.59f, -9.70f } },
+        { 0x6F6E70, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6E71, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6E72, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F6E73, { -6.04f, -5.43f, -7.46f, -6.57f, -6.81f, -6.03f, -7.76f } },
+        { 0x6F6E74, { -7.59f, -5.70f, -9.66f, -6.67f, -6.94f, -6.64f, -7.14f } },
+        { 0x6F6E76, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.98f, -8.09f } },
+        { 0x6F6EF3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6F64, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F6F66, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6F67, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F6F6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6F6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F6F70, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F6F72, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.47f } },
+        { 0x6F6F74, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F7020, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.90f } },
+        { 0x6F7064, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F7065, { -7.34f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -7.76f } },
+        { 0x6F7067, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F7068, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F7069, { -7.59f, -7.44f, -9.66f, -6.91f, -7.70f, -7.64f, -9.70f } },
+        { 0x6F706C, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F706D, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F706E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F706F, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x6F7070, { -8.44f, -7.69f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F7072, { -9.54f, -8.02f, -9.66f, -8.52f, -6.81f, -7.64f, -9.70f } },
+        { 0x6F7073, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F7075, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F7076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F70E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F70F3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7175, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7220, { -5.36f, -9.63f, -7.46f, -6.06f, -8.55f, -6.29f, -5.66f } },
+        { 0x6F7261, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F7263, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F7264, { -7.93f, -8.53f, -8.56f, -9.62f, -9.65f, -8.49f, -5.81f } },
+        { 0x6F7265, { -7.34f, -9.63f, -8.05f, -9.62f, -6.94f, -7.98f, -7.51f } },
+        { 0x6F7266, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7267, { -8.44f, -8.02f, -8.56f, -8.52f, -8.55f, -8.49f, -7.76f } },
+        { 0x6F7269, { -7.93f, -8.02f, -9.66f, -6.91f, -7.70f, -8.49f, -8.61f } },
+        { 0x6F726C, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F726D, { -7.93f, -8.02f, -8.05f, -7.67f, -7.70f, -7.98f, -8.61f } },
+        { 0x6F726E, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F726F, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x6F7270, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F7272, { -8.44f, -8.53f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x6F7273, { -8.44f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x6F7274, { -7.14f, -7.23f, -7.71f, -7.67f, -7.25f, -7.64f, -7.76f } },
+        { 0x6F7275, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F7279, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F727A, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F72E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6F7320, { -9.54f, -9.63f, -9.66f, -4.47f, -9.65f, -4.39f, -9.70f } },
+        { 0x6F7361, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F7363, { -9.54f, -9.63f, -9.66f, -9.62f, -6.81f, -9.59f, -9.70f } },
+        { 0x6F7365, { -7.59f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7369, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F736F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.39f, -9.70f } },
+        { 0x6F7370, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7373, { -9.54f, -9.63f, -8.05f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x6F7374, { -9.54f, -9.63f, -9.66f, -9.62f, -6.60f, -9.59f, -9.70f } },
+        { 0x6F7420, { -7.59f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6F7461, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F7464, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x6F7465, { -6.71f, -7.44f, -8.56f, -7.22f, -8.04f, -7.19f, -7.51f } },
+        { 0x6F7468, { -6.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7469, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7472, { -9.54f, -9.63f, -9.66f, -7.42f, -6.70f, -9.59f, -9.70f } },
+        { 0x6F7473, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x6F7474, { -9.54f, -9.63f, -8.56f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x6F7477, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F74E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7520, { -9.54f, -5.97f, -9.66f, -9.62f, -9.65f, -5.74f, -9.70f } },
+        { 0x6F7564, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6F7567, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F756C, { -7.93f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F756D, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F756E, { -6.83f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7570, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7572, { -7.59f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7573, { -7.93f, -6.41f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7574, { -7.14f, -5.78f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x6F7576, { -9.54f, -8.02f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7577, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x6F7578, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F75E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7661, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x6F7665, { -7.34f, -9.63f, -9.66f, -8.01f, -7.45f, -7.98f, -6.57f } },
+        { 0x6F7669, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F766F, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -7.64f, -9.70f } },
+        { 0x6F7672, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x6F7720, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7761, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7765, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x6F7769, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F776E, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F776F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7920, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6F7A69, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x6FDF65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x6FED64, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x6FF920, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x702061, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x702062, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x702064, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x702065, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x702067, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x702068, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x702069, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x70206C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x70206D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x70206E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x702074, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x702075, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x702076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x702077, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x706162, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x706163, { -9.54f, -8.53f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x706165, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x706169, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70616C, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x70616E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706172, { -7.93f, -6.20f, -8.56f, -6.67f, -7.08f, -6.88f, -8.09f } },
+        { 0x706173, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x706179, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70617A, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x7061ED, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -7.19f, -9.70f } },
+        { 0x706369, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x706461, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x706561, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706563, { -7.93f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706565, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706567, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x706569, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x70656C, { -7.93f, -9.63f, -9.66f, -8.52f, -9.65f, -6.54f, -7.76f } },
+        { 0x70656D, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70656E, { -6.83f, -7.69f, -9.66f, -6.91f, -6.94f, -7.02f, -7.31f } },
+        { 0x70656F, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706572, { -6.59f, -6.14f, -7.71f, -5.95f, -6.09f, -7.39f, -7.31f } },
+        { 0x706573, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -6.29f, -9.70f } },
+        { 0x706574, { -8.44f, -9.63f, -9.66f, -7.67f, -7.08f, -8.49f, -9.70f } },
+        { 0x706575, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706576, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x706661, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70666C, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706765, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x706869, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x706920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x706965, { -9.54f, -9.63f, -9.66f, -8.01f, -7.70f, -9.59f, -9.70f } },
+        { 0x70696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x70696E, { -7.34f, -7.44f, -9.66f, -7.42f, -7.70f, -7.64f, -9.70f } },
+        { 0x70696F, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x706972, { -7.93f, -8.53f, -9.66f, -8.01f, -8.04f, -8.49f, -8.61f } },
+        { 0x7069F9, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x706C61, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x706C65, { -6.71f, -7.23f, -9.66f, -7.67f, -9.65f, -7.64f, -8.61f } },
+        { 0x706C69, { -8.44f, -7.07f, -9.66f, -7.42f, -8.55f, -7.39f, -8.61f } },
+        { 0x706C75, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706D65, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706E69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x706F20, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x706F63, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x706F64, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -6.88f, -9.70f } },
+        { 0x706F6C, { -7.59f, -8.02f, -7.71f, -8.01f, -7.08f, -7.98f, -7.76f } },
+        { 0x706F6E, { -7.93f, -8.53f, -9.66f, -8.01f, -8.55f, -8.49f, -9.70f } },
+        { 0x706F70, { -9.54f, -8.53f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x706F72, { -8.44f, -8.53f, -9.66f, -6.18f, -7.45f, -6.45f, -8.61f } },
+        { 0x706F73, { -7.93f, -9.63f, -9.66f, -8.01f, -6.94f, -8.49f, -9.70f } },
+        { 0x706F74, { -9.54f, -9.63f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x706F75, { -8.44f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x706F76, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x707061, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x707065, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x707069, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x70706C, { -8.44f, -8.02f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x70706F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x707072, { -8.44f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x707261, { -8.44f, -8.53f, -8.56f, -9.62f, -8.55f, -9.59f, -7.51f } },
+        { 0x707265, { -7.59f, -7.44f, -9.66f, -6.78f, -6.81f, -6.54f, -8.61f } },
+        { 0x707269, { -7.14f, -6.50f, -8.05f, -7.22f, -6.35f, -6.75f, -9.70f } },
+        { 0x70726F, { -5.88f, -6.20f, -9.66f, -5.85f, -5.93f, -5.74f, -8.61f } },
+        { 0x707275, { -9.54f, -9.63f, -6.82f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x7072E1, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x7072E8, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7072E9, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7072EA, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7072F3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x707365, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x707374, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x707420, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x707469, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70746F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x707562, { -7.59f, -7.69f, -9.66f, -9.62f, -7.70f, -8.49f, -9.70f } },
+        { 0x707565, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x70756C, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x70756E, { -8.44f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x707572, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x707574, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x7075F2, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x70766F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x70E7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x70E96E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70E972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70E974, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70ED72, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x70F373, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x70F672, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x70FA62, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x717520, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x717561, { -6.71f, -8.53f, -9.66f, -9.62f, -6.81f, -7.19f, -9.70f } },
+        { 0x717565, { -9.54f, -5.59f, -9.66f, -5.90f, -6.60f, -5.38f, -9.70f } },
+        { 0x717569, { -9.54f, -6.59f, -9.66f, -6.91f, -9.65f, -7.98f, -9.70f } },
+        { 0x7175E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x722061, { -6.59f, -8.53f, -7.26f, -6.91f, -8.55f, -6.64f, -7.76f } },
+        { 0x722062, { -7.59f, -9.63f, -6.71f, -8.52f, -9.65f, -9.59f, -8.09f } },
+        { 0x722063, { -7.93f, -9.63f, -8.56f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x722064, { -7.93f, -6.27f, -6.61f, -6.91f, -9.65f, -6.64f, -6.04f } },
+        { 0x722065, { -8.44f, -7.07f, -6.82f, -7.22f, -9.65f, -6.88f, -7.31f } },
+        { 0x722066, { -7.34f, -8.53f, -7.71f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x722067, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x722068, { -7.93f, -9.63f, -6.16f, -8.52f, -9.65f, -9.59f, -6.21f } },
+        { 0x722069, { -7.14f, -9.63f, -7.26f, -7.67f, -9.65f, -7.64f, -7.76f } },
+        { 0x72206A, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72206B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72206C, { -8.44f, -6.59f, -8.56f, -7.42f, -7.70f, -8.49f, -9.70f } },
+        { 0x72206D, { -9.54f, -9.63f, -6.61f, -7.42f, -9.65f, -7.64f, -9.70f } },
+        { 0x72206E, { -8.44f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -8.09f } },
+        { 0x72206F, { -7.34f, -9.63f, -7.26f, -7.22f, -9.65f, -6.88f, -7.14f } },
+        { 0x722070, { -7.59f, -8.02f, -7.71f, -8.01f, -8.55f, -7.19f, -9.70f } },
+        { 0x722071, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x722072, { -7.93f, -8.53f, -7.46f, -9.62f, -8.04f, -8.49f, -8.09f } },
+        { 0x722073, { -6.71f, -7.69f, -6.36f, -7.67f, -9.65f, -8.49f, -8.61f } },
+        { 0x722074, { -6.97f, -7.69f, -8.56f, -9.62f, -8.55f, -7.98f, -8.61f } },
+        { 0x722075, { -7.93f, -7.44f, -7.46f, -7.67f, -8.55f, -7.64f, -9.70f } },
+        { 0x722076, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x722077, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x722079, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x72207A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x7220FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726120, { -9.54f, -6.92f, -9.66f, -6.06f, -7.08f, -5.92f, -9.70f } },
+        { 0x726161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x726163, { -7.59f, -8.02f, -8.05f, -7.05f, -9.65f, -9.59f, -8.61f } },
+        { 0x726164, { -7.93f, -8.53f, -9.66f, -7.22f, -8.55f, -7.64f, -9.70f } },
+        { 0x726165, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x726166, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x726167, { -8.44f, -8.53f, -9.66f, -9.62f, -7.70f, -9.59f, -8.61f } },
+        { 0x726169, { -9.54f, -6.50f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72616A, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x72616B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x72616C, { -7.93f, -8.53f, -8.05f, -8.01f, -8.04f, -7.64f, -8.61f } },
+        { 0x72616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x72616E, { -7.59f, -6.50f, -8.05f, -6.48f, -7.08f, -6.29f, -7.76f } },
+        { 0x726170, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x726172, { -7.14f, -9.63f, -8.56f, -7.22f, -7.25f, -6.88f, -9.70f } },
+        { 0x726173, { -9.54f, -9.63f, -8.05f, -7.67f, -9.65f, -8.49f, -8.09f } },
+        { 0x726174, { -6.97f, -6.69f, -8.05f, -7.42f, -6.35f, -7.64f, -8.61f } },
+        { 0x726175, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726176, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -7.19f, -9.70f } },
+        { 0x72617A, { -9.54f, -9.63f, -9.66f, -7.67f, -6.70f, -7.98f, -9.70f } },
+        { 0x7261E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -9.70f } },
+        { 0x726261, { -8.44f, -8.53f, -8.56f, -8.52f, -8.55f, -9.59f, -8.09f } },
+        { 0x726265, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726269, { -7.34f, -7.44f, -9.66f, -7.42f, -7.45f, -7.39f, -7.51f } },
+        { 0x72626C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x72626F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x726272, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7262E1, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x726361, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x726365, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x726368, { -9.54f, -8.02f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726369, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x726375, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x726420, { -7.93f, -8.53f, -8.05f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x726461, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.37f, -9.70f } },
+        { 0x726465, { -8.44f, -9.63f, -5.90f, -9.62f, -9.65f, -8.49f, -5.77f } },
+        { 0x726469, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x72646C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72646F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x726472, { -9.54f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726473, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726474, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x726520, { -6.24f, -5.63f, -7.26f, -6.57f, -5.16f, -7.39f, -6.21f } },
+        { 0x726561, { -6.32f, -9.63f, -9.66f, -8.01f, -7.08f, -8.49f, -9.70f } },
+        { 0x726562, { -8.44f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x726563, { -7.14f, -6.92f, -5.26f, -5.08f, -9.65f, -6.75f, -5.26f } },
+        { 0x726564, { -8.44f, -9.63f, -8.56f, -9.62f, -7.70f, -9.59f, -7.76f } },
+        { 0x726565, { -5.98f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -7.76f } },
+        { 0x726566, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x726567, { -7.93f, -8.53f, -8.56f, -8.52f, -9.65f, -7.98f, -8.61f } },
+        { 0x726569, { -8.44f, -9.63f, -5.51f, -9.62f, -9.65f, -5.22f, -7.76f } },
+        { 0x72656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x72656C, { -6.97f, -6.92f, -7.26f, -7.05f, -7.25f, -7.02f, -8.09f } },
+        { 0x72656D, { -8.44f, -7.07f, -9.66f, -8.01f, -9.65f, -7.98f, -8.61f } },
+        { 0x72656E, { -7.34f, -8.53f, -6.10f, -7.67f, -7.70f, -8.49f, -5.56f } },
+        { 0x726570, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x726572, { -9.54f, -7.69f, -7.46f, -9.62f, -8.55f, -7.98f, -9.70f } },
+        { 0x726573, { -6.24f, -5.70f, -9.66f, -5.81f, -6.51f, -5.65f, -8.61f } },
+        { 0x726574, { -8.44f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x726575, { -9.54f, -8.53f, -8.05f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x726576, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -8.09f } },
+        { 0x72657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0x726620, { -9.54f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726661, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726665, { -7.59f, -9.63f, -8.56f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x72666F, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7266FC, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726761, { -8.44f, -8.02f, -8.56f, -8.52f, -8.55f, -8.49f, -7.51f } },
+        { 0x726765, { -7.59f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x7267E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x726861, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726865, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x72686F, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7268E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726920, { -9.54f, -9.63f, -9.66f, -9.62f, -6.35f, -9.59f, -9.70f } },
+        { 0x726961, { -7.34f, -7.69f, -9.66f, -6.78f, -6.81f, -6.75f, -9.70f } },
+        { 0x726962, { -7.93f, -8.53f, -9.66f, -8.01f, -7.70f, -8.49f, -9.70f } },
+        { 0x726963, { -9.54f, -8.53f, -7.71f, -8.52f, -6.70f, -9.59f, -9.70f } },
+        { 0x726964, { -9.54f, -7.44f, -9.66f, -8.52f, -7.70f, -9.59f, -8.61f } },
+        { 0x726965, { -7.59f, -7.69f, -8.05f, -8.52f, -7.08f, -7.64f, -8.09f } },
+        { 0x726966, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726967, { -5.33f, -8.02f, -7.26f, -7.67f, -7.70f, -7.64f, -7.31f } },
+        { 0x72696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.90f } },
+        { 0x72696C, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72696D, { -7.14f, -7.69f, -8.05f, -7.05f, -7.08f, -7.64f, -9.70f } },
+        { 0x72696E, { -7.59f, -8.53f, -9.66f, -8.01f, -8.55f, -8.49f, -6.87f } },
+        { 0x72696F, { -9.54f, -9.63f, -9.66f, -7.42f, -7.25f, -7.19f, -9.70f } },
+        { 0x726970, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x726973, { -7.59f, -7.69f, -9.66f, -8.01f, -7.25f, -7.98f, -8.61f } },
+        { 0x726974, { -7.34f, -7.07f, -8.56f, -7.42f, -5.20f, -7.02f, -9.70f } },
+        { 0x726975, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x726976, { -7.14f, -7.44f, -8.05f, -7.42f, -7.25f, -7.39f, -9.70f } },
+        { 0x7269E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7269E9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726B61, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726B65, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x726B69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x726B6C, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x726B6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726B73, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726B74, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726B75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726BFC, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726C61, { -9.54f, -9.63f, -8.05f, -8.52f, -9.65f, -9.59f, -8.61f } },
+        { 0x726C64, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726C65, { -9.54f, -8.53f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726C69, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x726D20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726D61, { -8.44f, -8.53f, -8.56f, -7.67f, -7.70f, -7.98f, -9.70f } },
+        { 0x726D64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x726D65, { -8.44f, -8.53f, -8.56f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x726D69, { -7.93f, -8.02f, -9.66f, -8.52f, -8.55f, -9.59f, -7.51f } },
+        { 0x726D6F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726D73, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726DF6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726E20, { -7.93f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726E61, { -7.59f, -7.69f, -7.71f, -7.42f, -7.45f, -7.64f, -7.76f } },
+        { 0x726E65, { -9.54f, -9.63f, -8.56f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x726E69, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -8.49f, -8.09f } },
+        { 0x726E6F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x726E75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x726F20, { -9.54f, -9.63f, -9.66f, -8.52f, -6.43f, -8.49f, -9.70f } },
+        { 0x726F63, { -7.93f, -7.23f, -9.66f, -7.67f, -7.70f, -6.75f, -8.61f } },
+        { 0x726F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x726F67, { -7.93f, -8.02f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x726F68, { -8.44f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x726F69, { -9.54f, -5.26f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x726F6C, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x726F6D, { -6.71f, -9.63f, -9.66f, -7.22f, -7.70f, -7.02f, -9.70f } },
+        { 0x726F6E, { -8.44f, -7.69f, -9.66f, -8.01f, -8.55f, -8.49f, -7.51f } },
+        { 0x726F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x726F70, { -7.59f, -8.02f, -9.66f, -7.42f, -6.81f, -7.98f, -8.61f } },
+        { 0x726F72, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x726F73, { -8.44f, -9.63f, -9.66f, -7.22f, -9.65f, -7.02f, -9.70f } },
+        { 0x726F74, { -6.97f, -7.23f, -9.66f, -7.22f, -8.04f, -7.19f, -8.61f } },
+        { 0x726F75, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x726F76, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x727065, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.09f } },
+        { 0x727066, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72706C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x72706F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727261, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x727265, { -7.93f, -8.02f, -8.56f, -8.52f, -8.04f, -8.49f, -8.09f } },
+        { 0x727269, { -7.14f, -7.69f, -8.56f, -7.42f, -7.70f, -7.64f, -9.70f } },
+        { 0x72726F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x727273, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727279, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7272EA, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727320, { -7.14f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727361, { -7.59f, -9.63f, -7.71f, -7.67f, -7.70f, -7.64f, -9.70f } },
+        { 0x727363, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x727365, { -7.93f, -7.69f, -9.66f, -7.05f, -8.04f, -8.49f, -8.09f } },
+        { 0x727368, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727369, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x72736F, { -7.34f, -6.27f, -7.71f, -6.00f, -6.81f, -7.39f, -7.76f } },
+        { 0x727374, { -8.44f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x727375, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7273E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727420, { -7.93f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x727461, { -8.44f, -8.53f, -8.56f, -6.06f, -7.70f, -8.49f, -9.70f } },
+        { 0x727464, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x727465, { -8.44f, -8.02f, -7.71f, -8.01f, -8.04f, -8.49f, -8.61f } },
+        { 0x727468, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727469, { -5.78f, -5.74f, -5.85f, -8.52f, -5.84f, -5.82f, -5.90f } },
+        { 0x72746F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x727473, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727475, { -8.44f, -8.02f, -9.66f, -8.52f, -8.55f, -7.98f, -7.76f } },
+        { 0x727479, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7274E0, { -9.54f, -9.63f, -9.66f, -9.62f, -6.21f, -9.59f, -9.70f } },
+        { 0x7274E2, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7274E9, { -9.54f, -6.41f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7274ED, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -9.59f, -9.70f } },
+        { 0x727563, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727564, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x727565, { -8.44f, -8.53f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x727566, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727567, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x727569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x72756B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x72756C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72756E, { -9.54f, -9.63f, -5.90f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727572, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727573, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x727574, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x7275E9, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x727661, { -7.59f, -9.63f, -9.66f, -8.52f, -8.04f, -9.59f, -8.09f } },
+        { 0x727669, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x72766F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x727672, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x727765, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x727769, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x72776F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x727920, { -6.24f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72796F, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727977, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727A61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x727A65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x727A69, { -9.54f, -9.63f, -8.56f, -9.62f, -8.04f, -9.59f, -8.61f } },
+        { 0x72E020, { -9.54f, -9.63f, -9.66f, -9.62f, -6.51f, -9.59f, -9.70f } },
+        { 0x72E120, { -9.54f, -9.63f, -9.66f, -6.40f, -9.65f, -7.02f, -9.70f } },
+        { 0x72E163, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E16E, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E172, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x72E174, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x72E463, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E466, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E46E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E475, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E873, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E965, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E967, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E96D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x72E970, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E973, { -9.54f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E975, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72E976, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72EA6D, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72EA74, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72ED64, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x72ED6E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x72F370, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x72F6DF, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72FC63, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72FC64, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x72FC6E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x732061, { -5.73f, -6.50f, -8.05f, -6.67f, -9.65f, -6.29f, -8.61f } },
+        { 0x732062, { -7.93f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x732063, { -7.34f, -6.69f, -9.66f, -6.67f, -9.65f, -6.64f, -9.70f } },
+        { 0x732064, { -6.97f, -5.24f, -7.46f, -5.61f, -9.65f, -5.35f, -7.14f } },
+        { 0x732065, { -7.14f, -5.87f, -7.71f, -6.00f, -9.65f, -5.69f, -7.00f } },
+        { 0x732066, { -7.34f, -6.92f, -8.56f, -7.22f, -9.65f, -7.02f, -9.70f } },
+        { 0x732067, { -7.93f, -8.02f, -7.71f, -8.01f, -9.65f, -7.98f, -8.61f } },
+        { 0x732068, { -7.14f, -7.23f, -8.56f, -6.78f, -9.65f, -7.19f, -8.09f } },
+        { 0x732069, { -7.14f, -6.92f, -9.66f, -6.78f, -9.65f, -7.02f, -7.76f } },
+        { 0x73206A, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x73206B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x73206C, { -9.54f, -5.63f, -7.46f, -7.05f, -9.65f, -7.64f, -8.61f } },
+        { 0x73206D, { -8.44f, -7.44f, -8.05f, -7.42f, -9.65f, -7.39f, -8.61f } },
+        { 0x73206E, { -6.97f, -6.59f, -8.05f, -6.48f, -9.65f, -6.37f, -8.09f } },
+        { 0x73206F, { -6.04f, -6.41f, -8.56f, -6.67f, -9.65f, -5.92f, -7.31f } },
+        { 0x732070, { -7.59f, -6.34f, -9.66f, -6.32f, -9.65f, -6.22f, -8.61f } },
+        { 0x732071, { -9.54f, -8.02f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x732072, { -6.71f, -7.69f, -5.99f, -8.52f, -9.65f, -7.64f, -8.61f } },
+        { 0x732073, { -7.59f, -6.34f, -8.56f, -6.78f, -9.65f, -6.37f, -9.70f } },
+        { 0x732074, { -5.57f, -7.44f, -9.66f, -7.42f, -9.65f, -7.02f, -7.51f } },
+        { 0x732075, { -7.59f, -6.92f, -7.46f, -7.22f, -9.65f, -7.64f, -9.70f } },
+        { 0x732076, { -8.44f, -8.53f, -7.46f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x732077, { -7.34f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x732079, { -9.54f, -8.53f, -9.66f, -6.18f, -9.65f, -9.59f, -9.70f } },
+        { 0x73207A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x7320E0, { -9.54f, -6.92f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7320E9, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7320EA, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7320F3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x736120, { -9.54f, -6.20f, -9.66f, -8.01f, -7.70f, -7.98f, -9.70f } },
+        { 0x736162, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x736163, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x736164, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x736167, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736169, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x73616C, { -7.59f, -9.63f, -9.66f, -7.42f, -7.70f, -7.98f, -9.70f } },
+        { 0x73616D, { -9.54f, -9.63f, -6.82f, -8.01f, -9.65f, -7.64f, -8.61f } },
+        { 0x73616E, { -9.54f, -6.59f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736172, { -8.44f, -9.63f, -9.66f, -7.42f, -7.25f, -7.98f, -9.70f } },
+        { 0x736173, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x736174, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -8.49f, -8.61f } },
+        { 0x7361E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x736265, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736361, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x736365, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x736368, { -9.54f, -9.63f, -4.88f, -9.62f, -7.70f, -9.59f, -5.77f } },
+        { 0x736369, { -7.59f, -7.69f, -9.66f, -9.62f, -6.51f, -7.39f, -9.70f } },
+        { 0x73636C, { -9.54f, -7.69f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x73636F, { -9.54f, -9.63f, -9.66f, -8.52f, -8.04f, -7.98f, -9.70f } },
+        { 0x736372, { -7.59f, -8.02f, -9.66f, -8.01f, -7.70f, -7.19f, -9.70f } },
+        { 0x736469, { -7.93f, -9.63f, -8.56f, -8.01f, -8.55f, -7.98f, -7.14f } },
+        { 0x736472, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736520, { -7.34f, -7.07f, -7.26f, -6.00f, -7.08f, -7.02f, -8.61f } },
+        { 0x736561, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x736563, { -7.34f, -9.63f, -9.66f, -8.01f, -7.70f, -9.59f, -9.70f } },
+        { 0x736564, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736565, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736567, { -9.54f, -9.63f, -9.66f, -7.22f, -7.70f, -7.64f, -9.70f } },
+        { 0x736569, { -9.54f, -8.02f, -5.85f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73656A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.02f, -9.70f } },
+        { 0x73656C, { -7.59f, -7.69f, -6.95f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x73656D, { -7.93f, -7.69f, -9.66f, -9.62f, -8.55f, -7.02f, -9.70f } },
+        { 0x73656E, { -7.59f, -6.92f, -6.71f, -7.42f, -6.70f, -6.75f, -7.14f } },
+        { 0x736572, { -7.34f, -6.69f, -7.46f, -6.18f, -6.03f, -6.09f, -9.70f } },
+        { 0x736573, { -7.93f, -7.69f, -7.46f, -9.62f, -8.55f, -7.98f, -9.70f } },
+        { 0x736574, { -8.44f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736575, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.02f, -9.70f } },
+        { 0x736578, { -8.44f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x7365F1, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x736661, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x73666F, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x736672, { -9.54f, -9.63f, -7.71f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x7366E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736765, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736861, { -6.24f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736865, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736869, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73686D, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73686F, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736875, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736920, { -9.54f, -8.02f, -9.66f, -8.52f, -6.35f, -9.59f, -9.70f } },
+        { 0x736961, { -9.54f, -9.63f, -9.66f, -9.62f, -6.43f, -9.59f, -9.70f } },
+        { 0x736962, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x736963, { -9.54f, -9.63f, -6.95f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x736964, { -8.44f, -6.69f, -9.66f, -6.78f, -6.81f, -6.64f, -9.70f } },
+        { 0x736965, { -9.54f, -8.53f, -8.05f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x73696C, { -9.54f, -8.02f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x73696D, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x73696E, { -8.44f, -9.63f, -7.46f, -7.42f, -8.55f, -7.98f, -7.76f } },
+        { 0x73696F, { -7.59f, -7.44f, -9.66f, -8.52f, -7.45f, -9.59f, -9.70f } },
+        { 0x736972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736973, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736974, { -9.54f, -8.53f, -8.56f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x736976, { -8.44f, -8.53f, -9.66f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x73697A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x7369F3, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x736B6C, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736B72, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736C61, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x736C65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736C6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x736D65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736D6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x736F20, { -9.54f, -9.63f, -8.56f, -6.78f, -6.43f, -6.29f, -9.70f } },
+        { 0x736F61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.29f, -9.70f } },
+        { 0x736F62, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.39f, -9.70f } },
+        { 0x736F63, { -6.71f, -6.92f, -9.66f, -7.05f, -6.94f, -7.02f, -8.61f } },
+        { 0x736F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x736F66, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x736F67, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x736F69, { -9.54f, -6.92f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736F6C, { -8.44f, -8.02f, -7.71f, -8.52f, -8.04f, -7.98f, -9.70f } },
+        { 0x736F6D, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -8.61f } },
+        { 0x736F6E, { -7.14f, -5.74f, -7.09f, -6.06f, -6.81f, -8.49f, -9.70f } },
+        { 0x736F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x736F72, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736F73, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x736F74, { -9.54f, -9.63f, -9.66f, -9.62f, -7.25f, -9.59f, -9.70f } },
+        { 0x736F75, { -9.54f, -7.07f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736F76, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x736F77, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x736F7A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x737065, { -7.59f, -8.02f, -9.66f, -8.01f, -7.08f, -7.98f, -9.70f } },
+        { 0x737069, { -7.93f, -8.53f, -9.66f, -8.01f, -8.04f, -8.49f, -8.61f } },
+        { 0x73706F, { -7.93f, -8.53f, -9.66f, -8.01f, -8.04f, -7.98f, -8.61f } },
+        { 0x737072, { -9.54f, -8.02f, -6.71f, -8.52f, -8.04f, -8.49f, -7.76f } },
+        { 0x7370ED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x737175, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737265, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737320, { -7.93f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737361, { -8.44f, -6.92f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x737365, { -7.34f, -7.07f, -6.71f, -9.62f, -5.98f, -7.02f, -7.76f } },
+        { 0x737369, { -7.34f, -7.07f, -9.66f, -9.62f, -6.60f, -7.98f, -8.09f } },
+        { 0x73736F, { -7.34f, -7.44f, -9.66f, -9.62f, -7.08f, -5.82f, -9.70f } },
+        { 0x737374, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x737375, { -9.54f, -7.69f, -8.05f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x7373E1, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7373E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x7373F5, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x737420, { -6.40f, -7.07f, -6.44f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x737461, { -6.49f, -7.69f, -6.44f, -6.57f, -5.98f, -6.64f, -6.41f } },
+        { 0x737465, { -9.54f, -8.53f, -6.82f, -7.42f, -8.04f, -7.39f, -6.41f } },
+        { 0x737467, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x737469, { -7.14f, -6.92f, -8.05f, -6.78f, -6.60f, -6.75f, -7.14f } },
+        { 0x73746F, { -9.54f, -9.63f, -8.56f, -7.42f, -7.45f, -8.49f, -9.70f } },
+        { 0x737472, { -8.44f, -8.53f, -6.61f, -8.01f, -7.70f, -8.49f, -6.41f } },
+        { 0x737473, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x737475, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7374E1, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x7374E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7374F6, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737520, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -9.59f, -9.70f } },
+        { 0x737561, { -9.54f, -9.63f, -9.66f, -9.62f, -6.51f, -6.09f, -9.70f } },
+        { 0x737562, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x737563, { -7.59f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737565, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x737569, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x73756A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x73756C, { -8.44f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x73756D, { -8.44f, -8.53f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x73756E, { -9.54f, -9.63f, -7.71f, -9.62f, -6.60f, -9.59f, -9.70f } },
+        { 0x73756F, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x737570, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -8.61f } },
+        { 0x737572, { -8.44f, -6.92f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x737573, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x737669, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x73796C, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x737A69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x73E172, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x73E36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x73E463, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E474, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E475, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E872, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E963, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E965, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73E972, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x73ED20, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x73F36C, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x73F565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x73FB72, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x73FC62, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x742061, { -6.83f, -7.07f, -6.29f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x742062, { -7.93f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x742063, { -7.93f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x742064, { -7.59f, -5.19f, -5.58f, -9.62f, -9.65f, -9.59f, -6.27f } },
+        { 0x742065, { -8.44f, -6.20f, -7.46f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x742066, { -7.14f, -8.02f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x742067, { -9.54f, -9.63f, -6.95f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x742068, { -7.34f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -6.27f } },
+        { 0x742069, { -6.71f, -6.69f, -6.95f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x74206A, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74206B, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74206C, { -9.54f, -5.74f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74206D, { -8.44f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74206E, { -7.93f, -7.69f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74206F, { -6.71f, -7.44f, -7.46f, -9.62f, -9.65f, -9.59f, -5.85f } },
+        { 0x742070, { -9.54f, -6.20f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x742071, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x742072, { -8.44f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -6.15f } },
+        { 0x742073, { -8.44f, -7.44f, -6.61f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x742074, { -5.69f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -7.00f } },
+        { 0x742075, { -8.44f, -8.02f, -6.10f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x742076, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x742077, { -7.59f, -9.63f, -6.52f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x74207A, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x7420E0, { -9.54f, -6.08f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7420E9, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7420EA, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7420FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746120, { -9.54f, -9.63f, -8.56f, -7.22f, -6.15f, -6.88f, -9.70f } },
+        { 0x746161, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x746162, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x746163, { -7.93f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x746164, { -9.54f, -9.63f, -9.66f, -5.90f, -7.45f, -7.02f, -9.70f } },
+        { 0x746169, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x74616C, { -7.34f, -8.02f, -9.66f, -7.05f, -6.94f, -7.64f, -9.70f } },
+        { 0x74616D, { -9.54f, -8.02f, -9.66f, -8.01f, -7.45f, -7.64f, -9.70f } },
+        { 0x74616E, { -7.14f, -7.69f, -7.26f, -7.05f, -7.08f, -7.64f, -7.31f } },
+        { 0x746171, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x746172, { -9.54f, -9.63f, -9.66f, -7.22f, -7.70f, -8.49f, -9.70f } },
+        { 0x746173, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x746174, { -6.59f, -6.92f, -8.05f, -9.62f, -6.21f, -7.98f, -7.51f } },
+        { 0x746175, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x74617A, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x7461E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x746269, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746461, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746472, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746475, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746520, { -6.83f, -5.46f, -6.29f, -5.85f, -5.60f, -5.74f, -5.47f } },
+        { 0x746561, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746563, { -7.14f, -7.44f, -9.66f, -7.42f, -9.65f, -7.19f, -9.70f } },
+        { 0x746564, { -6.32f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746565, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746567, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -7.00f } },
+        { 0x746568, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746569, { -9.54f, -7.69f, -7.71f, -9.62f, -9.65f, -8.49f, -7.31f } },
+        { 0x74656B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74656C, { -9.54f, -7.44f, -7.71f, -9.62f, -7.45f, -8.49f, -6.87f } },
+        { 0x74656D, { -7.93f, -8.02f, -9.66f, -8.01f, -8.55f, -6.22f, -8.61f } },
+        { 0x74656E, { -7.59f, -7.23f, -5.73f, -7.42f, -7.45f, -7.64f, -5.56f } },
+        { 0x746572, { -6.24f, -6.50f, -6.16f, -6.25f, -6.60f, -6.37f, -6.34f } },
+        { 0x746573, { -7.59f, -6.50f, -7.26f, -7.42f, -8.55f, -7.64f, -9.70f } },
+        { 0x746574, { -9.54f, -9.63f, -8.05f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x746576, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74657A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x746661, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x74676C, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746820, { -6.32f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746861, { -7.34f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746865, { -4.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746869, { -6.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74686F, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746872, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746920, { -9.54f, -9.63f, -9.66f, -9.62f, -5.30f, -9.59f, -9.70f } },
+        { 0x746961, { -7.59f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x746963, { -5.61f, -5.87f, -9.66f, -7.22f, -5.75f, -7.39f, -8.09f } },
+        { 0x746964, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.39f, -9.70f } },
+        { 0x746965, { -8.44f, -7.44f, -8.56f, -5.90f, -8.04f, -9.59f, -6.15f } },
+        { 0x746966, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746967, { -9.54f, -9.63f, -6.44f, -8.52f, -9.65f, -5.87f, -7.14f } },
+        { 0x74696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x74696B, { -9.54f, -9.63f, -5.94f, -9.62f, -9.65f, -9.59f, -5.99f } },
+        { 0x74696C, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74696D, { -7.93f, -9.63f, -9.66f, -8.52f, -8.04f, -8.49f, -9.70f } },
+        { 0x74696E, { -7.59f, -7.69f, -9.66f, -7.67f, -8.04f, -7.39f, -6.87f } },
+        { 0x74696F, { -4.81f, -4.85f, -6.52f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x746970, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746971, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746972, { -9.54f, -8.53f, -9.66f, -8.01f, -8.04f, -7.98f, -9.70f } },
+        { 0x746973, { -9.54f, -8.53f, -7.71f, -9.62f, -9.65f, -8.49f, -8.61f } },
+        { 0x746974, { -6.71f, -7.69f, -9.66f, -8.01f, -7.70f, -7.39f, -8.61f } },
+        { 0x746976, { -7.93f, -8.02f, -9.66f, -6.91f, -8.04f, -7.02f, -9.70f } },
+        { 0x74697A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x7469E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7469E8, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746C65, { -6.97f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746C69, { -9.54f, -9.63f, -6.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746C79, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746D65, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746E65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x746E6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x746F20, { -4.88f, -9.63f, -9.66f, -5.72f, -4.43f, -4.89f, -9.70f } },
+        { 0x746F64, { -9.54f, -9.63f, -9.66f, -5.64f, -9.65f, -5.62f, -9.70f } },
+        { 0x746F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x746F69, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746F6E, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x746F70, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x746F72, { -7.59f, -8.53f, -9.66f, -7.22f, -7.45f, -8.49f, -9.70f } },
+        { 0x746F73, { -9.54f, -9.63f, -9.66f, -6.40f, -9.65f, -5.87f, -9.70f } },
+        { 0x746F74, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x746F75, { -9.54f, -5.46f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746F77, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x746FDF, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74706F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747075, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747261, { -6.83f, -6.80f, -6.82f, -5.85f, -6.43f, -6.15f, -6.87f } },
+        { 0x747265, { -8.44f, -5.92f, -7.71f, -7.67f, -7.70f, -7.64f, -7.14f } },
+        { 0x747269, { -7.14f, -8.02f, -9.66f, -6.91f, -6.81f, -7.98f, -7.76f } },
+        { 0x74726F, { -9.54f, -9.63f, -9.66f, -8.01f, -6.94f, -7.19f, -9.70f } },
+        { 0x747275, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747279, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7472E0, { -9.54f, -9.63f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x7472E1, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x7472E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7472ED, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x747320, { -5.93f, -5.87f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747361, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747362, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747363, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x747365, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747366, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747367, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747368, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747369, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x74736F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747374, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x74737A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7473E4, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747420, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747461, { -7.93f, -9.63f, -9.66f, -9.62f, -6.60f, -9.59f, -9.70f } },
+        { 0x747465, { -7.59f, -7.23f, -7.71f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x747469, { -9.54f, -9.63f, -9.66f, -9.62f, -5.71f, -9.59f, -8.61f } },
+        { 0x74746F, { -9.54f, -9.63f, -9.66f, -9.62f, -5.38f, -9.59f, -9.70f } },
+        { 0x747472, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x747561, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x747563, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x747564, { -8.44f, -8.53f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x747565, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747569, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -7.64f, -7.76f } },
+        { 0x74756D, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74756E, { -9.54f, -8.53f, -7.09f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x74756F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x747572, { -7.59f, -7.69f, -9.66f, -7.67f, -7.70f, -6.88f, -9.70f } },
+        { 0x747573, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x747574, { -7.93f, -7.69f, -9.66f, -9.62f, -6.28f, -7.98f, -8.61f } },
+        { 0x747575, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x74757A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x7475ED, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x747661, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747665, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747761, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747765, { -8.44f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747769, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747920, { -5.78f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747972, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747A20, { -9.54f, -9.63f, -6.82f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747A65, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x747A69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x747A6F, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747A74, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x747A75, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74E020, { -9.54f, -9.63f, -9.66f, -9.62f, -5.60f, -9.59f, -9.70f } },
+        { 0x74E16E, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x74E26E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x74E46E, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74E474, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74E920, { -9.54f, -5.34f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x74E967, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74E972, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x74E973, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74EA6D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x74ED61, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x74ED63, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -9.59f, -9.70f } },
+        { 0x74F36E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x74F372, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0x74F6DF, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x74F920, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x74FC72, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x752061, { -9.54f, -7.44f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x752062, { -9.54f, -8.53f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x752063, { -9.54f, -8.53f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0x752064, { -9.54f, -6.92f, -9.66f, -8.01f, -9.65f, -7.02f, -9.70f } },
+        { 0x752065, { -9.54f, -7.44f, -7.46f, -9.62f, -9.65f, -7.39f, -8.61f } },
+        { 0x752066, { -9.54f, -9.63f, -7.71f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x752067, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x752068, { -9.54f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x752069, { -9.54f, -7.23f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x75206A, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x75206C, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75206D, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75206E, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x75206F, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x752070, { -9.54f, -8.02f, -9.66f, -7.42f, -9.65f, -7.64f, -9.70f } },
+        { 0x752071, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x752072, { -9.54f, -8.53f, -9.66f, -7.42f, -9.65f, -7.98f, -9.70f } },
+        { 0x752073, { -9.54f, -7.23f, -7.71f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x752074, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x752075, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x752076, { -9.54f, -9.63f, -7.46f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x752077, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7520E0, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756120, { -9.54f, -9.63f, -9.66f, -9.62f, -6.35f, -6.09f, -9.70f } },
+        { 0x756167, { -8.44f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x756169, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x75616C, { -6.59f, -9.63f, -9.66f, -6.06f, -6.43f, -6.54f, -9.70f } },
+        { 0x75616E, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x756172, { -8.44f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x756173, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756174, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7561E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756262, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x756265, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756269, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75626A, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75626C, { -7.59f, -7.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x75626D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756274, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756361, { -8.44f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x756368, { -7.59f, -9.63f, -6.44f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756369, { -9.54f, -9.63f, -9.66f, -7.22f, -8.55f, -9.59f, -9.70f } },
+        { 0x75636C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756375, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756420, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x756461, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x756465, { -7.59f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -7.51f } },
+        { 0x756469, { -8.44f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x756520, { -8.44f, -5.66f, -9.66f, -6.00f, -9.65f, -5.62f, -9.70f } },
+        { 0x756562, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0x75656C, { -8.44f, -7.69f, -9.66f, -8.01f, -7.70f, -9.59f, -9.70f } },
+        { 0x75656D, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75656E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756572, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.19f, -9.70f } },
+        { 0x756573, { -9.54f, -8.02f, -9.66f, -7.67f, -6.94f, -7.98f, -9.70f } },
+        { 0x756575, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756576, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x756620, { -9.54f, -9.63f, -6.10f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756665, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756668, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75666C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756673, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756720, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x756761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756768, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756769, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756775, { -9.54f, -9.63f, -8.56f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x756861, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7568E4, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756920, { -9.54f, -6.59f, -9.66f, -9.62f, -7.25f, -8.49f, -9.70f } },
+        { 0x756963, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x756965, { -9.54f, -9.63f, -9.66f, -6.91f, -9.65f, -8.49f, -9.70f } },
+        { 0x756967, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x75696C, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75696E, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756972, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x756973, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -8.61f } },
+        { 0x756974, { -9.54f, -7.44f, -9.66f, -9.62f, -9.65f, -8.49f, -7.31f } },
+        { 0x7569E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x7569E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756A65, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x756B65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756B6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x756C20, { -8.44f, -6.80f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756C61, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -7.98f, -9.70f } },
+        { 0x756C64, { -7.93f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x756C65, { -8.44f, -7.44f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756C67, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756C68, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x756C69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x756C6B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x756C6C, { -7.34f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -8.09f } },
+        { 0x756C6F, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -9.59f, -9.70f } },
+        { 0x756C70, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -8.61f } },
+        { 0x756C74, { -8.44f, -8.53f, -8.56f, -8.01f, -8.04f, -8.49f, -9.70f } },
+        { 0x756D20, { -8.44f, -9.63f, -7.71f, -9.62f, -9.65f, -6.54f, -9.70f } },
+        { 0x756D61, { -6.49f, -7.07f, -9.66f, -6.48f, -6.51f, -6.09f, -9.70f } },
+        { 0x756D62, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x756D65, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756D69, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756D70, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x756D73, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756DE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756E20, { -9.54f, -6.20f, -9.66f, -6.78f, -6.21f, -9.59f, -8.09f } },
+        { 0x756E61, { -7.93f, -8.53f, -8.05f, -6.48f, -6.15f, -7.98f, -9.70f } },
+        { 0x756E63, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756E64, { -6.49f, -9.63f, -4.74f, -6.67f, -9.65f, -6.64f, -7.76f } },
+        { 0x756E65, { -9.54f, -6.14f, -8.56f, -8.52f, -7.45f, -9.59f, -9.70f } },
+        { 0x756E66, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756E67, { -9.54f, -9.63f, -4.78f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756E69, { -6.59f, -6.92f, -9.66f, -6.91f, -6.70f, -6.88f, -8.61f } },
+        { 0x756E6B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756E6D, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756E6F, { -9.54f, -9.63f, -9.66f, -8.52f, -8.55f, -9.59f, -9.70f } },
+        { 0x756E70, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756E73, { -9.54f, -8.53f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x756E74, { -6.97f, -9.63f, -6.71f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756E76, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x756F20, { -9.54f, -9.63f, -9.66f, -8.01f, -5.68f, -7.64f, -9.70f } },
+        { 0x756F67, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756F69, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x756F6C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x756F6D, { -9.54f, -9.63f, -9.66f, -9.62f, -7.45f, -9.59f, -9.70f } },
+        { 0x756F73, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -7.19f, -9.70f } },
+        { 0x756F76, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0x757020, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757065, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x75706C, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75706F, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757070, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x757072, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -8.61f } },
+        { 0x757220, { -7.93f, -6.27f, -8.05f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x757261, { -8.44f, -8.02f, -9.66f, -7.22f, -7.70f, -6.37f, -9.70f } },
+        { 0x757263, { -9.54f, -9.63f, -6.61f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757265, { -7.59f, -6.92f, -9.66f, -8.52f, -8.04f, -9.59f, -8.61f } },
+        { 0x757269, { -7.34f, -7.44f, -9.66f, -7.67f, -7.25f, -7.98f, -7.14f } },
+        { 0x75726C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x75726E, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75726F, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x757270, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757273, { -8.44f, -6.92f, -9.66f, -8.01f, -9.65f, -7.64f, -9.70f } },
+        { 0x757274, { -8.44f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7572E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7572ED, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x7572FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757320, { -7.59f, -5.92f, -9.66f, -7.42f, -9.65f, -7.98f, -8.09f } },
+        { 0x757361, { -9.54f, -8.53f, -7.71f, -7.67f, -8.04f, -7.64f, -9.70f } },
+        { 0x757363, { -9.54f, -9.63f, -8.56f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x757365, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757367, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75736F, { -9.54f, -9.63f, -9.66f, -8.52f, -7.70f, -9.59f, -9.70f } },
+        { 0x757371, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757373, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x757374, { -7.93f, -8.53f, -8.05f, -8.01f, -8.55f, -8.49f, -8.61f } },
+        { 0x7573E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7573FC, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757420, { -7.34f, -6.41f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757461, { -8.44f, -8.53f, -9.66f, -7.67f, -8.04f, -8.49f, -9.70f } },
+        { 0x757465, { -8.44f, -5.83f, -9.66f, -8.52f, -7.70f, -8.49f, -9.70f } },
+        { 0x757466, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757469, { -7.34f, -7.69f, -9.66f, -9.62f, -8.55f, -9.59f, -8.61f } },
+        { 0x75746F, { -9.54f, -8.53f, -9.66f, -9.62f, -7.08f, -8.49f, -9.70f } },
+        { 0x757472, { -8.44f, -7.44f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0x757473, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757474, { -9.54f, -9.63f, -9.66f, -9.62f, -6.70f, -9.59f, -9.70f } },
+        { 0x757475, { -9.54f, -8.53f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x75747A, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7574F3, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x75756E, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757572, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x757665, { -9.54f, -8.02f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757720, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x757762, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x757765, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.14f } },
+        { 0x757769, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757820, { -9.54f, -6.27f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x757961, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x757965, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x757A69, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -7.98f, -9.70f } },
+        { 0x75DF65, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75E7E3, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x75E920, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75E969, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x75E96D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.75f, -9.70f } },
+        { 0x75E973, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x75ED61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x75F220, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x766120, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x766163, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766164, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.19f, -9.70f } },
+        { 0x766167, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x76616C, { -9.54f, -8.02f, -9.66f, -8.52f, -8.55f, -8.49f, -8.61f } },
+        { 0x76616D, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0x76616E, { -7.59f, -7.69f, -9.66f, -8.01f, -7.70f, -9.59f, -4.83f } },
+        { 0x766172, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x766173, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -8.61f } },
+        { 0x766174, { -8.44f, -9.63f, -8.05f, -9.62f, -7.25f, -7.98f, -8.09f } },
+        { 0x766520, { -6.10f, -9.63f, -9.66f, -8.52f, -8.55f, -8.49f, -9.70f } },
+        { 0x766561, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x766563, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766564, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766569, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x76656C, { -8.44f, -8.02f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x76656D, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x76656E, { -8.44f, -8.02f, -8.56f, -8.52f, -7.70f, -8.49f, -6.57f } },
+        { 0x766572, { -5.61f, -7.23f, -5.31f, -7.22f, -6.51f, -7.02f, -5.11f } },
+        { 0x766573, { -7.93f, -7.69f, -9.66f, -8.52f, -9.65f, -9.59f, -8.09f } },
+        { 0x766920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x766963, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0x766964, { -8.44f, -7.44f, -9.66f, -6.67f, -5.75f, -6.88f, -8.61f } },
+        { 0x766965, { -8.44f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x76696C, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x76696D, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0x76696E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x76696F, { -7.93f, -8.02f, -9.66f, -8.52f, -8.04f, -7.98f, -9.70f } },
+        { 0x766974, { -8.44f, -8.02f, -9.66f, -8.01f, -6.94f, -9.59f, -9.70f } },
+        { 0x766F20, { -9.54f, -9.63f, -9.66f, -8.01f, -7.70f, -7.64f, -9.70f } },
+        { 0x766F63, { -9.54f, -8.53f, -9.66f, -8.01f, -8.55f, -7.98f, -9.70f } },
+        { 0x766F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x766F69, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766F6B, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766F6C, { -9.54f, -8.02f, -8.05f, -9.62f, -7.70f, -7.39f, -6.57f } },
+        { 0x766F6E, { -9.54f, -9.63f, -6.95f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x766F6F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.21f } },
+        { 0x766F71, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x766F72, { -9.54f, -8.53f, -7.46f, -9.62f, -9.65f, -8.49f, -7.31f } },
+        { 0x766F73, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -7.39f, -9.70f } },
+        { 0x767261, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x767265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -7.51f } },
+        { 0x767269, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.04f } },
+        { 0x76726F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x76756F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x767574, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x767665, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x76E86E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x76E920, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x76E965, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x76E973, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x76ED64, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0x76F66C, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x772061, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x772068, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x772069, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x772074, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776120, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.57f } },
+        { 0x77616C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77616E, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776172, { -8.44f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776173, { -7.59f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x776174, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x776261, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x776563, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776564, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776565, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776567, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -6.66f } },
+        { 0x776569, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77656C, { -8.44f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -6.34f } },
+        { 0x77656E, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x776572, { -9.54f, -9.63f, -6.16f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x776574, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.76f } },
+        { 0x77657A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x776865, { -6.49f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776869, { -7.14f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776963, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776965, { -9.54f, -9.63f, -7.09f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x77696B, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x77696C, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x776972, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776973, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x776974, { -6.32f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776E20, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776F68, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776F6D, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x776F6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x776F72, { -7.34f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -5.90f } },
+        { 0x777265, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x77756E, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77E468, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77E472, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x77FC72, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782061, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782062, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782064, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782065, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x78206C, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x78206D, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782070, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x782071, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x78616D, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x786520, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x78696C, { -8.44f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x786973, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x786F20, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0x787072, { -8.44f, -8.02f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0x787469, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x792061, { -5.93f, -9.63f, -9.66f, -6.91f, -9.65f, -9.59f, -9.70f } },
+        { 0x792062, { -7.34f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x792063, { -7.93f, -8.53f, -9.66f, -7.05f, -9.65f, -9.59f, -9.70f } },
+        { 0x792064, { -7.34f, -9.63f, -9.66f, -6.57f, -9.65f, -9.59f, -9.70f } },
+        { 0x792065, { -9.54f, -9.63f, -9.66f, -6.78f, -9.65f, -9.59f, -9.70f } },
+        { 0x792066, { -7.59f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x792068, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x792069, { -6.71f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x79206B, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x79206C, { -7.93f, -9.63f, -9.66f, -6.57f, -9.65f, -9.59f, -9.70f } },
+        { 0x79206D, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x79206E, { -7.59f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x79206F, { -6.83f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x792070, { -7.59f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x792071, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x792072, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x792073, { -8.44f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x792074, { -6.71f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0x792077, { -7.93f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x792079, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x796120, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x79616E, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x796520, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0x79656E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x796C20, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x796C75, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x796F6E, { -6.10f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x796F72, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x797261, { -8.44f, -8.53f, -8.56f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x797320, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x797768, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A2061, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A2064, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A2065, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A2067, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A206E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7A207A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A6120, { -9.54f, -9.63f, -9.66f, -7.42f, -5.64f, -9.59f, -9.70f } },
+        { 0x7A6161, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A6163, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A616C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -6.87f } },
+        { 0x7A616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x7A6172, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A6174, { -8.44f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A617A, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x7A61E7, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7A6520, { -9.54f, -9.63f, -8.56f, -9.62f, -8.04f, -9.59f, -6.76f } },
+        { 0x7A6567, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A6569, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A656C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -8.09f } },
+        { 0x7A656E, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x7A6572, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7A6575, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A6920, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x7A6961, { -9.54f, -9.63f, -8.05f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x7A6963, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x7A6964, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7A6965, { -9.54f, -9.63f, -7.71f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0x7A696A, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -5.63f } },
+        { 0x7A696E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -7.76f } },
+        { 0x7A696F, { -9.54f, -9.63f, -9.66f, -9.62f, -5.25f, -9.59f, -9.70f } },
+        { 0x7A6972, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7A6974, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A6F20, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0x7A6F61, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A6F65, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A6F67, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A6F6E, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.31f } },
+        { 0x7A6F77, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.51f } },
+        { 0x7A7420, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7465, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7520, { -9.54f, -9.63f, -5.69f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7567, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7568, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A756B, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A756C, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -7.76f } },
+        { 0x7A756D, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A756E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7572, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7573, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7577, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7761, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -9.59f, -8.61f } },
+        { 0x7A7769, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7775, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0x7A7A61, { -9.54f, -9.63f, -9.66f, -9.62f, -6.94f, -9.59f, -9.70f } },
+        { 0x7A7A6F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0x7AE36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0x7AF36E, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0x7AF565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xDF2064, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF656E, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF6572, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF6C69, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF6E61, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF7420, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF7465, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xDF756E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE02061, { -9.54f, -8.02f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0xE02063, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE02064, { -9.54f, -8.02f, -9.66f, -9.62f, -6.51f, -9.59f, -9.70f } },
+        { 0xE02065, { -9.54f, -9.63f, -9.66f, -9.62f, -6.15f, -9.59f, -9.70f } },
+        { 0xE02066, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -8.49f, -9.70f } },
+        { 0xE02067, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE02069, { -9.54f, -8.53f, -9.66f, -9.62f, -8.04f, -9.59f, -9.70f } },
+        { 0xE0206C, { -9.54f, -6.20f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0xE0206E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE02070, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE02072, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE02073, { -9.54f, -7.69f, -9.66f, -9.62f, -8.55f, -7.98f, -9.70f } },
+        { 0xE02074, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE02075, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE02076, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE020E8, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE12061, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE12063, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -8.49f, -9.70f } },
+        { 0xE12064, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE12066, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE12069, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE1206D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE1206F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE12070, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0xE12073, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -8.49f, -9.70f } },
+        { 0xE16374, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0xE16E20, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0xE16E64, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE17269, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0xE17320, { -9.54f, -9.63f, -9.66f, -7.42f, -9.65f, -9.59f, -9.70f } },
+        { 0xE17469, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE17665, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE26765, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE26E63, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE36F20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -4.86f, -9.70f } },
+        { 0xE36F73, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE46368, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46674, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46869, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE4686C, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46872, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46E64, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46E67, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46E69, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46E6B, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE46E6E, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE47274, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE47275, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE47420, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE4747A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE475DF, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE4DF20, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE76120, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.39f, -9.70f } },
+        { 0xE7E36F, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -5.35f, -9.70f } },
+        { 0xE7F565, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.37f, -9.70f } },
+        { 0xE82064, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE82069, { -9.54f, -9.63f, -9.66f, -9.62f, -7.70f, -9.59f, -9.70f } },
+        { 0xE82070, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE82073, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE86E65, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE87265, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE87320, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE92061, { -9.54f, -7.23f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xE92063, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE92064, { -9.54f, -6.27f, -9.66f, -9.62f, -8.04f, -8.49f, -9.70f } },
+        { 0xE92065, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE92069, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9206A, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9206C, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9206E, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE9206F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE92070, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE92071, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE920E0, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9616C, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96365, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96369, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9636C, { -9.54f, -7.23f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9636F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96375, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96475, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96520, { -9.54f, -6.92f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9656C, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96573, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96665, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96669, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96761, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96769, { -9.54f, -8.53f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96772, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE967E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96973, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE96C20, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96C69, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96CE9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96D20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.54f, -9.70f } },
+        { 0xE96D65, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96E20, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96E61, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE96EE9, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97061, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97065, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9706F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97072, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97075, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97175, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97261, { -9.54f, -6.59f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97265, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97269, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xE972E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97320, { -9.54f, -6.50f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xE97365, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97369, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9736F, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97375, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97461, { -9.54f, -7.07f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97465, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE974E9, { -9.54f, -6.50f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9756E, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97661, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE97665, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xE9766F, { -9.54f, -8.02f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xEA6D20, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0xEA6D65, { -9.54f, -7.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xEA6E63, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0xEA7472, { -9.54f, -6.69f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xEA74E9, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xED2063, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xED6120, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0xED616D, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xED6173, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xED6375, { -9.54f, -9.63f, -9.66f, -5.90f, -9.65f, -9.59f, -9.70f } },
+        { 0xED6461, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xED6469, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0xED6475, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0xED6669, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0xED6C69, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.19f, -9.70f } },
+        { 0xED6E64, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xED6E67, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xED6E73, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xED7069, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xED7269, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.98f, -9.70f } },
+        { 0xED7320, { -9.54f, -9.63f, -9.66f, -7.22f, -9.65f, -7.39f, -9.70f } },
+        { 0xED7365, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xED7469, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -7.98f, -9.70f } },
+        { 0xF1616E, { -9.54f, -9.63f, -9.66f, -8.01f, -9.65f, -9.59f, -9.70f } },
+        { 0xF22065, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xF36C6F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xF36D69, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xF36E20, { -9.54f, -9.63f, -9.66f, -4.98f, -9.65f, -9.59f, -9.70f } },
+        { 0xF36E6F, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0xF37072, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xF37267, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -8.49f, -9.70f } },
+        { 0xF37269, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -7.64f, -9.70f } },
+        { 0xF37369, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -9.59f, -9.70f } },
+        { 0xF56573, { -9.54f, -9.63f, -9.66f, -9.62f, -9.65f, -6.03f, -9.70f } },
+        { 0xF66368, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF66666, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF66765, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF66C6B, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67264, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67265, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67269, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67274, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67275, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF67375, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF6DF65, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF6DF74, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xF92061, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xF92065, { -9.54f, -8.53f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xF9206C, { -9.54f, -8.02f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xF9206F, { -9.54f, -9.63f, -9.66f, -9.62f, -8.55f, -9.59f, -9.70f } },
+        { 0xF92074, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFA6269, { -9.54f, -9.63f, -9.66f, -8.52f, -9.65f, -8.49f, -9.70f } },
+        { 0xFA626C, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -7.98f, -9.70f } },
+        { 0xFA6E20, { -9.54f, -9.63f, -9.66f, -7.67f, -9.65f, -9.59f, -9.70f } },
+        { 0xFB7265, { -9.54f, -8.53f, -9.66f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6265, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6275, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC636B, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6465, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6865, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6872, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6C6C, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6C74, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6E64, { -9.54f, -9.63f, -7.46f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC6E66, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC7220, { -9.54f, -9.63f, -8.05f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC7264, { -9.54f, -9.63f, -7.71f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC726C, { -9.54f, -9.63f, -7.26f, -9.62f, -9.65f, -9.59f, -9.70f } },
+        { 0xFC747A, { -9.54f, -9.63f, -8.56f, -9.62f, -9.65f, -9.59f, -9.70f } },
+    };
+
+}
@@ -0,0 +1,251 @@
+#include "MmapModelReader.h"
+
+#include "CompactVocabulary.h"
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// An istream that owns its stream buffer.
+		class MappedStream : public std::istream
+		{
+		public:
+			explicit MappedStream(std::shared_ptr<const MappedFile> file)
+				: std::istream(nullptr)
+				, m_buffer(std::move(file))
+			{
+				rdbuf(&m_buffer);
+			}
+
+		private:
+			MappedStreamBuffer m_buffer;
+		};
+	}
+
+	std::shared_ptr<const MappedFile> MappedFile::open(const std::string& path)
+	{
+		std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+		// The path is UTF-8; the ANSI file APIs would mangle non-ASCII directories.
+		const int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+		std::wstring widePath(length > 0 ? length - 1 : 0, L'\0');
+		MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, widePath.data(), length);
+
+		HANDLE handle = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (handle == INVALID_HANDLE_VALUE)
+		{
+			const DWORD error = GetLastError();
+			if (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND)
+			{
+				return nullptr;
+			}
+			throw std::runtime_error("Failed to open '" + path + "' (error " + std::to_string(error) + ").");
+		}
+		file->m_file = handle;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(handle, &size))
+		{
+			throw std::runtime_error("Failed to get the size of '" + path + "'.");
+		}
+		file->m_size = static_cast<size_t>(size.QuadPart);
+		if (file->m_size == 0)
+		{
+			return file;
+		}
+
+		file->m_mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (file->m_mapping == nullptr)
+		{
+			throw std::runtime_error("Failed to map '" + path + "' (error " + std::to_string(GetLastError()) + ").");
+		}
+		file->m_data = static_cast<const char*>(MapViewOfFile(file->m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (file->m_data == nullptr)
+		{
+			throw std::runtime_error("Failed to map '" + path + "' (error " + std::to_string(GetLastError()) + ").");
+		}
+
+		// The loader reads the whole file front to back; ask for it up front.
+		WIN32_MEMORY_RANGE_ENTRY range{ const_cast<char*>(file->m_data), file->m_size };
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+		const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (descriptor < 0)
+		{
+			if (errno == ENOENT || errno == ENOTDIR)
+			{
+				return nullptr;
+			}
+			throw std::runtime_error("Failed to open '" + path + "' (errno " + std::to_string(errno) + ").");
+		}
+
+		struct stat status;
+		if (fstat(descriptor, &status) != 0)
+		{
+			::close(descriptor);
+			throw std::runtime_error("Failed to get the size of '" + path + "'.");
+		}
+		file->m_size = static_cast<size_t>(status.st_size);
+		if (file->m_size > 0)
+		{
+			void* data = mmap(nullptr, file->m_size, PROT_READ, MAP_SHARED, descriptor, 0);
+			if (data == MAP_FAILED)
+			{
+				::close(descriptor);
+				throw std::runtime_error("Failed to map '" + path + "' (errno " + std::to_string(errno) + ").");
+			}
+			file->m_data = static_cast<const char*>(data);
+			// The loader reads the whole file front to back; ask for it up front.
+			madvise(data, file->m_size, MADV_SEQUENTIAL);
+			madvise(data, file->m_size, MADV_WILLNEED);
+		}
+		// The mapping keeps its own reference to the file.
+		::close(descriptor);
+#endif
+		return file;
+	}
+
+	MappedFile::~MappedFile()
+	{
+#ifdef _WIN32
+		if (m_data)
+			UnmapViewOfFile(m_data);
+		if (m_mapping)
+			CloseHandle(m_mapping);
+		if (m_file)
+			CloseHandle(m_file);
+#else
+		if (m_data)
+			munmap(const_cast<char*>(m_data), m_size);
+#endif
+	}
+
+	MappedStreamBuffer::MappedStreamBuffer(std::shared_ptr<const MappedFile> file)
+		: m_file(std::move(file))
+	{
+		// std::streambuf only has a mutable get area; nothing writes through it.
+		char* begin = const_cast<char*>(m_file->data());
+		setg(begin, begin, begin + m_file->size());
+	}
+
+	MappedStreamBuffer::pos_type MappedStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+	{
+		if (!(which & std::ios_base::in))
+		{
+			return pos_type(off_type(-1));
+		}
+
+		off_type base = 0;
+		if (direction == std::ios_base::cur)
+			base = gptr() - eback();
+		else if (direction == std::ios_base::end)
+			base = egptr() - eback();
+
+		const off_type target = base + offset;
+		if (target < 0 || target > egptr() - eback())
+		{
+			return pos_type(off_type(-1));
+		}
+		setg(eback(), eback() + target, egptr());
+		return pos_type(target);
+	}
+
+	MappedStreamBuffer::pos_type MappedStreamBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+	{
+		return seekoff(off_type(position), std::ios_base::beg, which);
+	}
+
+	std::streamsize MappedStreamBuffer::showmanyc()
+	{
+		const std::streamsize remaining = egptr() - gptr();
+		return remaining > 0 ? remaining : -1;
+	}
+
+	MmapModelReader::MmapModelReader(std::string modelDir)
+		: m_modelDir(std::move(modelDir))
+	{
+	}
+
+	std::string MmapModelReader::get_model_id() const
+	{
+		return m_modelDir;
+	}
+
+	std::unique_ptr<std::istream> MmapModelReader::get_file(const std::string& filename, const bool binary)
+	{
+		const std::string path = m_modelDir + "/" + filename;
+
+		// ctranslate2::models::load_vocabulary asks for "<name>.json", then "<name>.txt".
+		const std::string vocabularySuffix = "_vocabulary";
+		const auto hasSuffix = [&filename](const std::string& suffix)
+		{
+			return filename.size() > suffix.size() && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+		};
+		if (!binary && hasSuffix(vocabularySuffix + ".json"))
+		{
+			std::shared_ptr<const CompactVocabulary> vocabulary;
+			try
+			{
+				vocabulary = CompactVocabulary::forJson(path);
+			}
+			catch (const std::exception&)
+			{
+				// Let CTranslate2 parse the JSON itself and report what is wrong with it.
+			}
+			if (vocabulary && vocabulary->isTextSafe())
+			{
+				m_vocabularies[filename.substr(0, filename.size() - 5)] = std::move(vocabulary);
+				return nullptr;
+			}
+		}
+		if (!binary && hasSuffix(vocabularySuffix + ".txt"))
+		{
+			const auto it = m_vocabularies.find(filename.substr(0, filename.size() - 4));
+			if (it != m_vocabularies.end())
+			{
+				return std::make_unique<std::istringstream>(it->second->toText());
+			}
+		}
+
+		if (!binary)
+		{
+			auto stream = std::make_unique<std::ifstream>(path);
+			if (!stream->is_open())
+			{
+				return nullptr;
+			}
+			return stream;
+		}
+
+		std::shared_ptr<const MappedFile> file = MappedFile::open(path);
+		if (!file)
+		{
+			return nullptr;
+		}
+		return std::make_unique<MappedStream>(std::move(file));
+	}
+
+	std::shared_ptr<const CompactVocabulary> MmapModelReader::compactVocabulary(const std::string& name) const
+	{
+		const auto it = m_vocabularies.find(name);
+		return it != m_vocabularies.end() ? it->second : nullptr;
+	}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <map>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+#include <ctranslate2/models/model_reader.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    class CompactVocabulary;
+
+    // Read-only mapping of a whole file. Pages come straight from the OS page cache and
+    // are shared with every other process mapping the same file.
+    class MappedFile
+    {
+    public:
+        // Throws std::runtime_error if the file exists but cannot be mapped.
+        // Returns nullptr if it does not exist.
+        static std::shared_ptr<const MappedFile> open(const std::string& path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+    private:
+        MappedFile() = default;
+
+        const char* m_data = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+    };
+
+    // Input stream buffer reading directly from a mapping: the get area is the mapped
+    // range, so istream::read is a single memcpy out of the page cache with no
+    // intermediate buffer. Seeking is supported, as the model loader needs it.
+    class MappedStreamBuffer : public std::streambuf
+    {
+    public:
+        explicit MappedStreamBuffer(std::shared_ptr<const MappedFile> file);
+
+    protected:
+        pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+        std::streamsize showmanyc() override;
+
+    private:
+        std::shared_ptr<const MappedFile> m_file;
+    };
+
+    // ModelReader serving binary model files (model.bin) from memory mappings.
+    //
+    // This replaces models::ModelFileReader's buffered std::ifstream: model.bin is read
+    // sequentially out of shared page-cache pages, so a warm load does no disk I/O and
+    // no read() copies into a stream buffer. Text files (config, vocabularies) still
+    // go through std::ifstream in text mode, exactly like ModelFileReader.
+    //
+    // CTranslate2 copies every variable into its own StorageView while loading, so the
+    // mapping is released at the end of the load and the weights are still private
+    // per process. A zero-copy StorageView over the mapping needs a hook in
+    // models::Model::load that the prebuilt library does not offer.
+    //
+    // Vocabulary JSON files are served from their CompactVocabulary instead: the JSON is
+    // reported missing and the token list is handed out as the "<name>.txt" CTranslate2
+    // falls back to, which it reads without a JSON parser.
+    class MmapModelReader : public ctranslate2::models::ModelReader
+    {
+    public:
+        explicit MmapModelReader(std::string modelDir);
+
+        std::string get_model_id() const override;
+        std::unique_ptr<std::istream> get_file(const std::string& filename,
+                                               const bool binary = false) override;
+
+        // Compiled vocabulary the model was loaded from, by base name ("shared_vocabulary",
+        // "source_vocabulary", ...), or nullptr if that vocabulary was not requested.
+        std::shared_ptr<const CompactVocabulary> compactVocabulary(const std::string& name) const;
+
+    private:
+        std::string m_modelDir;
+        std::map<std::string, std::shared_ptr<const CompactVocabulary>> m_vocabularies;
+    };
+
+}
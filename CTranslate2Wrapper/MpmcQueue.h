@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace CTranslate2Wrapper::Native {
+
+    // Bounded lock-free multi-producer multi-consumer FIFO (Dmitry Vyukov's array queue).
+    //
+    // Every cell carries a sequence number that tells producers and consumers whose turn
+    // it is, so a push or a pop is one CAS on the shared position plus one release store
+    // on the cell. There is no lock and no allocation after construction. Values are
+    // moved in and out; T should be cheap to move (a pointer, typically).
+    template <typename T>
+    class MpmcQueue
+    {
+    public:
+        // The capacity is rounded up to a power of two (at least 2).
+        explicit MpmcQueue(size_t capacity)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+            {
+                rounded <<= 1;
+            }
+            m_mask = rounded - 1;
+            m_cells = std::make_unique<Cell[]>(rounded);
+            for (size_t i = 0; i < rounded; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        // Returns false, leaving value alone, when the queue is full.
+        bool tryPush(T& value)
+        {
+            size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = m_cells[position & m_mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // The consumer of the previous lap has not taken this cell yet.
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Returns false when the queue is empty.
+        bool tryPop(T& value)
+        {
+            size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = m_cells[position & m_mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+                if (difference == 0)
+                {
+                    if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        value = std::move(cell.value);
+                        cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        size_t capacity() const { return m_mask + 1; }
+
+    private:
+        // Producers and consumers spin on different positions; keep them on their own
+        // cache lines.
+        static constexpr size_t cacheLine = 64;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        size_t m_mask = 0;
+        alignas(cacheLine) std::atomic<size_t> m_enqueuePosition{ 0 };
+        alignas(cacheLine) std::atomic<size_t> m_dequeuePosition{ 0 };
+    };
+
+}
@@ -0,0 +1,117 @@
+#include "PieceIdMap.h"
+
+#include <stdexcept>
+
+namespace CTranslate2Wrapper::Native {
+
+	PieceIdMap::PieceIdMap(std::shared_ptr<const TokenizerService> tokenizer,
+	                       const ctranslate2::models::SequenceToSequenceModel& model,
+	                       const CompactVocabulary* sourceVocabulary)
+		: m_tokenizer(std::move(tokenizer))
+	{
+		if (!supports(model))
+		{
+			throw std::invalid_argument("PieceIdMap does not support models that add start or end tokens to the source.");
+		}
+
+		// 1. source.spm -> model source vocabulary, the lookup toSourceIds does per token.
+		const auto& source = m_tokenizer->source();
+		const auto& modelSource = model.get_source_vocabulary();
+		m_sourceIds.resize(static_cast<size_t>(source.GetPieceSize()));
+		for (int id = 0; id < source.GetPieceSize(); ++id)
+		{
+			const std::string& piece = source.IdToPiece(id);
+			const size_t modelId = sourceVocabulary ? sourceVocabulary->find(piece) : CompactVocabulary::npos;
+			m_sourceIds[id] = modelId != CompactVocabulary::npos ? modelId : modelSource.to_id(piece);
+		}
+		// opusmt does not need BOS tokens, only EOS
+		m_sourceEndId = modelSource.to_id("</s>");
+
+		// 2. Model target vocabulary -> target.spm, the lookup decode does per piece.
+		const auto& target = m_tokenizer->target();
+		const auto& modelTarget = model.get_target_vocabulary();
+		const std::string& unknownPiece = target.IdToPiece(target.unk_id());
+		m_targetPieceIds.resize(modelTarget.size());
+		for (size_t id = 0; id < modelTarget.size(); ++id)
+		{
+			if (id == modelTarget.bos_id() || id == modelTarget.eos_id())
+			{
+				m_targetPieceIds[id] = skipToken;
+				continue;
+			}
+			const std::string& token = modelTarget.to_token(id);
+			const int pieceId = target.PieceToId(token);
+			if (pieceId == target.unk_id() && token != unknownPiece)
+			{
+				m_targetPieceIds[id] = pieceOnly;
+				m_pieceOnlyTokens.emplace(id, token);
+			}
+			else
+			{
+				m_targetPieceIds[id] = pieceId;
+			}
+		}
+	}
+
+	bool PieceIdMap::supports(const ctranslate2::models::SequenceToSequenceModel& model)
+	{
+		return !model.with_source_bos() && !model.with_source_eos();
+	}
+
+	std::vector<size_t> PieceIdMap::encode(const std::string& text, size_t maxInputLength) const
+	{
+		const std::vector<int> pieceIds = m_tokenizer->encodeIds(text);
+
+		std::vector<size_t> ids;
+		ids.reserve(pieceIds.size() + 1);
+		for (const int pieceId : pieceIds)
+		{
+			ids.push_back(m_sourceIds[static_cast<size_t>(pieceId)]);
+		}
+		ids.push_back(m_sourceEndId);
+
+		// Same truncation as toSourceIds: the end token goes first.
+		if (maxInputLength > 0 && ids.size() > maxInputLength)
+		{
+			ids.resize(maxInputLength);
+		}
+		return ids;
+	}
+
+	std::string PieceIdMap::decode(const std::vector<size_t>& targetIds) const
+	{
+		const auto& target = m_tokenizer->target();
+		std::vector<int> pieceIds;
+		pieceIds.reserve(targetIds.size());
+		bool pieceOnlyTokens = false;
+		for (const size_t id : targetIds)
+		{
+			const int pieceId = id < m_targetPieceIds.size() ? m_targetPieceIds[id] : target.unk_id();
+			if (pieceId != skipToken)
+			{
+				pieceIds.push_back(pieceId);
+				pieceOnlyTokens |= pieceId == pieceOnly;
+			}
+		}
+		if (!pieceOnlyTokens)
+		{
+			return m_tokenizer->decodeIds(pieceIds);
+		}
+
+		// Rare: decode from the piece strings, as the piece path does.
+		std::vector<std::string> pieces;
+		pieces.reserve(pieceIds.size());
+		size_t next = 0;
+		for (const size_t id : targetIds)
+		{
+			if (id < m_targetPieceIds.size() && m_targetPieceIds[id] == skipToken)
+			{
+				continue;
+			}
+			const int pieceId = pieceIds[next++];
+			pieces.push_back(pieceId == pieceOnly ? m_pieceOnlyTokens.at(id) : target.IdToPiece(pieceId));
+		}
+		return m_tokenizer->decode(pieces);
+	}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ctranslate2/models/sequence_to_sequence.h>
+
+#include "CompactVocabulary.h"
+#include "TokenizerService.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // Translates between SentencePiece ids and model vocabulary ids with two tables
+    // built once at load time. Text goes to model ids and model ids back to text without
+    // a piece string or a vocabulary hash lookup per token.
+    //
+    // Gives the same ids and text as the piece path (encode, toSourceIds,
+    // toTargetPieces, decode): a piece missing from the model vocabulary maps to its
+    // unknown id. A model token missing from target.spm has no id to decode; SentencePiece
+    // prints such a piece as is, so a translation containing one is decoded from piece
+    // strings instead.
+    class PieceIdMap
+    {
+    public:
+        // Only for models that add neither a start nor an end token to the source
+        // (see supports); the tables are built from sourceVocabulary when given.
+        PieceIdMap(std::shared_ptr<const TokenizerService> tokenizer,
+                   const ctranslate2::models::SequenceToSequenceModel& model,
+                   const CompactVocabulary* sourceVocabulary);
+
+        static bool supports(const ctranslate2::models::SequenceToSequenceModel& model);
+
+        // Source text to model source ids with the end token appended, truncated to
+        // maxInputLength (0 disables truncation).
+        std::vector<size_t> encode(const std::string& text, size_t maxInputLength) const;
+
+        // Model target ids to text; start and end tokens are dropped.
+        std::string decode(const std::vector<size_t>& targetIds) const;
+
+    private:
+        static constexpr int skipToken = -1;
+        static constexpr int pieceOnly = -2;
+
+        const std::shared_ptr<const TokenizerService> m_tokenizer;
+        // source.spm id -> model source id.
+        std::vector<size_t> m_sourceIds;
+        // Model target id -> target.spm id, skipToken for the start and end tokens, or
+        // pieceOnly for a token target.spm does not have.
+        std::vector<int> m_targetPieceIds;
+        // Model target id -> token, for the pieceOnly ids.
+        std::unordered_map<size_t, std::string> m_pieceOnlyTokens;
+        size_t m_sourceEndId;
+    };
+
+}
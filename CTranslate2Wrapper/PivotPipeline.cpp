@@ -0,0 +1,186 @@
+#include "PivotPipeline.h"
+
+#include <future>
+
+#include "CTranslate2WrapperImpl.h"
+#include "SentenceSegmenter.h"
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// SentencePiece marks the start of a word with U+2581.
+		constexpr char wordBoundary[] = "\xE2\x96\x81";
+
+		bool startsWord(const std::string& piece)
+		{
+			return piece.compare(0, sizeof(wordBoundary) - 1, wordBoundary) == 0;
+		}
+	}
+
+	PieceRemap::PieceRemap(const CTranslate2WrapperImpl& first, const CTranslate2WrapperImpl& second)
+	{
+		const auto& from = first.model->get_target_vocabulary();
+		const auto& to = second.model->get_source_vocabulary();
+
+		m_table.assign(from.size(), unmapped);
+		for (size_t id = 0; id < from.size(); ++id)
+		{
+			const std::string& token = from.to_token(id);
+			// Special tokens are handled by the pipeline itself.
+			if (id == from.bos_id() || id == from.eos_id() || id == from.unk_id() || !to.contains(token))
+			{
+				continue;
+			}
+			m_table[id] = to.to_id(token);
+			++m_mappedCount;
+		}
+	}
+
+	PivotPipeline::PivotPipeline(const CTranslate2WrapperImpl& first,
+	                             const CTranslate2WrapperImpl& second,
+	                             std::shared_ptr<const PieceRemap> remap)
+		: m_first(first)
+		, m_second(second)
+		, m_remap(std::move(remap))
+	{
+	}
+
+	std::string PivotPipeline::translate(const std::string& text, const std::shared_ptr<const CancellationFlag>& cancellation) const
+	{
+		struct Sentence
+		{
+			std::string source;
+			std::string separator;
+			std::string cacheKey;
+			std::string translation;
+			bool cached = false;
+			std::future<std::vector<size_t>> firstStage;
+			std::future<std::vector<size_t>> secondStage;
+		};
+
+		const std::string pipelineId = m_first.nativeModelPath + ">" + m_second.nativeModelPath;
+
+		// 1. Split, answer what we can from the cache and post every first stage at once.
+		std::vector<Sentence> sentences;
+		for (const SentenceSegment& segment : segmentSentences(text))
+		{
+			Sentence sentence;
+			sentence.source = segment.text;
+			sentence.separator = segment.trailing;
+			sentences.push_back(std::move(sentence));
+		}
+
+		for (Sentence& sentence : sentences)
+		{
+			if (sentence.source.empty())
+			{
+				continue;
+			}
+
+			sentence.cacheKey = TranslationCache::makeKey(pipelineId, m_second.translationOptions, sentence.source);
+			if (auto cached = m_second.cache.find(sentence.cacheKey))
+			{
+				sentence.translation = std::move(*cached);
+				sentence.cached = true;
+				continue;
+			}
+
+			sentence.firstStage = m_first.translateIdsAsync(m_first.encodeSourceIds(sentence.source), cancellation);
+		}
+
+		// 2. Hand each intermediate hypothesis to the second model as soon as it is ready,
+		//    in order. The first model keeps decoding the next sentences meanwhile.
+		for (Sentence& sentence : sentences)
+		{
+			if (sentence.firstStage.valid())
+			{
+				sentence.secondStage = m_second.translateIdsAsync(remapHypothesis(sentence.firstStage.get()), cancellation);
+			}
+		}
+
+		// 3. Collect, detokenize with the second model's target SentencePiece model and rejoin.
+		std::string translation;
+		for (Sentence& sentence : sentences)
+		{
+			if (sentence.secondStage.valid())
+			{
+				sentence.translation = m_second.decodeTargetIds(sentence.secondStage.get());
+				m_second.cache.insert(sentence.cacheKey, sentence.translation);
+			}
+			translation += sentence.translation;
+			translation += sentence.separator;
+		}
+		return translation;
+	}
+
+	std::vector<size_t> PivotPipeline::remapHypothesis(const std::vector<size_t>& firstTargetIds) const
+	{
+		const auto& firstVocabulary = m_first.model->get_target_vocabulary();
+		const auto& secondVocabulary = m_second.model->get_source_vocabulary();
+
+		std::vector<size_t> secondSourceIds;
+		secondSourceIds.reserve(firstTargetIds.size() + 1);
+
+		// Walk the hypothesis one word at a time: [wordBegin, wordEnd).
+		size_t wordBegin = 0;
+		while (wordBegin < firstTargetIds.size())
+		{
+			size_t wordEnd = wordBegin + 1;
+			while (wordEnd < firstTargetIds.size() && !startsWord(firstVocabulary.to_token(firstTargetIds[wordEnd])))
+			{
+				++wordEnd;
+			}
+
+			bool mapped = true;
+			for (size_t i = wordBegin; i < wordEnd && mapped; ++i)
+			{
+				mapped = m_remap->map(firstTargetIds[i]) != PieceRemap::unmapped;
+			}
+
+			if (mapped)
+			{
+				for (size_t i = wordBegin; i < wordEnd; ++i)
+				{
+					secondSourceIds.push_back(m_remap->map(firstTargetIds[i]));
+				}
+			}
+			else
+			{
+				appendRetokenized(firstTargetIds, wordBegin, wordEnd, secondSourceIds);
+			}
+			wordBegin = wordEnd;
+		}
+
+		// Same truncation as toSourceIds, keeping room for the end token.
+		const size_t maxInputLength = m_second.translationOptions.max_input_length;
+		if (maxInputLength > 0 && secondSourceIds.size() >= maxInputLength)
+		{
+			secondSourceIds.resize(maxInputLength - 1);
+		}
+		secondSourceIds.push_back(secondVocabulary.eos_id());
+		return secondSourceIds;
+	}
+
+	void PivotPipeline::appendRetokenized(const std::vector<size_t>& firstTargetIds,
+	                                      size_t begin, size_t end,
+	                                      std::vector<size_t>& secondSourceIds) const
+	{
+		const auto& firstVocabulary = m_first.model->get_target_vocabulary();
+		const auto& secondVocabulary = m_second.model->get_source_vocabulary();
+		const CompactVocabulary* secondCompact = m_second.sourceVocabulary.get();
+
+		std::vector<std::string> pieces;
+		pieces.reserve(end - begin);
+		for (size_t i = begin; i < end; ++i)
+		{
+			pieces.push_back(firstVocabulary.to_token(firstTargetIds[i]));
+		}
+
+		for (const std::string& piece : m_second.tokenizer->encode(m_first.tokenizer->decode(pieces)))
+		{
+			const size_t id = secondCompact ? secondCompact->find(piece) : CompactVocabulary::npos;
+			secondSourceIds.push_back(id != CompactVocabulary::npos ? id : secondVocabulary.to_id(piece));
+		}
+	}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Cancellation.h"
+
+class CTranslate2WrapperImpl;
+
+namespace CTranslate2Wrapper::Native {
+
+    // Precomputed mapping from the target vocabulary of a first model to the source
+    // vocabulary of a second one. Both Opus-MT vocabularies are SentencePiece pieces
+    // of mostly English text, so the bulk of the pieces exist in both and can be
+    // handed over by id, without detokenizing and retokenizing the intermediate text.
+    class PieceRemap
+    {
+    public:
+        static constexpr size_t unmapped = std::numeric_limits<size_t>::max();
+
+        PieceRemap(const CTranslate2WrapperImpl& first, const CTranslate2WrapperImpl& second);
+
+        // Source id of the second model for a target id of the first, or unmapped.
+        size_t map(size_t firstTargetId) const
+        {
+            return firstTargetId < m_table.size() ? m_table[firstTargetId] : unmapped;
+        }
+
+        size_t mappedCount() const { return m_mappedCount; }
+
+    private:
+        std::vector<size_t> m_table;
+        size_t m_mappedCount = 0;
+    };
+
+    // Translates through an intermediate language: first (e.g. mul->en) then second
+    // (e.g. en->zh).
+    //
+    // The intermediate hypothesis is converted word by word. Words whose pieces all
+    // exist in the remap table are passed on by id; the others are detokenized with the
+    // first model's target SentencePiece model and re-encoded with the second model's
+    // source one.
+    //
+    // Multi-sentence input is split (see segmentSentences) and pipelined: all
+    // first-stage jobs are posted at once, and each sentence's second-stage job is
+    // posted as soon as its first stage is done. The two models have their own replica
+    // pools, so the second stage of sentence N runs while the first stage of sentence
+    // N+1 is being decoded.
+    class PivotPipeline
+    {
+    public:
+        PivotPipeline(const CTranslate2WrapperImpl& first,
+                      const CTranslate2WrapperImpl& second,
+                      std::shared_ptr<const PieceRemap> remap);
+
+        std::string translate(const std::string& text,
+                              const std::shared_ptr<const CancellationFlag>& cancellation = nullptr) const;
+
+        // Converts a first-stage hypothesis to second-stage source ids, end token included.
+        std::vector<size_t> remapHypothesis(const std::vector<size_t>& firstTargetIds) const;
+
+    private:
+        void appendRetokenized(const std::vector<size_t>& firstTargetIds,
+                               size_t begin, size_t end,
+                               std::vector<size_t>& secondSourceIds) const;
+
+        const CTranslate2WrapperImpl& m_first;
+        const CTranslate2WrapperImpl& m_second;
+        const std::shared_ptr<const PieceRemap> m_remap;
+    };
+
+}
@@ -0,0 +1,277 @@
+#include "ReplicaRunner.h"
+
+#include "CompactVocabulary.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		ctranslate2::models::EncoderDecoderReplica& asEncoderDecoder(ctranslate2::models::SequenceToSequenceReplica& replica)
+		{
+			auto* encoderDecoder = dynamic_cast<ctranslate2::models::EncoderDecoderReplica*>(&replica);
+			if (encoderDecoder == nullptr)
+			{
+				throw std::runtime_error("The model is not an encoder-decoder model.");
+			}
+			return *encoderDecoder;
+		}
+	}
+
+	EncoderDecoderRunner::EncoderDecoderRunner(ctranslate2::models::SequenceToSequenceReplica& replica)
+		: m_replica(asEncoderDecoder(replica))
+		, m_model(std::dynamic_pointer_cast<const ctranslate2::models::SequenceToSequenceModel>(replica.model()))
+	{
+		if (!m_model)
+		{
+			throw std::runtime_error("The model is not a sequence-to-sequence model.");
+		}
+
+		const auto& vocabulary = m_model->get_target_vocabulary();
+		const std::string* startToken = m_model->decoder_start_token();
+		m_startId = startToken ? vocabulary.to_id(*startToken) : vocabulary.bos_id();
+		m_endId = vocabulary.eos_id();
+	}
+
+	ctranslate2::layers::DecoderState EncoderDecoderRunner::encode(const std::vector<std::vector<size_t>>& sourceIds)
+	{
+		const auto deviceSetter = m_model->get_scoped_device_setter();
+		const ctranslate2::Device device = m_model->device();
+
+		ctranslate2::StorageView lengths(ctranslate2::DataType::INT32, device);
+		const ctranslate2::StorageView ids = ctranslate2::layers::make_sequence_inputs(
+			sourceIds, device, m_model->preferred_size_multiple(), &lengths);
+
+		auto& encoder = m_replica.encoder();
+		ctranslate2::StorageView memory(encoder.output_type(), device);
+		encoder(ids, lengths, memory);
+
+		ctranslate2::layers::DecoderState state = m_replica.decoder().initial_state();
+		state.emplace("memory", std::move(memory));
+		state.emplace("memory_lengths", std::move(lengths));
+		return state;
+	}
+
+	std::vector<ctranslate2::DecodingResult>
+	EncoderDecoderRunner::decode(ctranslate2::layers::DecoderState& state,
+	                             const std::vector<std::vector<size_t>>& targetPrefixIds,
+	                             ctranslate2::DecodingOptions options)
+	{
+		const auto deviceSetter = m_model->get_scoped_device_setter();
+
+		// The output layer may still be restricted by a previous request on this replica.
+		auto& decoder = m_replica.decoder();
+		decoder.update_output_layer(m_model->preferred_size_multiple(), m_outputIds);
+
+		std::vector<std::vector<size_t>> startIds;
+		startIds.reserve(targetPrefixIds.size());
+		for (const auto& prefix : targetPrefixIds)
+		{
+			std::vector<size_t> start;
+			start.reserve(prefix.size() + 1);
+			start.push_back(m_startId);
+			start.insert(start.end(), prefix.begin(), prefix.end());
+			startIds.emplace_back(std::move(start));
+		}
+
+		return ctranslate2::decode(decoder, state, std::move(startIds), { m_endId }, std::move(options));
+	}
+
+	ctranslate2::StorageView EncoderDecoderRunner::forwardTarget(const ctranslate2::layers::DecoderState& encoded,
+	                                                            const std::vector<size_t>& targetIds)
+	{
+		const auto deviceSetter = m_model->get_scoped_device_setter();
+		const ctranslate2::Device device = m_model->device();
+
+		auto& decoder = m_replica.decoder();
+		decoder.update_output_layer(m_model->preferred_size_multiple());
+
+		// Same setup as scoring: a non-iterative state over a copy of the encoder memory.
+		ctranslate2::layers::DecoderState state = decoder.initial_state(/*iterative_decoding=*/false);
+		state.emplace("memory", encoded.at("memory"));
+		state.emplace("memory_lengths", encoded.at("memory_lengths"));
+
+		std::vector<size_t> input;
+		input.reserve(targetIds.size() + 1);
+		input.push_back(m_startId);
+		input.insert(input.end(), targetIds.begin(), targetIds.end());
+
+		ctranslate2::StorageView lengths(ctranslate2::DataType::INT32, device);
+		const ctranslate2::StorageView ids = ctranslate2::layers::make_sequence_inputs({ input }, device, 1, &lengths);
+
+		ctranslate2::StorageView logits(decoder.output_type(), device);
+		decoder(ids, lengths, state, logits);
+
+		ctranslate2::StorageView hostLogits = toHostFloat32(logits);
+		hostLogits.reshape({ hostLogits.dim(-2), hostLogits.dim(-1) });
+		return hostLogits;
+	}
+
+	ctranslate2::StorageView EncoderDecoderRunner::step(ctranslate2::layers::DecoderState& state,
+	                                                   size_t step,
+	                                                   const std::vector<size_t>& inputIds)
+	{
+		const auto deviceSetter = m_model->get_scoped_device_setter();
+		const ctranslate2::Device device = m_model->device();
+
+		auto& decoder = m_replica.decoder();
+		decoder.update_output_layer(m_model->preferred_size_multiple());
+
+		const std::vector<int32_t> ids(inputIds.begin(), inputIds.end());
+		const ctranslate2::StorageView input({ static_cast<ctranslate2::dim_t>(ids.size()) }, ids, device);
+		ctranslate2::StorageView logits(decoder.output_type(), device);
+		decoder(static_cast<ctranslate2::dim_t>(step), input, state, &logits);
+
+		ctranslate2::StorageView hostLogits = toHostFloat32(logits);
+		hostLogits.reshape({ static_cast<ctranslate2::dim_t>(ids.size()), hostLogits.dim(-1) });
+		return hostLogits;
+	}
+
+	void EncoderDecoderRunner::keepRows(ctranslate2::layers::DecoderState& state, const std::vector<size_t>& rows)
+	{
+		const auto deviceSetter = m_model->get_scoped_device_setter();
+		const std::vector<int32_t> indices(rows.begin(), rows.end());
+		m_replica.decoder().update_state(state, ctranslate2::StorageView({ static_cast<ctranslate2::dim_t>(indices.size()) }, indices, m_model->device()));
+	}
+
+	ctranslate2::StorageView toHostFloat32(const ctranslate2::StorageView& tensor)
+	{
+		ctranslate2::StorageView host = tensor.device() == ctranslate2::Device::CPU ? tensor : tensor.to(ctranslate2::Device::CPU);
+		return host.dtype() == ctranslate2::DataType::FLOAT32 ? host : host.to_float32();
+	}
+
+	size_t selectGreedyToken(const float* logits,
+	                         size_t vocabularySize,
+	                         const std::vector<size_t>& previousIds,
+	                         size_t position,
+	                         const ctranslate2::DecodingOptions& options,
+	                         size_t endId)
+	{
+		std::vector<float> scores(logits, logits + vocabularySize);
+
+		if (options.repetition_penalty != 1)
+		{
+			std::vector<size_t> penalized(previousIds);
+			std::sort(penalized.begin(), penalized.end());
+			penalized.erase(std::unique(penalized.begin(), penalized.end()), penalized.end());
+			for (const size_t id : penalized)
+			{
+				if (id < vocabularySize)
+				{
+					float& score = scores[id];
+					score = score < 0 ? score * options.repetition_penalty : score / options.repetition_penalty;
+				}
+			}
+		}
+
+		constexpr float disabled = std::numeric_limits<float>::lowest();
+		for (const size_t id : options.disable_ids)
+		{
+			if (id < vocabularySize)
+				scores[id] = disabled;
+		}
+		if (position == 0)
+		{
+			for (const size_t id : options.disable_ids_begin)
+			{
+				if (id < vocabularySize)
+					scores[id] = disabled;
+			}
+		}
+		if (position < options.min_length && endId < vocabularySize)
+		{
+			scores[endId] = disabled;
+		}
+
+		return static_cast<size_t>(std::max_element(scores.begin(), scores.end()) - scores.begin());
+	}
+
+	ctranslate2::DecodingOptions makeDecodingOptions(const ctranslate2::TranslationOptions& options,
+	                                                 const ctranslate2::Vocabulary& targetVocabulary)
+	{
+		ctranslate2::DecodingOptions decoding;
+		decoding.beam_size = options.beam_size;
+		decoding.patience = options.patience;
+		decoding.length_penalty = options.length_penalty;
+		decoding.coverage_penalty = options.coverage_penalty;
+		decoding.repetition_penalty = options.repetition_penalty;
+		decoding.no_repeat_ngram_size = options.no_repeat_ngram_size;
+		decoding.prefix_bias_beta = options.prefix_bias_beta;
+		decoding.max_length = options.max_decoding_length;
+		decoding.min_length = options.min_decoding_length;
+		decoding.sampling_topk = options.sampling_topk;
+		decoding.sampling_topp = options.sampling_topp;
+		decoding.sampling_temperature = options.sampling_temperature;
+		decoding.num_hypotheses = options.num_hypotheses;
+		decoding.include_eos_in_hypotheses = options.return_end_token;
+		decoding.return_scores = options.return_scores;
+		decoding.return_attention = options.return_attention;
+		decoding.return_alternatives = options.return_alternatives;
+		decoding.min_alternative_expansion_prob = options.min_alternative_expansion_prob;
+		if (options.disable_unk)
+		{
+			decoding.disable_ids.push_back(targetVocabulary.unk_id());
+		}
+		return decoding;
+	}
+
+	std::vector<std::vector<size_t>> toSourceIds(const ctranslate2::models::SequenceToSequenceModel& model,
+	                                             const std::vector<std::vector<std::string>>& pieces,
+	                                             size_t maxInputLength)
+	{
+		return model.get_source_vocabulary().to_ids(pieces, maxInputLength, model.with_source_bos(), model.with_source_eos());
+	}
+
+	std::vector<std::vector<size_t>> toSourceIds(const ctranslate2::models::SequenceToSequenceModel& model,
+	                                             const CompactVocabulary* vocabulary,
+	                                             const std::vector<std::vector<std::string>>& pieces,
+	                                             size_t maxInputLength)
+	{
+		// Start and end tokens added by the model config keep going through the full path.
+		if (!vocabulary || model.with_source_bos() || model.with_source_eos())
+		{
+			return toSourceIds(model, pieces, maxInputLength);
+		}
+
+		const size_t unkId = model.get_source_vocabulary().unk_id();
+		std::vector<std::vector<size_t>> batchIds;
+		batchIds.reserve(pieces.size());
+		for (const std::vector<std::string>& example : pieces)
+		{
+			const size_t length = maxInputLength > 0 ? std::min(example.size(), maxInputLength) : example.size();
+			std::vector<size_t> ids;
+			ids.reserve(length);
+			for (size_t i = 0; i < length; ++i)
+			{
+				const size_t id = vocabulary->find(example[i]);
+				ids.push_back(id == CompactVocabulary::npos ? unkId : id);
+			}
+			batchIds.emplace_back(std::move(ids));
+		}
+		return batchIds;
+	}
+
+	std::vector<std::string> toTargetPieces(const ctranslate2::models::SequenceToSequenceModel& model,
+	                                        const std::vector<size_t>& ids)
+	{
+		const auto& vocabulary = model.get_target_vocabulary();
+		const size_t bosId = vocabulary.bos_id();
+		const size_t eosId = vocabulary.eos_id();
+
+		std::vector<std::string> pieces;
+		pieces.reserve(ids.size());
+		for (const size_t id : ids)
+		{
+			if (id == bosId || id == eosId)
+			{
+				continue;
+			}
+			pieces.push_back(vocabulary.to_token(id));
+		}
+		return pieces;
+	}
+
+}
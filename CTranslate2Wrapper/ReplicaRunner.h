@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+#include <ctranslate2/models/sequence_to_sequence.h>
+#include <ctranslate2/translation.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    class CompactVocabulary;
+
+    // Drives the encoder and decoder of one model replica directly instead of going
+    // through SequenceToSequenceReplica::translate. This is what lets the wrapper plug
+    // its own logits processors and callbacks into the decoding loop.
+    //
+    // A runner must only be used on the replica's worker thread, i.e. from a function
+    // posted with ReplicaPool::post.
+    class EncoderDecoderRunner
+    {
+    public:
+        explicit EncoderDecoderRunner(ctranslate2::models::SequenceToSequenceReplica& replica);
+
+        const ctranslate2::models::SequenceToSequenceModel& model() const { return *m_model; }
+        ctranslate2::layers::Decoder& decoder() { return m_replica.decoder(); }
+
+        size_t startId() const { return m_startId; }
+        size_t endId() const { return m_endId; }
+
+        // Restricts the output layer of decode() to these target ids, e.g. the candidates
+        // of a VocabularyMap (unique and sorted). Empty means the full vocabulary.
+        void restrictOutput(std::vector<size_t> outputIds) { m_outputIds = std::move(outputIds); }
+        const std::vector<size_t>& outputIds() const { return m_outputIds; }
+
+        // Runs the encoder on a batch of source ids and returns a decoder state
+        // holding the encoder memory.
+        ctranslate2::layers::DecoderState encode(const std::vector<std::vector<size_t>>& sourceIds);
+
+        // Decodes from an encoded state. Each target prefix is forced before the search
+        // continues; pass empty prefixes to decode freely. The hypotheses contain model
+        // target ids, prefix included.
+        std::vector<ctranslate2::DecodingResult>
+        decode(ctranslate2::layers::DecoderState& state,
+               const std::vector<std::vector<size_t>>& targetPrefixIds,
+               ctranslate2::DecodingOptions options);
+
+        // Runs the decoder over [start] + targetIds in one parallel pass and returns the
+        // float32 host logits, shape [targetIds.size() + 1, vocabulary]. Row i holds the
+        // prediction for the token following targetIds[0..i). The encoded state is not modified.
+        // The full vocabulary is always scored, whatever restrictOutput was given.
+        ctranslate2::StorageView forwardTarget(const ctranslate2::layers::DecoderState& encoded,
+                                               const std::vector<size_t>& targetIds);
+
+        // Runs one step of an iterative state for all its rows at once. inputIds holds
+        // the previous token of each row, the start token at step 0. Returns the float32
+        // host logits, shape [rows, output size]; like forwardTarget, the full vocabulary
+        // is scored.
+        ctranslate2::StorageView step(ctranslate2::layers::DecoderState& state,
+                                      size_t step,
+                                      const std::vector<size_t>& inputIds);
+
+        // Keeps the given rows of an iterative state, in that order, and drops the others.
+        void keepRows(ctranslate2::layers::DecoderState& state, const std::vector<size_t>& rows);
+
+    private:
+        ctranslate2::models::EncoderDecoderReplica& m_replica;
+        std::shared_ptr<const ctranslate2::models::SequenceToSequenceModel> m_model;
+        size_t m_startId;
+        size_t m_endId;
+        std::vector<size_t> m_outputIds;
+    };
+
+    // Copies a tensor to host memory as float32, the form in which logits are inspected.
+    ctranslate2::StorageView toHostFloat32(const ctranslate2::StorageView& tensor);
+
+    // Picks the token greedy search would select from one row of logits, applying the
+    // repetition penalty, disabled ids and minimum length the same way ctranslate2::decode
+    // does. previousIds are the tokens generated before this position.
+    size_t selectGreedyToken(const float* logits,
+                             size_t vocabularySize,
+                             const std::vector<size_t>& previousIds,
+                             size_t position,
+                             const ctranslate2::DecodingOptions& options,
+                             size_t endId);
+
+    // Maps the translation options used by the wrapper to the lower level decoding options,
+    // the same way SequenceToSequenceReplica::translate does.
+    ctranslate2::DecodingOptions makeDecodingOptions(const ctranslate2::TranslationOptions& options,
+                                                     const ctranslate2::Vocabulary& targetVocabulary);
+
+    // Converts source pieces to model ids, truncated to maxInputLength (0 disables truncation).
+    std::vector<std::vector<size_t>> toSourceIds(const ctranslate2::models::SequenceToSequenceModel& model,
+                                                 const std::vector<std::vector<std::string>>& pieces,
+                                                 size_t maxInputLength);
+
+    // Same, looking the pieces up in the model's compiled vocabulary when there is one
+    // (see CompactVocabulary). Falls back to the ctranslate2::Vocabulary otherwise.
+    std::vector<std::vector<size_t>> toSourceIds(const ctranslate2::models::SequenceToSequenceModel& model,
+                                                 const CompactVocabulary* vocabulary,
+                                                 const std::vector<std::vector<std::string>>& pieces,
+                                                 size_t maxInputLength);
+
+    // Converts a hypothesis to target pieces, dropping the start and end tokens.
+    std::vector<std::string> toTargetPieces(const ctranslate2::models::SequenceToSequenceModel& model,
+                                            const std::vector<size_t>& ids);
+
+}
@@ -0,0 +1,469 @@
+#include "RequestScheduler.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace CTranslate2Wrapper::Native {
+
+	const char* requestClassName(RequestClass requestClass)
+	{
+		switch (requestClass)
+		{
+		case RequestClass::Interactive: return "interactive";
+		case RequestClass::Bulk: return "bulk";
+		case RequestClass::Background: return "background";
+		default: return "unknown";
+		}
+	}
+
+	namespace {
+		// Requests one lock-free queue holds before a submitter has to wait for a replica.
+		constexpr size_t queueCapacity = 1024;
+	}
+
+	const char* schedulingModeName(SchedulingMode mode)
+	{
+		switch (mode)
+		{
+		case SchedulingMode::Fifo: return "fifo";
+		case SchedulingMode::Priority: return "priority";
+		case SchedulingMode::WorkStealing: return "work stealing";
+		default: return "unknown";
+		}
+	}
+
+	RequestScheduler::RequestScheduler(Pool& pool, SchedulingMode mode, long maxQueued)
+		: m_pool(pool)
+		, m_mode(mode)
+		, m_replicas(std::max<size_t>(pool.num_replicas(), 1))
+		// The automatic value is the pool's own default.
+		, m_maxQueued(maxQueued < 0 ? std::numeric_limits<size_t>::max() : maxQueued == 0 ? 4 * m_replicas : static_cast<size_t>(maxQueued))
+	{
+		if (m_mode == SchedulingMode::WorkStealing)
+		{
+			for (size_t i = 0; i < m_replicas; ++i)
+			{
+				m_bulkQueues.push_back(std::make_unique<RequestQueue>(queueCapacity));
+			}
+			m_interactiveQueue = std::make_unique<RequestQueue>(queueCapacity);
+			m_backgroundQueue = std::make_unique<RequestQueue>(queueCapacity);
+			m_slots = std::make_unique<std::atomic<const Replica*>[]>(m_replicas);
+		}
+	}
+
+	RequestScheduler::~RequestScheduler()
+	{
+		if (m_mode != SchedulingMode::WorkStealing)
+		{
+			return;
+		}
+
+		// The pool is gone; whatever is left was never picked up.
+		std::vector<RequestQueue*> queues = { m_interactiveQueue.get(), m_backgroundQueue.get() };
+		for (const auto& queue : m_bulkQueues)
+		{
+			queues.push_back(queue.get());
+		}
+		for (RequestQueue* queue : queues)
+		{
+			QueuedRequest* queued = nullptr;
+			while (queue->tryPop(queued))
+			{
+				delete queued;
+			}
+		}
+	}
+
+	void RequestScheduler::submit(RequestClass requestClass,
+	                              std::optional<Clock::time_point> deadline,
+	                              std::function<void(Replica&)> run,
+	                              std::function<void()> expire)
+	{
+		const size_t index = static_cast<size_t>(requestClass);
+		m_counters[index].submitted.fetch_add(1, std::memory_order_relaxed);
+
+		Request request{ requestClass, Clock::now(), std::move(run), std::move(expire) };
+		const Key key{ deadline.value_or(Clock::time_point::max()), 0 };
+
+		if (m_mode == SchedulingMode::WorkStealing)
+		{
+			submitStealing(requestClass, std::make_unique<QueuedRequest>(QueuedRequest{ key.first, std::move(request) }));
+			return;
+		}
+		if (m_mode == SchedulingMode::Fifo)
+		{
+			// Straight into the pool's FIFO; the deadline is checked when the job starts.
+			m_pool.post<bool>([this, request = std::move(request), deadline = key.first](Replica& replica) mutable
+				{
+					if (Clock::now() > deadline)
+					{
+						m_counters[static_cast<size_t>(request.requestClass)].expired.fetch_add(1, std::memory_order_relaxed);
+						request.expire();
+						return false;
+					}
+					runRequest(request, replica);
+					return true;
+				});
+			return;
+		}
+
+		size_t pullJobs = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if (requestClass != RequestClass::Interactive)
+			{
+				// Keystrokes are never held back, so they do not count against the bound.
+				m_dequeued.wait(lock, [this]
+					{
+						return m_pending - m_queues[static_cast<size_t>(RequestClass::Interactive)].size() < m_maxQueued;
+					});
+			}
+			m_queues[index].emplace(Key{ key.first, m_sequence++ }, std::move(request));
+			++m_pending;
+			pullJobs = pullJobsNeeded();
+			m_pullJobs += pullJobs;
+		}
+		postPullJobs(pullJobs);
+	}
+
+	size_t RequestScheduler::pullJobsNeeded() const
+	{
+		// One queued pull job per replica is enough to keep them all busy.
+		const size_t wanted = std::min(m_pending, m_replicas);
+		return wanted > m_pullJobs ? wanted - m_pullJobs : 0;
+	}
+
+	void RequestScheduler::postPullJobs(size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			// The future is not needed: runNext reports through each request's own promise.
+			m_pool.post<bool>([this](Replica& replica)
+				{
+					runNext(replica);
+					return true;
+				});
+		}
+	}
+
+	bool RequestScheduler::canStart(RequestClass requestClass) const
+	{
+		if (requestClass != RequestClass::Background)
+		{
+			return true;
+		}
+		if (!m_queues[static_cast<size_t>(RequestClass::Interactive)].empty())
+		{
+			return false;
+		}
+
+		size_t running = 0;
+		for (const size_t count : m_running)
+		{
+			running += count;
+		}
+		// The replica running this pull job is free; keep another one free for keystrokes.
+		const size_t backgroundReplicas = m_replicas > 1 ? m_replicas - 1 : 1;
+		return running < backgroundReplicas;
+	}
+
+	void RequestScheduler::runNext(Replica& replica)
+	{
+		std::vector<std::function<void()>> expired;
+		std::optional<Request> next;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			--m_pullJobs;
+
+			const Clock::time_point now = Clock::now();
+			for (size_t index = 0; index < classCount && !next; ++index)
+			{
+				auto& queue = m_queues[index];
+				while (!queue.empty())
+				{
+					auto first = queue.begin();
+					// Earliest deadline first, so the expired requests are at the front.
+					if (first->first.first < now)
+					{
+						m_counters[index].expired.fetch_add(1, std::memory_order_relaxed);
+						expired.push_back(std::move(first->second.expire));
+						queue.erase(first);
+						--m_pending;
+						continue;
+					}
+					if (canStart(static_cast<RequestClass>(index)))
+					{
+						next = std::move(first->second);
+						queue.erase(first);
+						--m_pending;
+						++m_running[index];
+					}
+					break;
+				}
+			}
+		}
+
+		if (next || !expired.empty())
+		{
+			m_dequeued.notify_all();
+		}
+		for (auto& expire : expired)
+		{
+			expire();
+		}
+		if (!next)
+		{
+			// Whatever is left is background work held back for now; the next request
+			// to finish posts a pull job for it.
+			return;
+		}
+
+		runRequest(*next, replica);
+
+		size_t pullJobs = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			--m_running[static_cast<size_t>(next->requestClass)];
+			pullJobs = pullJobsNeeded();
+			m_pullJobs += pullJobs;
+		}
+		postPullJobs(pullJobs);
+	}
+
+	void RequestScheduler::runRequest(Request& request, Replica& replica)
+	{
+		const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - request.submitted);
+		m_counters[static_cast<size_t>(request.requestClass)].wait.record(static_cast<uint64_t>(waited.count()));
+		// run catches everything into the request's promise.
+		request.run(replica);
+	}
+
+	void RequestScheduler::submitStealing(RequestClass requestClass, std::unique_ptr<QueuedRequest> queued)
+	{
+		const size_t index = static_cast<size_t>(requestClass);
+		std::vector<RequestQueue*> candidates;
+		if (requestClass == RequestClass::Bulk)
+		{
+			// Round robin; a full queue passes the request on to the next one.
+			const size_t first = m_nextBulkQueue.fetch_add(1, std::memory_order_relaxed);
+			for (size_t i = 0; i < m_replicas; ++i)
+			{
+				candidates.push_back(m_bulkQueues[(first + i) % m_replicas].get());
+			}
+		}
+		else
+		{
+			candidates.push_back(requestClass == RequestClass::Interactive ? m_interactiveQueue.get() : m_backgroundQueue.get());
+		}
+
+		// Keystrokes are never held back, so they do not count against the bound.
+		if (requestClass != RequestClass::Interactive)
+		{
+			waitForRoom([this]
+				{
+					size_t queued = m_boundedQueued.load();
+					while (queued < m_maxQueued)
+					{
+						if (m_boundedQueued.compare_exchange_weak(queued, queued + 1))
+						{
+							return true;
+						}
+					}
+					return false;
+				});
+		}
+
+		// Counted before it is visible, so a puller about to leave sees it (runStealing).
+		m_queued[index].fetch_add(1);
+		QueuedRequest* raw = queued.release();
+		// Every queue full: wait for the replicas, like a full pool queue would.
+		waitForRoom([&candidates, &raw]
+			{
+				return std::any_of(candidates.begin(), candidates.end(), [&raw](RequestQueue* queue) { return queue->tryPush(raw); });
+			});
+
+		// Wake a replica, unless all of them are already pulling.
+		size_t pullers = m_pullers.load();
+		while (pullers < m_replicas)
+		{
+			if (m_pullers.compare_exchange_weak(pullers, pullers + 1))
+			{
+				m_pool.post<bool>([this](Replica& replica)
+					{
+						runStealing(replica);
+						return true;
+					});
+				break;
+			}
+		}
+	}
+
+	void RequestScheduler::waitForRoom(const std::function<bool()>& ready)
+	{
+		if (ready())
+		{
+			return;
+		}
+		// Sleep until a replica takes a request. popLive only wakes announced submitters;
+		// with a fence on both sides, either it sees this one or ready() sees what it freed.
+		m_waitingForRoom.fetch_add(1);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		{
+			std::unique_lock<std::mutex> lock(m_roomMutex);
+			m_room.wait(lock, ready);
+		}
+		m_waitingForRoom.fetch_sub(1);
+	}
+
+	void RequestScheduler::runStealing(Replica& replica)
+	{
+		const size_t slot = slotOf(replica);
+		for (;;)
+		{
+			// The replica goes back to the pool as soon as there is nothing to take.
+			while (std::unique_ptr<QueuedRequest> next = takeStealing(slot))
+			{
+				m_busy.fetch_add(1);
+				runRequest(next->request, replica);
+				m_busy.fetch_sub(1);
+			}
+
+			// Leave, unless a request was queued after the last look: its submitter saw
+			// this replica pulling and did not post a job for it.
+			m_pullers.fetch_sub(1);
+			const bool runnable = m_queued[static_cast<size_t>(RequestClass::Interactive)].load() > 0
+				|| m_queued[static_cast<size_t>(RequestClass::Bulk)].load() > 0
+				|| (m_queued[static_cast<size_t>(RequestClass::Background)].load() > 0 && canStartBackground());
+			if (!runnable)
+			{
+				return;
+			}
+			size_t pullers = m_pullers.load();
+			do
+			{
+				if (pullers >= m_replicas)
+				{
+					return;
+				}
+			} while (!m_pullers.compare_exchange_weak(pullers, pullers + 1));
+		}
+	}
+
+	std::unique_ptr<RequestScheduler::QueuedRequest> RequestScheduler::takeStealing(size_t slot)
+	{
+		std::unique_ptr<QueuedRequest> next;
+		if (popLive(*m_interactiveQueue, RequestClass::Interactive, next))
+		{
+			return next;
+		}
+		if (popLive(*m_bulkQueues[slot], RequestClass::Bulk, next))
+		{
+			return next;
+		}
+
+		// Steal, starting at a random replica so idle ones do not all hit the same queue.
+		thread_local std::minstd_rand random(static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+		const size_t first = random() % m_replicas;
+		for (size_t i = 0; i < m_replicas; ++i)
+		{
+			const size_t victim = (first + i) % m_replicas;
+			if (victim != slot && popLive(*m_bulkQueues[victim], RequestClass::Bulk, next))
+			{
+				return next;
+			}
+		}
+
+		// Checked before the pop, so two replicas may both start background work at the
+		// edge of the limit; it is a soft one.
+		if (canStartBackground() && popLive(*m_backgroundQueue, RequestClass::Background, next))
+		{
+			return next;
+		}
+		return nullptr;
+	}
+
+	bool RequestScheduler::popLive(RequestQueue& queue, RequestClass requestClass, std::unique_ptr<QueuedRequest>& next)
+	{
+		const size_t index = static_cast<size_t>(requestClass);
+		QueuedRequest* raw = nullptr;
+		while (queue.tryPop(raw))
+		{
+			m_queued[index].fetch_sub(1);
+			if (requestClass != RequestClass::Interactive)
+			{
+				m_boundedQueued.fetch_sub(1);
+			}
+			// The slot may be what a submitter is waiting for (waitForRoom).
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (m_waitingForRoom.load(std::memory_order_relaxed) > 0)
+			{
+				std::lock_guard<std::mutex> lock(m_roomMutex);
+				m_room.notify_all();
+			}
+			std::unique_ptr<QueuedRequest> queued(raw);
+			if (queued->deadline < Clock::now())
+			{
+				m_counters[index].expired.fetch_add(1, std::memory_order_relaxed);
+				queued->request.expire();
+				continue;
+			}
+			next = std::move(queued);
+			return true;
+		}
+		return false;
+	}
+
+	bool RequestScheduler::canStartBackground() const
+	{
+		if (m_queued[static_cast<size_t>(RequestClass::Interactive)].load() > 0)
+		{
+			return false;
+		}
+		// Same rule as canStart: keep a replica free for keystrokes.
+		const size_t backgroundReplicas = m_replicas > 1 ? m_replicas - 1 : 1;
+		return m_busy.load() < backgroundReplicas;
+	}
+
+	size_t RequestScheduler::slotOf(const Replica& replica)
+	{
+		for (size_t i = 0; i < m_replicas; ++i)
+		{
+			const Replica* owner = m_slots[i].load(std::memory_order_acquire);
+			if (owner == nullptr && m_slots[i].compare_exchange_strong(owner, &replica, std::memory_order_acq_rel))
+			{
+				return i;
+			}
+			if (owner == &replica)
+			{
+				return i;
+			}
+		}
+		// One replica per pool thread, so every one finds a slot.
+		return 0;
+	}
+
+	RequestClassStatistics RequestScheduler::statistics(RequestClass requestClass) const
+	{
+		const ClassCounters& counters = m_counters[static_cast<size_t>(requestClass)];
+		RequestClassStatistics statistics;
+		statistics.submitted = counters.submitted.load(std::memory_order_relaxed);
+		statistics.expired = counters.expired.load(std::memory_order_relaxed);
+		statistics.wait = counters.wait.snapshot();
+		return statistics;
+	}
+
+	void RequestScheduler::resetStatistics()
+	{
+		for (ClassCounters& counters : m_counters)
+		{
+			counters.submitted.store(0, std::memory_order_relaxed);
+			counters.expired.store(0, std::memory_order_relaxed);
+			counters.wait.reset();
+		}
+	}
+
+}
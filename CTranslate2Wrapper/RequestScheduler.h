@@ -0,0 +1,233 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <ctranslate2/models/sequence_to_sequence.h>
+#include <ctranslate2/replica_pool.h>
+
+#include "Cancellation.h"
+#include "MpmcQueue.h"
+#include "StageMetrics.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // Who is waiting for a request, most urgent first.
+    enum class RequestClass
+    {
+        Interactive, // A keystroke query or pivot stage: someone is looking at the palette
+        Bulk,        // translateBatch and multi-sentence text
+        Background,  // Calibration and other work nobody waits for
+        Count
+    };
+
+    const char* requestClassName(RequestClass requestClass);
+
+    // How RequestScheduler hands requests to the replicas.
+    enum class SchedulingMode
+    {
+        Fifo,         // Straight into the pool, in submission order
+        Priority,     // By class, then earliest deadline, behind one lock
+        WorkStealing, // By class, through per-replica lock-free queues
+    };
+
+    const char* schedulingModeName(SchedulingMode mode);
+
+    // Thrown instead of running a request whose deadline passed while it was queued.
+    // It is a cancellation: the caller has moved on.
+    class DeadlineExceeded : public TranslationCanceled
+    {
+    public:
+        DeadlineExceeded()
+            : TranslationCanceled("The translation waited past its deadline.")
+        {
+        }
+    };
+
+    struct RequestClassStatistics
+    {
+        size_t submitted = 0;
+        size_t expired = 0;
+        // From submission until a replica starts the request, in microseconds.
+        LatencyHistogram::Snapshot wait;
+    };
+
+    // Orders the requests of one translator in front of its ReplicaPool.
+    //
+    // ctranslate2::ThreadPool serves jobs from a single FIFO, so a bulk batch posted
+    // first delays the keystroke query behind it. Requests are kept here instead, by
+    // class and then by earliest deadline, and the pool only ever holds "pull" jobs: each
+    // one runs whatever request is the most urgent when a replica picks it up. At most
+    // one pull job per replica is queued in the pool, so a full pool queue no longer
+    // blocks the submitter of a keystroke query.
+    //
+    // - Interactive requests always go first.
+    // - A request whose deadline passed is dropped with DeadlineExceeded before it reaches
+    //   a replica.
+    // - Background requests only start when no interactive request is queued, and never
+    //   on the last free replica of a multi-replica pool, which stays available for the
+    //   next keystroke.
+    //
+    // In Fifo mode, requests go straight to the pool in submission order; deadlines and
+    // wait metrics still apply.
+    //
+    // Work stealing keeps the class rules but drops the lock and the pool queue from the
+    // path of every request, for many small requests on many replicas:
+    // - Bulk requests are spread round robin over one lock-free queue per replica.
+    //   Interactive and background requests have a lock-free queue each.
+    // - A pull job keeps running requests, own queue first, until there are none left,
+    //   instead of going back through the pool's queue after each one. An idle replica
+    //   steals from the queue of another, starting at a random one.
+    // - Pull jobs are only posted when fewer replicas than that are busy pulling.
+    // Requests of a class run in submission order; an expired one is still dropped when
+    // it is picked.
+    //
+    // The pool's queue bound (TranslatorConfig::maxQueuedBatches) only holds back posts in
+    // Fifo mode; the other modes apply it themselves. A bulk or background submitter waits
+    // while that many bulk and background requests are queued; an interactive one only
+    // waits for a full lock-free queue.
+    class RequestScheduler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Replica = ctranslate2::models::SequenceToSequenceReplica;
+        using Pool = ctranslate2::ReplicaPool<Replica>;
+
+        // The scheduler must outlive the pool's worker threads: pull jobs still queued
+        // when the pool shuts down run against it. maxQueued reads like
+        // TranslatorConfig::maxQueuedBatches: 0 is 4 per replica, -1 is unbounded.
+        RequestScheduler(Pool& pool, SchedulingMode mode, long maxQueued);
+        ~RequestScheduler();
+
+        RequestScheduler(const RequestScheduler&) = delete;
+        RequestScheduler& operator=(const RequestScheduler&) = delete;
+
+        // Runs func(replica) on the first free replica, in the order described above.
+        template <typename Result, typename Func>
+        std::future<Result> post(RequestClass requestClass, Func func, std::optional<Clock::time_point> deadline = std::nullopt)
+        {
+            auto promise = std::make_shared<std::promise<Result>>();
+            std::future<Result> future = promise->get_future();
+            submit(requestClass, deadline,
+                [promise, func = std::move(func)](Replica& replica) mutable
+                {
+                    try
+                    {
+                        promise->set_value(func(replica));
+                    }
+                    catch (...)
+                    {
+                        promise->set_exception(std::current_exception());
+                    }
+                },
+                [promise]
+                {
+                    promise->set_exception(std::make_exception_ptr(DeadlineExceeded()));
+                });
+            return future;
+        }
+
+        SchedulingMode mode() const { return m_mode; }
+
+        RequestClassStatistics statistics(RequestClass requestClass) const;
+        void resetStatistics();
+
+    private:
+        static constexpr size_t classCount = static_cast<size_t>(RequestClass::Count);
+
+        struct Request
+        {
+            RequestClass requestClass;
+            Clock::time_point submitted;
+            std::function<void(Replica&)> run;
+            std::function<void()> expire;
+        };
+
+        // Earliest deadline first, then submission order.
+        using Key = std::pair<Clock::time_point, uint64_t>;
+
+        struct ClassCounters
+        {
+            std::atomic<size_t> submitted{ 0 };
+            std::atomic<size_t> expired{ 0 };
+            LatencyHistogram wait;
+        };
+
+        void submit(RequestClass requestClass,
+                    std::optional<Clock::time_point> deadline,
+                    std::function<void(Replica&)> run,
+                    std::function<void()> expire);
+
+        // Body of a pull job: runs the most urgent runnable request, if any.
+        void runNext(Replica& replica);
+        void runRequest(Request& request, Replica& replica);
+        // Pull jobs to post so that every pending request can be picked up. Locked.
+        size_t pullJobsNeeded() const;
+        void postPullJobs(size_t count);
+        bool canStart(RequestClass requestClass) const;
+
+        // Work stealing. A queued request is owned by its queue until it is popped.
+        struct QueuedRequest
+        {
+            Clock::time_point deadline;
+            Request request;
+        };
+        using RequestQueue = MpmcQueue<QueuedRequest*>;
+
+        void submitStealing(RequestClass requestClass, std::unique_ptr<QueuedRequest> queued);
+        // Body of a pull job: runs requests until none is left for this replica.
+        void runStealing(Replica& replica);
+        // Returns once ready() holds; it is tried again each time popLive takes a request.
+        void waitForRoom(const std::function<bool()>& ready);
+        std::unique_ptr<QueuedRequest> takeStealing(size_t slot);
+        bool popLive(RequestQueue& queue, RequestClass requestClass, std::unique_ptr<QueuedRequest>& next);
+        bool canStartBackground() const;
+        // Index of the replica's own bulk queue, claimed the first time it pulls.
+        size_t slotOf(const Replica& replica);
+
+        Pool& m_pool;
+        const SchedulingMode m_mode;
+        const size_t m_replicas;
+        // Bulk and background requests queued before their submitters wait.
+        const size_t m_maxQueued;
+
+        mutable std::mutex m_mutex;
+        // Signaled when pending requests leave the queues.
+        std::condition_variable m_dequeued;
+        std::array<std::map<Key, Request>, classCount> m_queues;
+        std::array<size_t, classCount> m_running{};
+        size_t m_pending = 0;
+        size_t m_pullJobs = 0;
+        uint64_t m_sequence = 0;
+
+        std::array<ClassCounters, classCount> m_counters;
+
+        std::vector<std::unique_ptr<RequestQueue>> m_bulkQueues;
+        std::unique_ptr<RequestQueue> m_interactiveQueue;
+        std::unique_ptr<RequestQueue> m_backgroundQueue;
+        std::unique_ptr<std::atomic<const Replica*>[]> m_slots;
+        std::atomic<size_t> m_nextBulkQueue{ 0 };
+        std::array<std::atomic<size_t>, classCount> m_queued{};
+        std::atomic<size_t> m_busy{ 0 };
+        // Pull jobs queued in the pool or looping on a replica.
+        std::atomic<size_t> m_pullers{ 0 };
+        // Bulk and background requests counted against m_maxQueued.
+        std::atomic<size_t> m_boundedQueued{ 0 };
+        // Submitters asleep until a queue has room again (waitForRoom).
+        std::mutex m_roomMutex;
+        std::condition_variable m_room;
+        std::atomic<size_t> m_waitingForRoom{ 0 };
+    };
+
+}
@@ -0,0 +1,419 @@
+#include "SelfSpeculativeDecoding.h"
+
+#include "SpeculativeDraft.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <ctranslate2/ops/concat.h>
+#include <ctranslate2/ops/mul.h>
+#include <ctranslate2/ops/slide.h>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// The layers and parameters of TransformerDecoder are protected. Pointers to
+		// members formed through a derived class reach them without touching the object.
+		struct DecoderAccess : ctranslate2::layers::TransformerDecoder
+		{
+			using Base = ctranslate2::layers::TransformerDecoder;
+
+			static const auto& layers(const Base& decoder) { return decoder.*(&DecoderAccess::_layers); }
+			static const auto& embeddings(const Base& decoder) { return decoder.*(&DecoderAccess::_embeddings); }
+			static const auto& embeddingsScale(const Base& decoder) { return decoder.*(&DecoderAccess::_embeddings_scale); }
+			static bool startFromZeroEmbedding(const Base& decoder) { return decoder.*(&DecoderAccess::_start_from_zero_embedding); }
+			static const auto& projectIn(const Base& decoder) { return decoder.*(&DecoderAccess::_project_in); }
+			static const auto& positionEncoder(const Base& decoder) { return decoder.*(&DecoderAccess::_position_encoder); }
+			static const auto& layerNormEmbedding(const Base& decoder) { return decoder.*(&DecoderAccess::_layernorm_embedding); }
+			static const auto& outputNorm(const Base& decoder) { return decoder.*(&DecoderAccess::_output_norm); }
+			static const auto& projectOut(const Base& decoder) { return decoder.*(&DecoderAccess::_project_out); }
+			static const auto& projection(const Base& decoder) { return decoder.*(&DecoderAccess::_proj); }
+			static const auto& outputsScale(const Base& decoder) { return decoder.*(&DecoderAccess::_outputs_scale); }
+			static ctranslate2::dim_t numHeads(const Base& decoder) { return decoder.*(&DecoderAccess::_num_heads); }
+			static bool withEncoderAttention(const Base& decoder) { return decoder.*(&DecoderAccess::_with_encoder_attention); }
+
+			static bool supported(const Base& decoder)
+			{
+				return !(decoder.*(&DecoderAccess::_alibi))
+					&& decoder.*(&DecoderAccess::_sliding_window) == 0
+					&& !(decoder.*(&DecoderAccess::_tensor_parallel));
+			}
+		};
+
+		ctranslate2::layers::TransformerDecoder* supportedDecoder(EncoderDecoderRunner& runner)
+		{
+			auto* decoder = dynamic_cast<ctranslate2::layers::TransformerDecoder*>(&runner.decoder());
+			return decoder != nullptr && DecoderAccess::supported(*decoder) ? decoder : nullptr;
+		}
+	}
+
+	std::unique_ptr<TruncatedDecoder> TruncatedDecoder::create(EncoderDecoderRunner& runner, size_t layers)
+	{
+		auto* decoder = supportedDecoder(runner);
+		if (decoder == nullptr)
+		{
+			return nullptr;
+		}
+
+		const size_t total = DecoderAccess::layers(*decoder).size();
+		if (total < 2)
+		{
+			return nullptr;
+		}
+		return std::unique_ptr<TruncatedDecoder>(new TruncatedDecoder(runner, *decoder, std::clamp<size_t>(layers, 1, total - 1)));
+	}
+
+	std::unique_ptr<TruncatedDecoder> TruncatedDecoder::createFull(EncoderDecoderRunner& runner)
+	{
+		auto* decoder = supportedDecoder(runner);
+		if (decoder == nullptr)
+		{
+			return nullptr;
+		}
+		return std::unique_ptr<TruncatedDecoder>(new TruncatedDecoder(runner, *decoder, DecoderAccess::layers(*decoder).size()));
+	}
+
+	TruncatedDecoder::TruncatedDecoder(EncoderDecoderRunner& runner, ctranslate2::layers::TransformerDecoder& decoder, size_t layers)
+		: m_runner(runner)
+		, m_decoder(decoder)
+		, m_layers(layers)
+		, m_multiQuery(DecoderAccess::layers(decoder).front()->get_self_attention().multi_query())
+	{
+	}
+
+	ctranslate2::layers::DecoderState TruncatedDecoder::initialState(const ctranslate2::layers::DecoderState& encoded) const
+	{
+		// Same cache names as TransformerDecoder::initial_state, for the first layers only.
+		const ctranslate2::DataType dtype = DecoderAccess::embeddings(m_decoder).output_type();
+		const ctranslate2::Device device = m_decoder.device();
+		const bool crossAttention = DecoderAccess::withEncoderAttention(m_decoder);
+
+		ctranslate2::layers::DecoderState state;
+		for (size_t layer = 0; layer < m_layers; ++layer)
+		{
+			const std::string index = std::to_string(layer);
+			state.emplace("self_keys_" + index, ctranslate2::StorageView(dtype, device));
+			state.emplace("self_values_" + index, ctranslate2::StorageView(dtype, device));
+			if (crossAttention)
+			{
+				state.emplace("memory_keys_" + index, ctranslate2::StorageView(dtype, device));
+				state.emplace("memory_values_" + index, ctranslate2::StorageView(dtype, device));
+			}
+		}
+		if (crossAttention)
+		{
+			state.emplace("memory", encoded.at("memory"));
+			state.emplace("memory_lengths", encoded.at("memory_lengths"));
+		}
+		return state;
+	}
+
+	ctranslate2::StorageView TruncatedDecoder::step(ctranslate2::layers::DecoderState& state, size_t step, size_t inputId)
+	{
+		ctranslate2::StorageView logits = forward(state, step, { inputId });
+		logits.reshape({ logits.dim(-1) });
+		return logits;
+	}
+
+	ctranslate2::StorageView TruncatedDecoder::forward(ctranslate2::layers::DecoderState& state, size_t step,
+	                                                   const std::vector<size_t>& inputIds)
+	{
+		// A zero start embedding only replaces position 0; feed that token on its own.
+		if (step == 0 && inputIds.size() > 1 && DecoderAccess::startFromZeroEmbedding(m_decoder))
+		{
+			const ctranslate2::StorageView first = forward(state, 0, { inputIds.front() });
+			const ctranslate2::StorageView rest = forward(state, 1, std::vector<size_t>(inputIds.begin() + 1, inputIds.end()));
+			ctranslate2::StorageView logits(first.dtype(), first.device());
+			ctranslate2::ops::Concat(0)({ &first, &rest }, logits);
+			return logits;
+		}
+
+		const auto deviceSetter = m_runner.model().get_scoped_device_setter();
+		const ctranslate2::Device device = m_decoder.device();
+		const auto count = static_cast<ctranslate2::dim_t>(inputIds.size());
+
+		// The output layer is shared with the full decoder; score the full vocabulary like
+		// forwardTarget does.
+		m_decoder.update_output_layer(m_runner.model().preferred_size_multiple());
+
+		const auto& embeddings = DecoderAccess::embeddings(m_decoder);
+		const ctranslate2::DataType dtype = embeddings.output_type();
+		const std::vector<int32_t> ids(inputIds.begin(), inputIds.end());
+		const ctranslate2::StorageView input({ 1, count }, ids, device);
+
+		// 1. Embeddings, in the order TransformerDecoder::decode applies them.
+		ctranslate2::StorageView layerIn(dtype, device);
+		ctranslate2::StorageView layerOut(dtype, device);
+		embeddings(input, layerIn);
+		const bool zeroEmbedding = DecoderAccess::startFromZeroEmbedding(m_decoder) && step == 0;
+		if (zeroEmbedding)
+		{
+			layerIn.zero();
+		}
+		if (const auto& scale = DecoderAccess::embeddingsScale(m_decoder); scale && !zeroEmbedding)
+		{
+			ctranslate2::ops::Mul()(layerIn, *scale, layerIn);
+		}
+		if (layerIn.rank() == 2)
+		{
+			layerIn.expand_dims(1);
+		}
+		if (const auto& projectIn = DecoderAccess::projectIn(m_decoder))
+		{
+			(*projectIn)(layerIn, layerOut);
+			layerIn = std::move(layerOut);
+		}
+		if (const auto& positionEncoder = DecoderAccess::positionEncoder(m_decoder))
+		{
+			(*positionEncoder)(layerIn, static_cast<ctranslate2::dim_t>(step));
+		}
+		if (const auto& layerNorm = DecoderAccess::layerNormEmbedding(m_decoder))
+		{
+			(*layerNorm)(layerIn, layerIn);
+		}
+
+		// 2. The first layers, with the caches of this state. A single token sees the
+		//    whole cache, as in the decoder's own step. Several tokens get a causal mask
+		//    offset by the cached length: token i sees positions 0 .. step + i.
+		const ctranslate2::dim_t numHeads = DecoderAccess::numHeads(m_decoder);
+		std::unique_ptr<ctranslate2::StorageView> selfMask;
+		if (count > 1)
+		{
+			std::vector<int32_t> visible(static_cast<size_t>(numHeads * count));
+			for (ctranslate2::dim_t head = 0; head < numHeads; ++head)
+			{
+				for (ctranslate2::dim_t query = 0; query < count; ++query)
+				{
+					// [batch, heads, queries], [batch, queries, heads] with multi-query attention.
+					const ctranslate2::dim_t index = m_multiQuery ? query * numHeads + head : head * count + query;
+					visible[static_cast<size_t>(index)] = static_cast<int32_t>(step) + static_cast<int32_t>(query) + 1;
+				}
+			}
+			const ctranslate2::Shape shape = m_multiQuery
+				? ctranslate2::Shape{ 1, count, numHeads }
+				: ctranslate2::Shape{ 1, numHeads, count };
+			selfMask = std::make_unique<ctranslate2::StorageView>(shape, visible, device);
+		}
+
+		const ctranslate2::StorageView* memory = nullptr;
+		std::unique_ptr<ctranslate2::StorageView> memoryMask;
+		if (DecoderAccess::withEncoderAttention(m_decoder))
+		{
+			memory = &state.at("memory");
+			memoryMask = std::make_unique<ctranslate2::StorageView>(ctranslate2::layers::AttentionLayer::prepare_length_mask(
+				state.at("memory_lengths"), numHeads, count, false, m_multiQuery));
+		}
+
+		const auto& layers = DecoderAccess::layers(m_decoder);
+		ctranslate2::StorageView positionBias(dtype, device);
+		for (size_t layer = 0; layer < m_layers; ++layer)
+		{
+			const std::string index = std::to_string(layer);
+			ctranslate2::StorageView* memoryKeys = memory ? &state.at("memory_keys_" + index) : nullptr;
+			ctranslate2::StorageView* memoryValues = memory ? &state.at("memory_values_" + index) : nullptr;
+			(*layers[layer])(layerIn, selfMask.get(), memory, memoryMask.get(),
+			                 &state.at("self_keys_" + index), &state.at("self_values_" + index),
+			                 memoryKeys, memoryValues,
+			                 layerOut, nullptr, nullptr, nullptr,
+			                 m_decoder.return_normalized_attention(), &positionBias);
+			layerIn = std::move(layerOut);
+		}
+
+		// 3. Final norm and the shared output projection, as after the last layer.
+		if (const auto& outputNorm = DecoderAccess::outputNorm(m_decoder))
+		{
+			(*outputNorm)(layerIn, layerIn);
+		}
+		if (const auto& projectOut = DecoderAccess::projectOut(m_decoder))
+		{
+			(*projectOut)(layerIn, layerOut);
+			layerIn = std::move(layerOut);
+		}
+		layerIn.reshape({ count, layerIn.dim(-1) });
+
+		ctranslate2::StorageView logits(m_decoder.output_type(), device);
+		DecoderAccess::projection(m_decoder)(layerIn, logits);
+		if (const auto& outputsScale = DecoderAccess::outputsScale(m_decoder))
+		{
+			ctranslate2::ops::Mul()(logits, *outputsScale, logits);
+		}
+		return toHostFloat32(logits);
+	}
+
+	void TruncatedDecoder::truncate(ctranslate2::layers::DecoderState& state, size_t length) const
+	{
+		const auto deviceSetter = m_runner.model().get_scoped_device_setter();
+
+		// Self-attention caches are [batch, heads, time, depth], [batch, time, depth] with
+		// multi-query attention.
+		const ctranslate2::dim_t timeAxis = m_multiQuery ? 1 : 2;
+		for (size_t layer = 0; layer < m_layers; ++layer)
+		{
+			const std::string index = std::to_string(layer);
+			for (const char* name : { "self_keys_", "self_values_" })
+			{
+				ctranslate2::StorageView& cache = state.at(name + index);
+				if (cache.empty() || cache.dim(timeAxis) <= static_cast<ctranslate2::dim_t>(length))
+				{
+					continue;
+				}
+				ctranslate2::StorageView kept(cache.dtype(), cache.device());
+				ctranslate2::ops::Slide(timeAxis, 0, static_cast<ctranslate2::dim_t>(length))(cache, kept);
+				cache = std::move(kept);
+			}
+		}
+	}
+
+	void SelfSpeculativeCounters::record(size_t rounds, size_t draftTokens, size_t acceptedTokens, size_t tokens)
+	{
+		m_requests.fetch_add(1, std::memory_order_relaxed);
+		m_rounds.fetch_add(rounds, std::memory_order_relaxed);
+		m_draftTokens.fetch_add(draftTokens, std::memory_order_relaxed);
+		m_acceptedTokens.fetch_add(acceptedTokens, std::memory_order_relaxed);
+		m_tokens.fetch_add(tokens, std::memory_order_relaxed);
+	}
+
+	SelfSpeculativeStatistics SelfSpeculativeCounters::statistics() const
+	{
+		SelfSpeculativeStatistics statistics;
+		statistics.requests = m_requests.load(std::memory_order_relaxed);
+		statistics.rounds = m_rounds.load(std::memory_order_relaxed);
+		statistics.draftTokens = m_draftTokens.load(std::memory_order_relaxed);
+		statistics.acceptedTokens = m_acceptedTokens.load(std::memory_order_relaxed);
+		statistics.tokens = m_tokens.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	std::vector<size_t> decodeSelfSpeculative(EncoderDecoderRunner& runner,
+	                                          TruncatedDecoder& draft,
+	                                          const ctranslate2::layers::DecoderState& encoded,
+	                                          const ctranslate2::DecodingOptions& options,
+	                                          size_t draftTokens,
+	                                          const CancellationFlag* cancellation,
+	                                          SelfSpeculativeCounters& counters)
+	{
+		const size_t vocabularySize = runner.model().get_target_vocabulary().size();
+		const size_t maxLength = options.max_length;
+		draftTokens = std::max<size_t>(draftTokens, 1);
+
+		// The draft's decoder supports the replica, so the full one does as well.
+		const std::unique_ptr<TruncatedDecoder> verifier = TruncatedDecoder::createFull(runner);
+		ctranslate2::layers::DecoderState verifierState = verifier->initialState(encoded);
+		ctranslate2::layers::DecoderState state = draft.initialState(encoded);
+		// Tokens whose positions are in each cache: the start token, then ids.
+		std::vector<size_t> inputs;
+		std::vector<size_t> verifierInputs;
+		// Tokens settled by the full decoder.
+		std::vector<size_t> ids;
+
+		// Drops the cached positions that no longer match [start] + settled.
+		const auto rollBack = [](TruncatedDecoder& decoder, ctranslate2::layers::DecoderState& cache,
+		                         std::vector<size_t>& cached, const std::vector<size_t>& settled)
+		{
+			size_t common = 0;
+			while (common + 1 < cached.size() && common < settled.size() && cached[common + 1] == settled[common])
+			{
+				++common;
+			}
+			if (cached.size() > common + 1)
+			{
+				decoder.truncate(cache, common + 1);
+				cached.resize(common + 1);
+			}
+		};
+
+		size_t rounds = 0;
+		size_t proposedTokens = 0;
+		size_t acceptedTokens = 0;
+		const auto record = [&]()
+		{
+			counters.record(rounds, proposedTokens, acceptedTokens, ids.size());
+		};
+
+		for (;;)
+		{
+			if (cancellation)
+			{
+				cancellation->throwIfCanceled();
+			}
+
+			// 1. Let the draft propose, feeding it whatever it has not cached yet. Its
+			//    cache always ends before the last token, whose logits are needed.
+			std::vector<size_t> sequence = ids;
+			if (inputs.size() > sequence.size())
+			{
+				draft.truncate(state, sequence.size());
+				inputs.resize(sequence.size());
+			}
+			while (sequence.size() - ids.size() < draftTokens && sequence.size() < maxLength)
+			{
+				ctranslate2::StorageView logits;
+				while (inputs.size() <= sequence.size())
+				{
+					const size_t inputId = inputs.empty() ? runner.startId() : sequence[inputs.size() - 1];
+					logits = draft.step(state, inputs.size(), inputId);
+					inputs.push_back(inputId);
+				}
+
+				const size_t id = selectGreedyToken(logits.data<float>(), std::min(vocabularySize, static_cast<size_t>(logits.dim(0))),
+				                                    sequence, sequence.size(), options, runner.endId());
+				sequence.push_back(id);
+				if (id == runner.endId())
+				{
+					break;
+				}
+			}
+			proposedTokens += sequence.size() - ids.size();
+
+			// 2. Verify the proposal with the full decoder. Its cache holds the settled
+			//    tokens but the last correction, so it is fed that correction and the
+			//    proposal, and scores the position after each of them.
+			const size_t firstPosition = verifierInputs.size();
+			std::vector<size_t> fed;
+			for (size_t position = firstPosition; position <= sequence.size(); ++position)
+			{
+				fed.push_back(position == 0 ? runner.startId() : sequence[position - 1]);
+			}
+			const ctranslate2::StorageView logits = verifier->forward(verifierState, firstPosition, fed);
+			verifierInputs.insert(verifierInputs.end(), fed.begin(), fed.end());
+
+			const DraftVerification verification = acceptDraft(runner, logits, firstPosition, sequence, options, ids.size());
+			++rounds;
+			acceptedTokens += verification.acceptedIds.size() - ids.size();
+
+			std::vector<size_t> settled = verification.acceptedIds;
+			if (verification.correctionId != runner.endId())
+			{
+				settled.push_back(verification.correctionId);
+			}
+
+			// 3. Report the new tokens, then drop the rejected ones from both caches.
+			bool stop = false;
+			if (options.callback)
+			{
+				for (size_t position = ids.size(); position < settled.size() && !stop; ++position)
+				{
+					ctranslate2::DecodingStepResult result;
+					result.step = position;
+					result.batch_id = 0;
+					result.token_id = settled[position];
+					result.hypothesis_id = 0;
+					result.is_last = verification.finished && position + 1 == settled.size();
+					stop = options.callback(std::move(result));
+				}
+			}
+
+			rollBack(draft, state, inputs, settled);
+			rollBack(*verifier, verifierState, verifierInputs, settled);
+
+			ids = std::move(settled);
+			if (verification.finished || stop)
+			{
+				record();
+				return ids;
+			}
+		}
+	}
+
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+#include <ctranslate2/layers/transformer.h>
+
+#include "Cancellation.h"
+#include "ReplicaRunner.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    struct SelfSpeculativeStatistics
+    {
+        size_t requests = 0;
+        size_t rounds = 0;          // Verification passes of the full decoder.
+        size_t draftTokens = 0;     // Tokens proposed by the truncated decoder.
+        size_t acceptedTokens = 0;  // Proposed tokens the full decoder agreed with.
+        size_t tokens = 0;          // Tokens produced, corrections included.
+    };
+
+    // The first layers of a replica's TransformerDecoder, used as the draft model of
+    // self-speculative decoding. It shares everything with the full decoder (embeddings,
+    // position encoding, the first layers, the final norm and the output projection),
+    // so it costs no memory beyond its own key/value caches.
+    //
+    // CTranslate2 runs its decoder layers as a whole; this replays TransformerDecoder::decode
+    // over the first layers only. Unlike the decoder's own step, it can also feed several
+    // tokens after the cached positions in one pass, which is how the verifier (all the
+    // layers, see createFull) checks a draft without going over the settled tokens again.
+    // Decoders using ALiBi, a sliding window or tensor parallelism are not supported.
+    //
+    // Like EncoderDecoderRunner, it must only be used on the replica's worker thread.
+    class TruncatedDecoder
+    {
+    public:
+        // Returns nullptr when the replica's decoder is not a supported TransformerDecoder
+        // or has fewer than two layers. layers is clamped to [1, decoder layers - 1].
+        static std::unique_ptr<TruncatedDecoder> create(EncoderDecoderRunner& runner, size_t layers);
+        // Same, over every layer: the full decoder with its own iterative state.
+        static std::unique_ptr<TruncatedDecoder> createFull(EncoderDecoderRunner& runner);
+
+        size_t layers() const { return m_layers; }
+
+        // Iterative state over the encoder memory of a single example.
+        ctranslate2::layers::DecoderState initialState(const ctranslate2::layers::DecoderState& encoded) const;
+
+        // Feeds the token at position step and returns the float32 host logits of the
+        // next one, over the full target vocabulary.
+        ctranslate2::StorageView step(ctranslate2::layers::DecoderState& state, size_t step, size_t inputId);
+
+        // Feeds the tokens at positions step, step + 1, ... in one pass, each attending to
+        // the cached positions and the tokens before it. Returns float32 host logits of
+        // shape [inputIds.size(), vocabulary]; row i predicts the token after inputIds[i].
+        ctranslate2::StorageView forward(ctranslate2::layers::DecoderState& state, size_t step,
+                                         const std::vector<size_t>& inputIds);
+
+        // Drops the cached positions from length on, e.g. rejected draft tokens.
+        void truncate(ctranslate2::layers::DecoderState& state, size_t length) const;
+
+    private:
+        TruncatedDecoder(EncoderDecoderRunner& runner, ctranslate2::layers::TransformerDecoder& decoder, size_t layers);
+
+        EncoderDecoderRunner& m_runner;
+        ctranslate2::layers::TransformerDecoder& m_decoder;
+        const size_t m_layers;
+        const bool m_multiQuery;
+    };
+
+    // Counters of self-speculative decoding, shared by the replicas of a translator.
+    class SelfSpeculativeCounters
+    {
+    public:
+        void record(size_t rounds, size_t draftTokens, size_t acceptedTokens, size_t tokens);
+        SelfSpeculativeStatistics statistics() const;
+
+    private:
+        std::atomic<size_t> m_requests{ 0 };
+        std::atomic<size_t> m_rounds{ 0 };
+        std::atomic<size_t> m_draftTokens{ 0 };
+        std::atomic<size_t> m_acceptedTokens{ 0 };
+        std::atomic<size_t> m_tokens{ 0 };
+    };
+
+    // Greedy decoding of one encoded example with the truncated decoder as draft model.
+    // Each round the draft proposes up to draftTokens tokens one step at a time, and the
+    // full decoder checks them in one pass (acceptDraft). The full decoder keeps its own
+    // iterative state, so a round only feeds it the previous correction and the new
+    // proposal, and the work stays linear in the output length. The agreed prefix is kept
+    // along with the full decoder's own choice at the first disagreement, and both caches
+    // are rolled back to match.
+    //
+    // Every token of the result is the full decoder's greedy choice given the tokens
+    // before it. Those logits come from passes over several positions instead of
+    // decode()'s one-token steps, and may differ from them in the last bits, so a
+    // near-tie can resolve differently from plain greedy search.
+    //
+    // Returns the target ids without start or end token. options.callback, if any, sees
+    // the tokens as rounds settle them; the cancellation is checked between rounds.
+    std::vector<size_t> decodeSelfSpeculative(EncoderDecoderRunner& runner,
+                                              TruncatedDecoder& draft,
+                                              const ctranslate2::layers::DecoderState& encoded,
+                                              const ctranslate2::DecodingOptions& options,
+                                              size_t draftTokens,
+                                              const CancellationFlag* cancellation,
+                                              SelfSpeculativeCounters& counters);
+
+}
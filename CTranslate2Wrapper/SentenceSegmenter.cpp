@@ -0,0 +1,225 @@
+#include "SentenceSegmenter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		bool startsWith(std::string_view text, size_t i, std::string_view prefix)
+		{
+			return text.compare(i, prefix.size(), prefix) == 0;
+		}
+
+		// Length of the whitespace character at text[i], or 0. Besides ASCII: no-break
+		// space and the ideographic space of CJK text.
+		size_t spaceLength(std::string_view text, size_t i)
+		{
+			const char c = text[i];
+			if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v')
+				return 1;
+			if (startsWith(text, i, "\xC2\xA0"))
+				return 2;
+			if (startsWith(text, i, "\xE3\x80\x80"))
+				return 3;
+			return 0;
+		}
+
+		size_t skipSpace(std::string_view text, size_t i)
+		{
+			while (i < text.size())
+			{
+				const size_t length = spaceLength(text, i);
+				if (length == 0)
+					break;
+				i += length;
+			}
+			return i;
+		}
+
+		// Start of the whitespace that ends text[begin, end).
+		size_t trimSpaceBack(std::string_view text, size_t begin, size_t end)
+		{
+			while (end > begin)
+			{
+				if (spaceLength(text, end - 1) == 1)
+					--end;
+				else if (end - begin >= 2 && startsWith(text, end - 2, "\xC2\xA0"))
+					end -= 2;
+				else if (end - begin >= 3 && startsWith(text, end - 3, "\xE3\x80\x80"))
+					end -= 3;
+				else
+					break;
+			}
+			return end;
+		}
+
+		// 。！？．: end a sentence wherever they are.
+		size_t fullWidthTerminatorLength(std::string_view text, size_t i)
+		{
+			static const std::string_view terminators[] = { "\xE3\x80\x82", "\xEF\xBC\x81", "\xEF\xBC\x9F", "\xEF\xBC\x8E" };
+			for (const std::string_view terminator : terminators)
+			{
+				if (startsWith(text, i, terminator))
+					return terminator.size();
+			}
+			return 0;
+		}
+
+		// . ! ? …: end a sentence only before whitespace.
+		size_t terminatorLength(std::string_view text, size_t i)
+		{
+			const char c = text[i];
+			if (c == '.' || c == '!' || c == '?')
+				return 1;
+			if (startsWith(text, i, "\xE2\x80\xA6"))
+				return 3;
+			return 0;
+		}
+
+		// Quotes and brackets that close a sentence: " ' ) ] and ” ’ 」 』 》 】 ）.
+		size_t closerLength(std::string_view text, size_t i)
+		{
+			const char c = text[i];
+			if (c == '"' || c == '\'' || c == ')' || c == ']')
+				return 1;
+			static const std::string_view closers[] = {
+				"\xE2\x80\x9D", "\xE2\x80\x99", "\xE3\x80\x8D", "\xE3\x80\x8F", "\xE3\x80\x8B", "\xE3\x80\x91", "\xEF\xBC\x89",
+			};
+			for (const std::string_view closer : closers)
+			{
+				if (startsWith(text, i, closer))
+					return closer.size();
+			}
+			return 0;
+		}
+
+		// End of the run of terminators and closers starting at i.
+		size_t skipTerminators(std::string_view text, size_t i)
+		{
+			while (i < text.size())
+			{
+				size_t length = fullWidthTerminatorLength(text, i);
+				if (length == 0)
+					length = terminatorLength(text, i);
+				if (length == 0)
+					length = closerLength(text, i);
+				if (length == 0)
+					break;
+				i += length;
+			}
+			return i;
+		}
+
+		bool isAsciiLetter(char c)
+		{
+			return std::isalpha(static_cast<unsigned char>(c)) != 0;
+		}
+
+		// Whether the period at text[i] ends an abbreviation rather than a sentence.
+		bool endsAbbreviation(std::string_view text, size_t i)
+		{
+			// Titles and other short forms that are almost always followed by more of
+			// the sentence. "etc." and "no." often end one and are left to the
+			// lowercase rule.
+			static const std::string_view abbreviations[] = {
+				"mr", "mrs", "ms", "dr", "prof", "sr", "jr", "st", "mt", "vs", "fig", "approx", "dept",
+				"inc", "ltd", "co", "corp", "jan", "feb", "mar", "apr", "jun", "jul", "aug", "sep",
+				"sept", "oct", "nov", "dec",
+			};
+
+			size_t begin = i;
+			while (begin > 0 && (isAsciiLetter(text[begin - 1]) || text[begin - 1] == '.'))
+			{
+				--begin;
+			}
+			if (begin == i || (begin > 0 && static_cast<unsigned char>(text[begin - 1]) >= 0x80))
+			{
+				return false;
+			}
+
+			std::string word(text.substr(begin, i - begin));
+			std::transform(word.begin(), word.end(), word.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+			// An initial ("J. Smith") or a dotted form ("e.g.", "U.S.").
+			if (word.size() == 1 || word.find('.') != std::string::npos)
+			{
+				return true;
+			}
+			return std::find(std::begin(abbreviations), std::end(abbreviations), word) != std::end(abbreviations);
+		}
+
+		// Whether the text after the whitespace at i continues a sentence.
+		bool continuesLowercase(std::string_view text, size_t i)
+		{
+			const size_t next = skipSpace(text, i);
+			return next < text.size() && std::islower(static_cast<unsigned char>(text[next])) != 0;
+		}
+	}
+
+	std::vector<SentenceSegment> segmentSentences(std::string_view text)
+	{
+		std::vector<SentenceSegment> segments;
+		size_t begin = skipSpace(text, 0);
+		if (begin > 0)
+		{
+			segments.push_back({ text.substr(0, 0), text.substr(0, begin) });
+		}
+
+		size_t i = begin;
+		while (i < text.size())
+		{
+			size_t end = 0;
+			if (text[i] == '\n')
+			{
+				end = i;
+			}
+			else if (const size_t length = fullWidthTerminatorLength(text, i))
+			{
+				end = skipTerminators(text, i + length);
+			}
+			else if (const size_t length = terminatorLength(text, i))
+			{
+				const size_t runEnd = skipTerminators(text, i + length);
+				const bool beforeSpace = runEnd == text.size() || spaceLength(text, runEnd) > 0;
+				const bool abbreviation = runEnd == i + 1 && text[i] == '.' && endsAbbreviation(text, i);
+				if (!beforeSpace || abbreviation || continuesLowercase(text, runEnd))
+				{
+					i = runEnd;
+					continue;
+				}
+				end = runEnd;
+			}
+			else
+			{
+				++i;
+				continue;
+			}
+
+			// A line break may follow spaces, which belong to the separator too.
+			const size_t textEnd = trimSpaceBack(text, begin, end);
+			const size_t next = skipSpace(text, end);
+			if (textEnd > begin)
+			{
+				segments.push_back({ text.substr(begin, textEnd - begin), text.substr(textEnd, next - textEnd) });
+			}
+			else if (!segments.empty())
+			{
+				// Blank line: widen the previous separator.
+				const SentenceSegment& previous = segments.back();
+				const size_t separatorBegin = static_cast<size_t>(previous.trailing.data() - text.data());
+				segments.back().trailing = text.substr(separatorBegin, next - separatorBegin);
+			}
+			begin = i = std::max(next, i + 1);
+		}
+
+		if (begin < text.size())
+		{
+			const size_t textEnd = trimSpaceBack(text, begin, text.size());
+			segments.push_back({ text.substr(begin, textEnd - begin), text.substr(textEnd) });
+		}
+		return segments;
+	}
+
+}
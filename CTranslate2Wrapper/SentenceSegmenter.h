@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+namespace CTranslate2Wrapper::Native {
+
+    struct SentenceSegment
+    {
+        // The sentence, terminator and closing quotes or brackets included. Empty for
+        // whitespace before the first sentence.
+        std::string_view text;
+        // Whitespace after it, line breaks included.
+        std::string_view trailing;
+    };
+
+    // Splits UTF-8 text into sentences. Concatenating text and trailing of every segment
+    // gives back the input, so translations can be put back between the original
+    // whitespace.
+    //
+    // A sentence ends at:
+    // - a line break;
+    // - 。！？ and full-width ．, even without a following space;
+    // - . ! ? and … followed by whitespace or the end of the text, unless the next word
+    //   starts with a lowercase letter or the period ends an abbreviation ("Mr.", "e.g.",
+    //   an initial). A terminator followed by a letter or digit ("3.5", "example.com")
+    //   never ends one.
+    // Runs of terminators ("?!", "...", "！？") and the closing quotes and brackets after
+    // them stay with the sentence.
+    //
+    // The views point into text.
+    std::vector<SentenceSegment> segmentSentences(std::string_view text);
+
+}
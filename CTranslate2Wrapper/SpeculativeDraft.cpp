@@ -0,0 +1,131 @@
+#include "SpeculativeDraft.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CTranslate2Wrapper::Native {
+
+	std::optional<std::vector<size_t>> DraftStore::find(const std::string& text) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_source.empty() || m_targetIds.empty() || text.empty())
+		{
+			return std::nullopt;
+		}
+
+		const size_t shorter = std::min(m_source.size(), text.size());
+		const size_t common = static_cast<size_t>(std::mismatch(text.begin(), text.begin() + shorter, m_source.begin()).first - text.begin());
+		if (common * 2 < shorter)
+		{
+			return std::nullopt;
+		}
+		return m_targetIds;
+	}
+
+	void DraftStore::remember(const std::string& text, const std::vector<size_t>& targetIds)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_source = text;
+		m_targetIds = targetIds;
+	}
+
+	void DraftStore::recordRequest(size_t draftTokens, size_t acceptedTokens, size_t decodedTokens)
+	{
+		m_requests.fetch_add(1, std::memory_order_relaxed);
+		if (draftTokens > 0)
+		{
+			m_draftedRequests.fetch_add(1, std::memory_order_relaxed);
+		}
+		m_draftTokens.fetch_add(draftTokens, std::memory_order_relaxed);
+		m_acceptedTokens.fetch_add(acceptedTokens, std::memory_order_relaxed);
+		m_decodedTokens.fetch_add(decodedTokens, std::memory_order_relaxed);
+	}
+
+	SpeculativeDraftStatistics DraftStore::statistics() const
+	{
+		SpeculativeDraftStatistics statistics;
+		statistics.requests = m_requests.load(std::memory_order_relaxed);
+		statistics.draftedRequests = m_draftedRequests.load(std::memory_order_relaxed);
+		statistics.draftTokens = m_draftTokens.load(std::memory_order_relaxed);
+		statistics.acceptedTokens = m_acceptedTokens.load(std::memory_order_relaxed);
+		statistics.decodedTokens = m_decodedTokens.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	DraftVerification verifyDraft(EncoderDecoderRunner& runner,
+	                              const ctranslate2::layers::DecoderState& encoded,
+	                              const std::vector<size_t>& draftIds,
+	                              const ctranslate2::DecodingOptions& options,
+	                              size_t verifiedIds)
+	{
+		// Never verify more than the decoder could have produced.
+		const size_t maxLength = options.max_length > 0 ? options.max_length : draftIds.size();
+		const std::vector<size_t> draft(draftIds.begin(), draftIds.begin() + std::min(draftIds.size(), maxLength));
+
+		const ctranslate2::StorageView logits = runner.forwardTarget(encoded, draft);
+		return acceptDraft(runner, logits, 0, draft, options, verifiedIds);
+	}
+
+	DraftVerification acceptDraft(const EncoderDecoderRunner& runner,
+	                              const ctranslate2::StorageView& logits,
+	                              size_t firstPosition,
+	                              const std::vector<size_t>& draftIds,
+	                              const ctranslate2::DecodingOptions& options,
+	                              size_t verifiedIds)
+	{
+		const size_t maxLength = options.max_length > 0 ? options.max_length : draftIds.size();
+		const size_t draftLength = std::min({ draftIds.size(), maxLength,
+			firstPosition + static_cast<size_t>(logits.dim(0)) - 1 });
+		const std::vector<size_t> draft(draftIds.begin(), draftIds.begin() + draftLength);
+
+		const size_t vocabularySize = static_cast<size_t>(logits.dim(1));
+		const float* rows = logits.data<float>();
+
+		// decode() only sees the restricted output layer; select among the same ids here.
+		std::vector<float> restrictedRow;
+		const std::vector<size_t>& outputIds = runner.outputIds();
+		const auto row = [&](size_t position) -> const float*
+		{
+			const float* full = rows + (position - firstPosition) * vocabularySize;
+			if (outputIds.empty())
+			{
+				return full;
+			}
+			restrictedRow.assign(vocabularySize, std::numeric_limits<float>::lowest());
+			for (const size_t id : outputIds)
+			{
+				if (id < vocabularySize)
+					restrictedRow[id] = full[id];
+			}
+			return restrictedRow.data();
+		};
+
+		DraftVerification verification;
+		verification.acceptedIds.reserve(draft.size());
+
+		size_t position = std::min(std::max(verifiedIds, firstPosition), draft.size());
+		verification.acceptedIds.assign(draft.begin(), draft.begin() + position);
+		for (; position <= draft.size(); ++position)
+		{
+			if (options.max_length > 0 && verification.acceptedIds.size() >= options.max_length)
+			{
+				// The accepted draft already fills max_length: no room for a correction.
+				verification.correctionId = runner.endId();
+				break;
+			}
+			const size_t selected = selectGreedyToken(row(position), vocabularySize,
+			                                          verification.acceptedIds, position, options, runner.endId());
+			if (position == draft.size() || selected != draft[position] || selected == runner.endId())
+			{
+				verification.correctionId = selected;
+				break;
+			}
+			verification.acceptedIds.push_back(selected);
+		}
+
+		verification.finished = verification.correctionId == runner.endId()
+			|| verification.acceptedIds.size() + 1 >= maxLength;
+		return verification;
+	}
+
+}
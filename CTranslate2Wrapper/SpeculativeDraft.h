@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+#include <ctranslate2/layers/decoder.h>
+
+#include "ReplicaRunner.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    struct SpeculativeDraftStatistics
+    {
+        size_t requests = 0;        // Translations that went through the replica.
+        size_t draftedRequests = 0; // Of those, the ones that had a draft to verify.
+        size_t draftTokens = 0;     // Tokens proposed by the drafts.
+        size_t acceptedTokens = 0;  // Draft tokens the verification pass kept.
+        size_t decodedTokens = 0;   // Tokens produced by autoregressive decoding steps.
+    };
+
+    // Remembers the last translated source and its hypothesis, so the next keystroke can
+    // use that hypothesis as a draft. While the user types, consecutive inputs share a
+    // prefix and so, most of the time, do their translations.
+    class DraftStore
+    {
+    public:
+        // Returns the previous hypothesis if the previous source looks like an earlier
+        // state of text: both share at least half of the shorter of the two.
+        std::optional<std::vector<size_t>> find(const std::string& text) const;
+
+        // Records the target ids produced for text, without start or end token.
+        void remember(const std::string& text, const std::vector<size_t>& targetIds);
+
+        void recordRequest(size_t draftTokens, size_t acceptedTokens, size_t decodedTokens);
+        SpeculativeDraftStatistics statistics() const;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::string m_source;
+        std::vector<size_t> m_targetIds;
+
+        std::atomic<size_t> m_requests{ 0 };
+        std::atomic<size_t> m_draftedRequests{ 0 };
+        std::atomic<size_t> m_draftTokens{ 0 };
+        std::atomic<size_t> m_acceptedTokens{ 0 };
+        std::atomic<size_t> m_decodedTokens{ 0 };
+    };
+
+    struct DraftVerification
+    {
+        // Longest draft prefix the decoder would have produced itself.
+        std::vector<size_t> acceptedIds;
+        // Token the decoder selects right after acceptedIds, or the end token when
+        // acceptedIds already has the maximum length.
+        size_t correctionId = 0;
+        // True when correctionId ends the hypothesis, or the maximum length is reached,
+        // so there is nothing left to decode.
+        bool finished = false;
+    };
+
+    // Checks a draft against the model in a single decoder pass over [start] + draft.
+    // Every position is scored in parallel, and position i is accepted while the greedy
+    // choice for it equals draft[i]. The pass is also the first decoding step after the
+    // accepted prefix, which yields the correction token for free. The first verifiedIds
+    // of the draft were accepted by an earlier pass and are kept without comparison.
+    DraftVerification verifyDraft(EncoderDecoderRunner& runner,
+                                  const ctranslate2::layers::DecoderState& encoded,
+                                  const std::vector<size_t>& draftIds,
+                                  const ctranslate2::DecodingOptions& options,
+                                  size_t verifiedIds = 0);
+
+    // The comparison of verifyDraft, on float32 host logits the caller computed, e.g.
+    // with an iterative decoder state that already holds the settled positions. Row r of
+    // logits is the prediction for draft position firstPosition + r, up to the position
+    // after the draft; firstPosition must not exceed verifiedIds.
+    DraftVerification acceptDraft(const EncoderDecoderRunner& runner,
+                                  const ctranslate2::StorageView& logits,
+                                  size_t firstPosition,
+                                  const std::vector<size_t>& draftIds,
+                                  const ctranslate2::DecodingOptions& options,
+                                  size_t verifiedIds);
+
+}
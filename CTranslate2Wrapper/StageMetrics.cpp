@@ -0,0 +1,170 @@
+#include "StageMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		unsigned floorLog2(uint64_t value)
+		{
+			unsigned result = 0;
+			while (value >>= 1)
+			{
+				++result;
+			}
+			return result;
+		}
+	}
+
+	size_t LatencyHistogram::bucketIndex(uint64_t value)
+	{
+		if (value < subBucketCount)
+		{
+			return static_cast<size_t>(value);
+		}
+		// The top subBucketBits + 1 bits select the bucket: the leading 1 gives the
+		// octave, the bits after it the position within the octave.
+		const unsigned exponent = floorLog2(value);
+		const unsigned shift = exponent - subBucketBits;
+		const size_t mantissa = static_cast<size_t>(value >> shift) & (subBucketCount - 1);
+		return (shift + 1) * subBucketCount + mantissa;
+	}
+
+	uint64_t LatencyHistogram::bucketUpperBound(size_t index)
+	{
+		if (index < subBucketCount)
+		{
+			return index;
+		}
+		const unsigned shift = static_cast<unsigned>(index / subBucketCount) - 1;
+		const uint64_t mantissa = index % subBucketCount;
+		const uint64_t lower = (subBucketCount + mantissa) << shift;
+		return lower + ((uint64_t(1) << shift) - 1);
+	}
+
+	void LatencyHistogram::record(uint64_t value)
+	{
+		m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		m_count.fetch_add(1, std::memory_order_relaxed);
+		m_sum.fetch_add(value, std::memory_order_relaxed);
+
+		uint64_t max = m_max.load(std::memory_order_relaxed);
+		while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+	{
+		// Not atomic as a whole: a value recorded concurrently may show up in the bucket
+		// but not yet in count. Percentiles use the bucket total, so they stay consistent.
+		Snapshot snapshot;
+		for (size_t i = 0; i < bucketCount; ++i)
+		{
+			snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+		}
+		snapshot.count = m_count.load(std::memory_order_relaxed);
+		snapshot.sum = m_sum.load(std::memory_order_relaxed);
+		snapshot.max = m_max.load(std::memory_order_relaxed);
+		return snapshot;
+	}
+
+	void LatencyHistogram::reset()
+	{
+		for (auto& bucket : m_buckets)
+		{
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		m_count.store(0, std::memory_order_relaxed);
+		m_sum.store(0, std::memory_order_relaxed);
+		m_max.store(0, std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::Snapshot::percentile(double fraction) const
+	{
+		uint64_t total = 0;
+		for (const uint64_t bucket : buckets)
+		{
+			total += bucket;
+		}
+		if (total == 0)
+		{
+			return 0;
+		}
+
+		const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total)));
+		uint64_t seen = 0;
+		for (size_t i = 0; i < bucketCount; ++i)
+		{
+			seen += buckets[i];
+			if (seen >= rank)
+			{
+				return std::min(bucketUpperBound(i), max);
+			}
+		}
+		return max;
+	}
+
+	const char* stageName(Stage stage)
+	{
+		switch (stage)
+		{
+		case Stage::Marshal: return "marshal";
+		case Stage::CacheHit: return "cache_hit";
+		case Stage::MemoryHit: return "memory_hit";
+		case Stage::Encode: return "encode";
+		case Stage::Queue: return "queue";
+		case Stage::Encoder: return "encoder";
+		case Stage::Decoder: return "decoder";
+		case Stage::Escalation: return "escalation";
+		case Stage::Detokenize: return "detokenize";
+		case Stage::Unmarshal: return "unmarshal";
+		case Stage::Translate: return "translate";
+		case Stage::Batch: return "batch";
+		case Stage::Pivot: return "pivot";
+		default: return "unknown";
+		}
+	}
+
+	void StageMetrics::reset()
+	{
+		for (auto& stage : m_stages)
+		{
+			stage.reset();
+		}
+		m_decodeSteps.reset();
+	}
+
+	std::string StageMetrics::dump() const
+	{
+		std::string text;
+		char line[160];
+		std::snprintf(line, sizeof(line), "%-12s %10s %10s %10s %10s %10s %10s\n", "stage (us)", "count", "mean", "p50", "p90", "p99", "max");
+		text += line;
+
+		const auto append = [&](const char* name, const LatencyHistogram::Snapshot& snapshot)
+		{
+			if (snapshot.count == 0)
+			{
+				return;
+			}
+			std::snprintf(line, sizeof(line), "%-12s %10llu %10.1f %10llu %10llu %10llu %10llu\n", name,
+				static_cast<unsigned long long>(snapshot.count), snapshot.mean(),
+				static_cast<unsigned long long>(snapshot.percentile(0.50)),
+				static_cast<unsigned long long>(snapshot.percentile(0.90)),
+				static_cast<unsigned long long>(snapshot.percentile(0.99)),
+				static_cast<unsigned long long>(snapshot.max));
+			text += line;
+		};
+
+		for (size_t stage = 0; stage < stageCount; ++stage)
+		{
+			append(stageName(static_cast<Stage>(stage)), m_stages[stage].snapshot());
+		}
+		append("decode_steps", m_decodeSteps.snapshot());
+		return text;
+	}
+
+}
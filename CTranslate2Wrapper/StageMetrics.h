@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ctranslate2/decoding_utils.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    // Log-linear latency histogram in the style of HdrHistogram: values below 16 get
+    // their own bucket, every power of two above is split into 16 buckets, so any
+    // recorded value is reported with less than 6.25% error over the full 64-bit range.
+    //
+    // Recording is three relaxed atomic adds and a CAS loop for the maximum: no lock, so
+    // it can stay enabled in release builds and be hit from every replica thread.
+    class LatencyHistogram
+    {
+    public:
+        static constexpr unsigned subBucketBits = 4;
+        static constexpr size_t subBucketCount = size_t(1) << subBucketBits;
+        static constexpr size_t bucketCount = (64 - subBucketBits + 1) * subBucketCount;
+
+        struct Snapshot
+        {
+            uint64_t count = 0;
+            uint64_t sum = 0;
+            uint64_t max = 0;
+            std::array<uint64_t, bucketCount> buckets{};
+
+            // Smallest bucket bound below which at least fraction of the values fall.
+            uint64_t percentile(double fraction) const;
+            double mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+        };
+
+        void record(uint64_t value);
+        Snapshot snapshot() const;
+        void reset();
+
+        static size_t bucketIndex(uint64_t value);
+        // Largest value that falls into the bucket.
+        static uint64_t bucketUpperBound(size_t index);
+
+    private:
+        std::array<std::atomic<uint64_t>, bucketCount> m_buckets{};
+        std::atomic<uint64_t> m_count{ 0 };
+        std::atomic<uint64_t> m_sum{ 0 };
+        std::atomic<uint64_t> m_max{ 0 };
+    };
+
+    // Stages of one translation, in the order a request goes through them.
+    enum class Stage
+    {
+        Marshal,     // UTF-16 -> UTF-8 in the C++/CLI layer (toUtf8)
+        CacheHit,    // Whole request answered from the translation cache
+        MemoryHit,   // Whole request answered from the translation memory
+        Encode,      // SentencePiece encoding
+        Queue,       // Waiting in ReplicaPool for a free replica
+        Encoder,     // Encoder forward pass
+        Decoder,     // Decoding loop, draft verification included
+        Escalation,  // Beam search re-run of a greedy hypothesis that was not confident
+        Detokenize,  // SentencePiece decoding
+        Unmarshal,   // UTF-8 -> UTF-16 in the C++/CLI layer (fromUtf8)
+        Translate,   // Whole native translate call that ran the model
+        Batch,       // Whole native translateBatch call
+        Pivot,       // Whole native translatePivot call
+        Count
+    };
+
+    const char* stageName(Stage stage);
+
+    // Always-on per-stage timers of one translator. Durations are recorded in
+    // microseconds; decode steps per request get a histogram of their own.
+    class StageMetrics
+    {
+    public:
+        static constexpr size_t stageCount = static_cast<size_t>(Stage::Count);
+
+        void record(Stage stage, std::chrono::steady_clock::duration duration)
+        {
+            m_stages[static_cast<size_t>(stage)].record(
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+        }
+
+        void recordDecodeSteps(size_t steps) { m_decodeSteps.record(steps); }
+
+        LatencyHistogram::Snapshot snapshot(Stage stage) const { return m_stages[static_cast<size_t>(stage)].snapshot(); }
+        LatencyHistogram::Snapshot decodeSteps() const { return m_decodeSteps.snapshot(); }
+
+        void reset();
+
+        // One line per stage that saw traffic: count, mean, p50, p90, p99 and max.
+        std::string dump() const;
+
+    private:
+        std::array<LatencyHistogram, stageCount> m_stages;
+        LatencyHistogram m_decodeSteps;
+    };
+
+    // Records the lifetime of the scope into a stage, like ctranslate2::ScopeProfiler
+    // but without CT2_ENABLE_PROFILING and without the global registry.
+    class ScopedStageTimer
+    {
+    public:
+        ScopedStageTimer(StageMetrics& metrics, Stage stage)
+            : m_metrics(metrics)
+            , m_stage(stage)
+            , m_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ScopedStageTimer()
+        {
+            m_metrics.record(m_stage, std::chrono::steady_clock::now() - m_start);
+        }
+
+        ScopedStageTimer(const ScopedStageTimer&) = delete;
+        ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+    private:
+        StageMetrics& m_metrics;
+        const Stage m_stage;
+        const std::chrono::steady_clock::time_point m_start;
+    };
+
+    // Counts the steps of one decoding loop. Logits processors run once per step in
+    // both greedy and beam search, so this works whatever the beam size; a draft
+    // verification pass does not go through them and is not counted.
+    class DecodeStepCounter : public ctranslate2::LogitsProcessor
+    {
+    public:
+        void apply(ctranslate2::dim_t,
+                   ctranslate2::StorageView&,
+                   ctranslate2::DisableTokens&,
+                   const ctranslate2::StorageView&,
+                   const std::vector<ctranslate2::dim_t>&,
+                   const std::vector<std::vector<size_t>>*) override
+        {
+            ++m_steps;
+        }
+
+        // Only read once the job that owns the decoding options has finished.
+        size_t steps() const { return m_steps; }
+
+    private:
+        size_t m_steps = 0;
+    };
+
+}
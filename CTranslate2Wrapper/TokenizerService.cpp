@@ -0,0 +1,122 @@
+#include "TokenizerService.h"
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		void loadProcessor(sentencepiece::SentencePieceProcessor& processor, const std::string& path)
+		{
+			const auto status = processor.Load(path);
+			if (!status.ok())
+			{
+				throw std::runtime_error("Failed to load SentencePiece model '" + path + "': " + status.ToString());
+			}
+		}
+	}
+
+	std::shared_ptr<const TokenizerService> TokenizerService::forModel(const std::string& modelDir)
+	{
+		// Weak references only: the registry never keeps a model alive on its own,
+		// it just lets concurrently alive translators share the same processors.
+		static std::mutex registryMutex;
+		static std::map<std::string, std::weak_ptr<const TokenizerService>> registry;
+
+		std::lock_guard<std::mutex> lock(registryMutex);
+		auto& entry = registry[modelDir];
+		if (auto existing = entry.lock())
+		{
+			return existing;
+		}
+
+		auto service = std::make_shared<const TokenizerService>(modelDir);
+		entry = service;
+		return service;
+	}
+
+	TokenizerService::TokenizerService(const std::string& modelDir)
+	{
+		loadProcessor(m_source, modelDir + "/source.spm");
+		loadProcessor(m_target, modelDir + "/target.spm");
+	}
+
+	std::vector<std::string> TokenizerService::encode(const std::string& text) const
+	{
+		std::vector<std::string> pieces;
+		const auto status = m_source.Encode(text, &pieces);
+		if (!status.ok())
+		{
+			throw std::runtime_error("Failed to encode SentencePiece tokens: " + status.ToString());
+		}
+		return pieces;
+	}
+
+	std::vector<std::string> TokenizerService::encodeTarget(const std::string& text) const
+	{
+		std::vector<std::string> pieces;
+		const auto status = m_target.Encode(text, &pieces);
+		if (!status.ok())
+		{
+			throw std::runtime_error("Failed to encode SentencePiece tokens: " + status.ToString());
+		}
+		return pieces;
+	}
+
+	std::vector<std::vector<std::string>> TokenizerService::encodeBatch(const std::vector<std::string>& texts) const
+	{
+		std::vector<std::vector<std::string>> batch;
+		batch.reserve(texts.size());
+		for (const auto& text : texts)
+		{
+			batch.emplace_back(encode(text));
+		}
+		return batch;
+	}
+
+	std::string TokenizerService::decode(const std::vector<std::string>& pieces) const
+	{
+		std::string text;
+		const auto status = m_target.Decode(pieces, &text);
+		if (!status.ok())
+		{
+			throw std::runtime_error("Failed to decode SentencePiece tokens: " + status.ToString());
+		}
+		return text;
+	}
+
+	std::vector<int> TokenizerService::encodeIds(const std::string& text) const
+	{
+		std::vector<int> ids;
+		const auto status = m_source.Encode(text, &ids);
+		if (!status.ok())
+		{
+			throw std::runtime_error("Failed to encode SentencePiece ids: " + status.ToString());
+		}
+		return ids;
+	}
+
+	std::string TokenizerService::decodeIds(const std::vector<int>& ids) const
+	{
+		std::string text;
+		const auto status = m_target.Decode(ids, &text);
+		if (!status.ok())
+		{
+			throw std::runtime_error("Failed to decode SentencePiece ids: " + status.ToString());
+		}
+		return text;
+	}
+
+	std::vector<std::string> TokenizerService::decodeBatch(const std::vector<std::vector<std::string>>& batchPieces) const
+	{
+		std::vector<std::string> texts;
+		texts.reserve(batchPieces.size());
+		for (const auto& pieces : batchPieces)
+		{
+			texts.emplace_back(decode(pieces));
+		}
+		return texts;
+	}
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sentencepiece_processor.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    // Source and target SentencePiece models of one model directory.
+    // Both processors are loaded once and only used through their const
+    // Encode/Decode methods afterwards, so a single instance can be shared
+    // by every translator and every thread working on the same model.
+    class TokenizerService
+    {
+    public:
+        // Returns the service for the given model directory, loading
+        // source.spm and target.spm on first use. Later calls for the same
+        // directory return the already loaded instance while it is alive.
+        static std::shared_ptr<const TokenizerService> forModel(const std::string& modelDir);
+
+        explicit TokenizerService(const std::string& modelDir);
+
+        std::vector<std::string> encode(const std::string& text) const;
+        std::vector<std::vector<std::string>> encodeBatch(const std::vector<std::string>& texts) const;
+
+        std::string decode(const std::vector<std::string>& pieces) const;
+        // Target text to target pieces, e.g. to hand a known translation to the decoder.
+        std::vector<std::string> encodeTarget(const std::string& text) const;
+
+        // Same with SentencePiece ids, which skips building a string per piece.
+        std::vector<int> encodeIds(const std::string& text) const;
+        std::string decodeIds(const std::vector<int>& ids) const;
+        std::vector<std::string> decodeBatch(const std::vector<std::vector<std::string>>& batchPieces) const;
+
+        const sentencepiece::SentencePieceProcessor& source() const { return m_source; }
+        const sentencepiece::SentencePieceProcessor& target() const { return m_target; }
+
+    private:
+        sentencepiece::SentencePieceProcessor m_source;
+        sentencepiece::SentencePieceProcessor m_target;
+    };
+
+}
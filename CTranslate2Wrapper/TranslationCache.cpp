@@ -0,0 +1,144 @@
+#include "TranslationCache.h"
+
+#include <cctype>
+#include <functional>
+#include <sstream>
+
+namespace CTranslate2Wrapper::Native {
+
+	TranslationCache::TranslationCache(size_t capacityBytes)
+		: m_shardCapacity(capacityBytes / shardCount)
+	{
+	}
+
+	std::string TranslationCache::makeKey(const std::string& modelId,
+	                                      const ctranslate2::TranslationOptions& options,
+	                                      const std::string& text)
+	{
+		// Options that only shape the returned structure (scores, attention...) are left out.
+		std::ostringstream key;
+		key << modelId << '\x1f'
+			<< options.beam_size << ' ' << options.patience << ' '
+			<< options.length_penalty << ' ' << options.coverage_penalty << ' '
+			<< options.repetition_penalty << ' ' << options.no_repeat_ngram_size << ' '
+			<< options.disable_unk << ' ' << options.prefix_bias_beta << ' '
+			<< options.max_input_length << ' ' << options.max_decoding_length << ' '
+			<< options.min_decoding_length << ' ' << options.sampling_topk << ' '
+			<< options.sampling_topp << ' ' << options.sampling_temperature << ' '
+			<< options.use_vmap << ' ' << options.replace_unknowns << '\x1f'
+			<< normalize(text);
+		return key.str();
+	}
+
+	std::string TranslationCache::normalize(const std::string& text)
+	{
+		std::string normalized;
+		normalized.reserve(text.size());
+		bool pendingSpace = false;
+		for (const char c : text)
+		{
+			if (std::isspace(static_cast<unsigned char>(c)))
+			{
+				pendingSpace = !normalized.empty();
+				continue;
+			}
+			if (pendingSpace)
+			{
+				normalized.push_back(' ');
+				pendingSpace = false;
+			}
+			normalized.push_back(c);
+		}
+		return normalized;
+	}
+
+	size_t TranslationCache::entrySize(const std::string& key, const std::string& value)
+	{
+		// Rough per-entry overhead of the list node and the hash map node.
+		constexpr size_t overhead = 2 * sizeof(Entry) + 64;
+		return 2 * key.size() + value.size() + overhead;
+	}
+
+	TranslationCache::Shard& TranslationCache::shardFor(const std::string& key)
+	{
+		return m_shards[std::hash<std::string>()(key) % shardCount];
+	}
+
+	std::optional<std::string> TranslationCache::find(const std::string& key)
+	{
+		Shard& shard = shardFor(key);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+
+		const auto it = shard.index.find(key);
+		if (it == shard.index.end())
+		{
+			m_misses.fetch_add(1, std::memory_order_relaxed);
+			return std::nullopt;
+		}
+
+		// Move to the front of the LRU list.
+		shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+		m_hits.fetch_add(1, std::memory_order_relaxed);
+		return it->second->value;
+	}
+
+	void TranslationCache::insert(const std::string& key, const std::string& translation)
+	{
+		const size_t size = entrySize(key, translation);
+		if (size > m_shardCapacity)
+		{
+			return;
+		}
+
+		Shard& shard = shardFor(key);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+
+		const auto existing = shard.index.find(key);
+		if (existing != shard.index.end())
+		{
+			shard.bytes -= entrySize(key, existing->second->value);
+			shard.entries.erase(existing->second);
+			shard.index.erase(existing);
+		}
+
+		while (!shard.entries.empty() && shard.bytes + size > m_shardCapacity)
+		{
+			const Entry& last = shard.entries.back();
+			shard.bytes -= entrySize(last.key, last.value);
+			shard.index.erase(last.key);
+			shard.entries.pop_back();
+			m_evictions.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		shard.entries.push_front(Entry{ key, translation });
+		shard.index.emplace(key, shard.entries.begin());
+		shard.bytes += size;
+	}
+
+	void TranslationCache::clear()
+	{
+		for (Shard& shard : m_shards)
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			shard.index.clear();
+			shard.entries.clear();
+			shard.bytes = 0;
+		}
+	}
+
+	TranslationCacheStatistics TranslationCache::statistics() const
+	{
+		TranslationCacheStatistics statistics;
+		statistics.hits = m_hits.load(std::memory_order_relaxed);
+		statistics.misses = m_misses.load(std::memory_order_relaxed);
+		statistics.evictions = m_evictions.load(std::memory_order_relaxed);
+		for (const Shard& shard : m_shards)
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			statistics.entries += shard.entries.size();
+			statistics.bytes += shard.bytes;
+		}
+		return statistics;
+	}
+
+}
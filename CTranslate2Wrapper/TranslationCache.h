@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <ctranslate2/translation.h>
+
+namespace CTranslate2Wrapper::Native {
+
+    struct TranslationCacheStatistics
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    // Memory-capped LRU cache of finished translations.
+    //
+    // Entries are spread over independent shards by key hash, each with its own lock and
+    // LRU list, so concurrent lookups of different texts rarely touch the same mutex. The
+    // byte budget is split evenly between shards and counts keys, values and bookkeeping.
+    class TranslationCache
+    {
+    public:
+        static constexpr size_t shardCount = 16;
+        static constexpr size_t defaultCapacityBytes = 16 * 1024 * 1024;
+
+        explicit TranslationCache(size_t capacityBytes = defaultCapacityBytes);
+
+        TranslationCache(const TranslationCache&) = delete;
+        TranslationCache& operator=(const TranslationCache&) = delete;
+
+        // Builds the lookup key: the normalized source text, the model id and every
+        // decoding option that can change the output.
+        static std::string makeKey(const std::string& modelId,
+                                   const ctranslate2::TranslationOptions& options,
+                                   const std::string& text);
+
+        // Trims the text and collapses runs of whitespace, so "hello  world " and
+        // "hello world" share an entry.
+        static std::string normalize(const std::string& text);
+
+        std::optional<std::string> find(const std::string& key);
+        void insert(const std::string& key, const std::string& translation);
+        void clear();
+
+        TranslationCacheStatistics statistics() const;
+
+    private:
+        struct Entry
+        {
+            std::string key;
+            std::string value;
+        };
+
+        struct Shard
+        {
+            mutable std::mutex mutex;
+            std::list<Entry> entries; // Most recently used first.
+            std::unordered_map<std::string, std::list<Entry>::iterator> index;
+            size_t bytes = 0;
+        };
+
+        static size_t entrySize(const std::string& key, const std::string& value);
+        Shard& shardFor(const std::string& key);
+
+        const size_t m_shardCapacity;
+        std::array<Shard, shardCount> m_shards;
+        std::atomic<size_t> m_hits{ 0 };
+        std::atomic<size_t> m_misses{ 0 };
+        std::atomic<size_t> m_evictions{ 0 };
+    };
+
+}
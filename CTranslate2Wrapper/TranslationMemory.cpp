@@ -0,0 +1,626 @@
+#include "TranslationMemory.h"
+
+#include "TranslationCache.h"
+#include "Utf8Transcoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+namespace CTranslate2Wrapper::Native {
+
+	struct TranslationMemory::ExactSlot
+	{
+		uint64_t hash;
+		uint32_t entry;
+		uint32_t reserved;
+	};
+
+	struct TranslationMemory::GramSlot
+	{
+		uint32_t gram;
+		// First posting of the trigram; the next slot's first ends it.
+		uint32_t first;
+	};
+
+	namespace {
+		constexpr char magic[8] = { 'C', 'T', '2', 'T', 'R', 'M', 'E', 'M' };
+		constexpr uint32_t formatVersion = 1;
+		// Near-match candidates scored by edit distance, best trigram overlap first.
+		constexpr size_t maxCandidates = 32;
+
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t entryCount;
+			uint32_t gramCount;
+			uint32_t reserved;
+			uint64_t postingCount;
+			uint64_t stringBytes;
+		};
+
+		uint64_t fnv1a(std::string_view text)
+		{
+			uint64_t hash = 0xcbf29ce484222325ull;
+			for (const char c : text)
+			{
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 0x100000001b3ull;
+			}
+			return hash;
+		}
+
+		std::u16string toUnits(std::string_view text)
+		{
+			return std::u16string(utf8ToUtf16Scratch(text));
+		}
+
+		// Distinct character trigrams, sorted. A text shorter than three units is a
+		// single gram of its own.
+		std::vector<uint32_t> trigrams(const std::u16string& units)
+		{
+			const auto gram = [&units](size_t begin, size_t length)
+			{
+				uint64_t hash = 0xcbf29ce484222325ull ^ length;
+				for (size_t i = begin; i < begin + length; ++i)
+				{
+					hash ^= units[i];
+					hash *= 0x100000001b3ull;
+				}
+				return static_cast<uint32_t>(hash ^ (hash >> 32));
+			};
+
+			std::vector<uint32_t> grams;
+			if (units.size() < 3)
+			{
+				grams.push_back(gram(0, units.size()));
+				return grams;
+			}
+			grams.reserve(units.size() - 2);
+			for (size_t i = 0; i + 3 <= units.size(); ++i)
+			{
+				grams.push_back(gram(i, 3));
+			}
+			std::sort(grams.begin(), grams.end());
+			grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+			return grams;
+		}
+
+		// Levenshtein distance, or maxDistance + 1 as soon as it is known to be larger.
+		size_t editDistance(const std::u16string& a, const std::u16string& b, size_t maxDistance)
+		{
+			const size_t difference = a.size() > b.size() ? a.size() - b.size() : b.size() - a.size();
+			if (difference > maxDistance)
+			{
+				return maxDistance + 1;
+			}
+
+			std::vector<size_t> previous(b.size() + 1);
+			std::vector<size_t> current(b.size() + 1);
+			for (size_t j = 0; j <= b.size(); ++j)
+			{
+				previous[j] = j;
+			}
+			for (size_t i = 1; i <= a.size(); ++i)
+			{
+				current[0] = i;
+				size_t rowMin = current[0];
+				for (size_t j = 1; j <= b.size(); ++j)
+				{
+					const size_t substitution = previous[j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1);
+					current[j] = std::min({ previous[j] + 1, current[j - 1] + 1, substitution });
+					rowMin = std::min(rowMin, current[j]);
+				}
+				if (rowMin > maxDistance)
+				{
+					return maxDistance + 1;
+				}
+				std::swap(previous, current);
+			}
+			return previous[b.size()];
+		}
+
+		template <typename T>
+		void append(std::string& bytes, const T* values, size_t count)
+		{
+			bytes.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+		}
+	}
+
+	TranslationMemory::TranslationMemory(std::string path)
+		: m_path(std::move(path))
+	{
+		m_file = MappedFile::open(m_path);
+		mapViews();
+	}
+
+	void TranslationMemory::mapViews()
+	{
+		m_exact = nullptr;
+		m_lengths = nullptr;
+		m_gramCounts = nullptr;
+		m_grams = nullptr;
+		m_postings = nullptr;
+		m_offsets = nullptr;
+		m_strings = nullptr;
+		m_entryCount = 0;
+		m_gramCount = 0;
+		if (!m_file)
+		{
+			return;
+		}
+
+		const auto invalid = [this]() { return std::runtime_error(m_path + " is not a translation memory file."); };
+		const char* data = m_file->data();
+		const size_t size = m_file->size();
+
+		Header header;
+		if (size < sizeof(header))
+		{
+			throw invalid();
+		}
+		std::memcpy(&header, data, sizeof(header));
+		if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != formatVersion)
+		{
+			throw invalid();
+		}
+
+		// Bounds before sizes are computed from them, so the sum below cannot wrap.
+		if (header.entryCount > size / sizeof(ExactSlot) || header.gramCount > size / sizeof(GramSlot)
+			|| header.postingCount > size / sizeof(uint32_t) || header.stringBytes > size)
+		{
+			throw invalid();
+		}
+		const size_t entries = header.entryCount;
+		const size_t gramSlots = uint64_t(header.gramCount) + 1;
+		const size_t paddedPostings = (header.postingCount + 1) / 2 * 2;
+		const size_t expected = sizeof(Header)
+			+ entries * sizeof(ExactSlot)
+			+ entries * 2 * sizeof(uint32_t)
+			+ gramSlots * sizeof(GramSlot)
+			+ paddedPostings * sizeof(uint32_t)
+			+ (2 * entries + 1) * sizeof(uint64_t)
+			+ header.stringBytes;
+		if (size != expected)
+		{
+			throw invalid();
+		}
+
+		const char* cursor = data + sizeof(Header);
+		const auto* exact = reinterpret_cast<const ExactSlot*>(cursor);
+		cursor += entries * sizeof(ExactSlot);
+		const auto* lengths = reinterpret_cast<const uint32_t*>(cursor);
+		cursor += entries * sizeof(uint32_t);
+		const auto* gramCounts = reinterpret_cast<const uint32_t*>(cursor);
+		cursor += entries * sizeof(uint32_t);
+		const auto* grams = reinterpret_cast<const GramSlot*>(cursor);
+		cursor += gramSlots * sizeof(GramSlot);
+		const auto* postings = reinterpret_cast<const uint32_t*>(cursor);
+		cursor += paddedPostings * sizeof(uint32_t);
+		const auto* offsets = reinterpret_cast<const uint64_t*>(cursor);
+		cursor += (2 * entries + 1) * sizeof(uint64_t);
+
+		// A damaged file must not send a lookup out of the mapping: every slot and posting
+		// names an entry, each trigram's postings lie within the posting list, and the
+		// offsets run from 0 to the end of the strings.
+		const auto namesEntry = [entries](uint32_t entry) { return entry < entries; };
+		const GramSlot* gramsEnd = grams + gramSlots;
+		const uint64_t* offsetsEnd = offsets + 2 * entries + 1;
+		if (!std::all_of(exact, exact + entries, [&namesEntry](const ExactSlot& slot) { return namesEntry(slot.entry); })
+			|| !std::all_of(postings, postings + header.postingCount, namesEntry)
+			|| grams[header.gramCount].first != header.postingCount
+			|| std::adjacent_find(grams, gramsEnd, [](const GramSlot& slot, const GramSlot& next) { return slot.first > next.first; }) != gramsEnd
+			|| offsets[0] != 0 || offsets[2 * entries] != header.stringBytes
+			|| std::adjacent_find(offsets, offsetsEnd, std::greater<uint64_t>()) != offsetsEnd)
+		{
+			throw invalid();
+		}
+
+		m_exact = exact;
+		m_lengths = lengths;
+		m_gramCounts = gramCounts;
+		m_grams = grams;
+		m_postings = postings;
+		m_offsets = offsets;
+		m_strings = cursor;
+		m_entryCount = entries;
+		m_gramCount = header.gramCount;
+	}
+
+	std::string_view TranslationMemory::storedSource(size_t entry) const
+	{
+		return std::string_view(m_strings + m_offsets[2 * entry], static_cast<size_t>(m_offsets[2 * entry + 1] - m_offsets[2 * entry]));
+	}
+
+	std::string_view TranslationMemory::storedTarget(size_t entry) const
+	{
+		return std::string_view(m_strings + m_offsets[2 * entry + 1], static_cast<size_t>(m_offsets[2 * entry + 2] - m_offsets[2 * entry + 1]));
+	}
+
+	std::optional<size_t> TranslationMemory::findStored(std::string_view source, uint64_t hash) const
+	{
+		const ExactSlot* end = m_exact + m_entryCount;
+		const ExactSlot* slot = std::lower_bound(m_exact, end, hash,
+			[](const ExactSlot& candidate, uint64_t value) { return candidate.hash < value; });
+		for (; slot != end && slot->hash == hash; ++slot)
+		{
+			if (storedSource(slot->entry) == source)
+			{
+				return slot->entry;
+			}
+		}
+		return std::nullopt;
+	}
+
+	std::optional<TranslationMemoryMatch> TranslationMemory::find(const std::string& text, float minScore) const
+	{
+		m_lookups.fetch_add(1, std::memory_order_relaxed);
+		const std::string normalized = TranslationCache::normalize(text);
+		if (normalized.empty())
+		{
+			return std::nullopt;
+		}
+		const uint64_t hash = fnv1a(normalized);
+
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+		// 1. Exact match, the pairs added since the last save first.
+		const auto added = m_addedBySource.equal_range(hash);
+		for (auto it = added.first; it != added.second; ++it)
+		{
+			const Added& entry = m_added[it->second];
+			if (entry.source == normalized)
+			{
+				m_exactHits.fetch_add(1, std::memory_order_relaxed);
+				return TranslationMemoryMatch{ entry.source, entry.target, 1.0f };
+			}
+		}
+		if (const auto stored = findStored(normalized, hash))
+		{
+			m_exactHits.fetch_add(1, std::memory_order_relaxed);
+			return TranslationMemoryMatch{ std::string(storedSource(*stored)), std::string(storedTarget(*stored)), 1.0f };
+		}
+		if (minScore >= 1)
+		{
+			return std::nullopt;
+		}
+
+		// 2. Count the trigrams every entry shares with the text. Keys are stored entry
+		//    ids, or addedFlag | index into m_added.
+		constexpr uint32_t addedFlag = 1u << 31;
+		const std::u16string query = toUnits(normalized);
+		const std::vector<uint32_t> queryGrams = trigrams(query);
+		std::unordered_map<uint32_t, uint32_t> shared;
+		const GramSlot* gramsEnd = m_grams ? m_grams + m_gramCount : nullptr;
+		for (const uint32_t gram : queryGrams)
+		{
+			if (m_grams)
+			{
+				const GramSlot* slot = std::lower_bound(m_grams, gramsEnd, gram,
+					[](const GramSlot& candidate, uint32_t value) { return candidate.gram < value; });
+				if (slot != gramsEnd && slot->gram == gram)
+				{
+					for (uint32_t posting = slot->first; posting < (slot + 1)->first; ++posting)
+					{
+						++shared[m_postings[posting]];
+					}
+				}
+			}
+			const auto addedGram = m_addedGrams.find(gram);
+			if (addedGram != m_addedGrams.end())
+			{
+				for (const uint32_t index : addedGram->second)
+				{
+					++shared[addedFlag | index];
+				}
+			}
+		}
+
+		// 3. Rank by trigram overlap (Dice coefficient), which needs no string, and score
+		//    the best candidates by edit distance. A length difference alone can rule an
+		//    entry out.
+		struct Candidate
+		{
+			uint32_t key;
+			float overlap;
+		};
+		std::vector<Candidate> candidates;
+		candidates.reserve(shared.size());
+		for (const auto& [key, count] : shared)
+		{
+			const bool isAdded = (key & addedFlag) != 0;
+			const size_t length = isAdded ? m_added[key & ~addedFlag].units.size() : m_lengths[key];
+			const size_t gramCount = isAdded ? m_added[key & ~addedFlag].gramCount : m_gramCounts[key];
+			const size_t longer = std::max(length, query.size());
+			const size_t difference = longer - std::min(length, query.size());
+			if (static_cast<float>(difference) > (1 - minScore) * static_cast<float>(longer))
+			{
+				continue;
+			}
+			candidates.push_back({ key, 2.0f * count / static_cast<float>(queryGrams.size() + gramCount) });
+		}
+		const auto byOverlap = [](const Candidate& a, const Candidate& b) { return a.overlap > b.overlap; };
+		if (candidates.size() > maxCandidates)
+		{
+			std::nth_element(candidates.begin(), candidates.begin() + maxCandidates, candidates.end(), byOverlap);
+			candidates.resize(maxCandidates);
+		}
+		std::sort(candidates.begin(), candidates.end(), byOverlap);
+
+		std::optional<TranslationMemoryMatch> best;
+		for (const Candidate& candidate : candidates)
+		{
+			const bool isAdded = (candidate.key & addedFlag) != 0;
+			std::string_view source;
+			std::u16string storedUnits;
+			const std::u16string* units = nullptr;
+			if (isAdded)
+			{
+				const Added& entry = m_added[candidate.key & ~addedFlag];
+				source = entry.source;
+				units = &entry.units;
+			}
+			else
+			{
+				source = storedSource(candidate.key);
+				// Replaced by an added pair, which is a candidate of its own.
+				const auto replacements = m_addedBySource.equal_range(fnv1a(source));
+				if (std::any_of(replacements.first, replacements.second,
+					[&](const auto& replacement) { return m_added[replacement.second].source == source; }))
+				{
+					continue;
+				}
+				storedUnits = toUnits(source);
+				units = &storedUnits;
+			}
+
+			const size_t longer = std::max(units->size(), query.size());
+			const float floor = best ? best->score : minScore;
+			const size_t maxDistance = static_cast<size_t>((1 - floor) * static_cast<float>(longer) + 1e-4f);
+			const size_t distance = editDistance(query, *units, maxDistance);
+			if (distance > maxDistance)
+			{
+				continue;
+			}
+			const float score = 1 - static_cast<float>(distance) / static_cast<float>(longer);
+			if (score >= minScore && (!best || score > best->score))
+			{
+				const std::string_view target = isAdded ? std::string_view(m_added[candidate.key & ~addedFlag].target) : storedTarget(candidate.key);
+				best = TranslationMemoryMatch{ std::string(source), std::string(target), score };
+			}
+		}
+
+		if (best)
+		{
+			m_nearHits.fetch_add(1, std::memory_order_relaxed);
+		}
+		return best;
+	}
+
+	void TranslationMemory::add(const std::string& source, const std::string& target)
+	{
+		std::string normalized = TranslationCache::normalize(source);
+		if (normalized.empty())
+		{
+			throw std::invalid_argument("The source text of a translation memory entry is empty.");
+		}
+		const uint64_t hash = fnv1a(normalized);
+
+		std::unique_lock<std::shared_mutex> lock(m_mutex);
+		const auto existing = m_addedBySource.equal_range(hash);
+		for (auto it = existing.first; it != existing.second; ++it)
+		{
+			Added& entry = m_added[it->second];
+			if (entry.source == normalized)
+			{
+				entry.target = target;
+				return;
+			}
+		}
+		if (m_added.size() >= (1u << 31))
+		{
+			throw std::length_error("Too many translation memory entries added since the last save.");
+		}
+
+		if (findStored(normalized, hash))
+		{
+			++m_shadowed;
+		}
+
+		Added entry;
+		entry.source = std::move(normalized);
+		entry.target = target;
+		entry.units = toUnits(entry.source);
+		const std::vector<uint32_t> grams = trigrams(entry.units);
+		entry.gramCount = static_cast<uint32_t>(grams.size());
+
+		const auto index = static_cast<uint32_t>(m_added.size());
+		for (const uint32_t gram : grams)
+		{
+			m_addedGrams[gram].push_back(index);
+		}
+		m_addedBySource.emplace(hash, index);
+		m_added.push_back(std::move(entry));
+	}
+
+	void TranslationMemory::save()
+	{
+		std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+		// 1. Stored pairs first, then the added ones, which win over a stored pair with
+		//    the same source.
+		std::vector<std::pair<std::string, std::string>> entries;
+		entries.reserve(m_entryCount + m_added.size());
+		for (size_t entry = 0; entry < m_entryCount; ++entry)
+		{
+			entries.emplace_back(storedSource(entry), storedTarget(entry));
+		}
+		for (const Added& entry : m_added)
+		{
+			entries.emplace_back(entry.source, entry.target);
+		}
+		const std::string bytes = compile(entries);
+
+		// 2. Write next to the file, then swap it in. A mapped file cannot be replaced on
+		//    Windows, so the old mapping is released first and reopened on failure.
+		const std::filesystem::path path = std::filesystem::u8path(m_path);
+		std::error_code error;
+		if (path.has_parent_path())
+		{
+			std::filesystem::create_directories(path.parent_path(), error);
+		}
+		std::filesystem::path temporaryPath = path;
+		temporaryPath += ".tmp" + std::to_string(std::random_device()());
+		{
+			std::ofstream file(temporaryPath, std::ios::binary);
+			if (!file || !file.write(bytes.data(), static_cast<std::streamsize>(bytes.size())) || !file.flush())
+			{
+				file.close();
+				std::filesystem::remove(temporaryPath, error);
+				throw std::runtime_error("Cannot write the translation memory " + m_path + ".");
+			}
+		}
+
+		m_file.reset();
+		mapViews();
+		std::filesystem::rename(temporaryPath, path, error);
+		if (error)
+		{
+			std::error_code ignored;
+			std::filesystem::remove(temporaryPath, ignored);
+			m_file = MappedFile::open(m_path);
+			mapViews();
+			throw std::runtime_error("Cannot replace the translation memory " + m_path + ": " + error.message());
+		}
+
+		// 3. Everything is stored now.
+		m_file = MappedFile::open(m_path);
+		mapViews();
+		m_added.clear();
+		m_addedBySource.clear();
+		m_addedGrams.clear();
+		m_shadowed = 0;
+	}
+
+	TranslationMemoryStatistics TranslationMemory::statistics() const
+	{
+		TranslationMemoryStatistics statistics;
+		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+			statistics.entries = m_entryCount + m_added.size() - m_shadowed;
+		}
+		statistics.lookups = m_lookups.load(std::memory_order_relaxed);
+		statistics.exactHits = m_exactHits.load(std::memory_order_relaxed);
+		statistics.nearHits = m_nearHits.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	std::string TranslationMemory::compile(const std::vector<std::pair<std::string, std::string>>& entries)
+	{
+		// 1. One entry per source, with its last target.
+		std::vector<std::pair<std::string_view, std::string_view>> unique;
+		{
+			std::unordered_map<std::string_view, size_t> positions;
+			for (const auto& [source, target] : entries)
+			{
+				const auto [it, inserted] = positions.emplace(source, unique.size());
+				if (inserted)
+				{
+					unique.emplace_back(source, target);
+				}
+				else
+				{
+					unique[it->second].second = target;
+				}
+			}
+		}
+		if (unique.size() >= std::numeric_limits<uint32_t>::max())
+		{
+			throw std::invalid_argument("The translation memory is too large to compile.");
+		}
+		const auto entryCount = static_cast<uint32_t>(unique.size());
+
+		// 2. Exact table, lengths and the trigram postings.
+		std::vector<ExactSlot> exact;
+		std::vector<uint32_t> lengths;
+		std::vector<uint32_t> gramCounts;
+		std::map<uint32_t, std::vector<uint32_t>> postingsByGram;
+		exact.reserve(entryCount);
+		lengths.reserve(entryCount);
+		gramCounts.reserve(entryCount);
+		for (uint32_t entry = 0; entry < entryCount; ++entry)
+		{
+			exact.push_back({ fnv1a(unique[entry].first), entry, 0 });
+			const std::u16string units = toUnits(unique[entry].first);
+			const std::vector<uint32_t> grams = trigrams(units);
+			lengths.push_back(static_cast<uint32_t>(units.size()));
+			gramCounts.push_back(static_cast<uint32_t>(grams.size()));
+			for (const uint32_t gram : grams)
+			{
+				postingsByGram[gram].push_back(entry);
+			}
+		}
+		std::sort(exact.begin(), exact.end(),
+			[](const ExactSlot& a, const ExactSlot& b) { return a.hash < b.hash || (a.hash == b.hash && a.entry < b.entry); });
+
+		std::vector<GramSlot> grams;
+		std::vector<uint32_t> postings;
+		grams.reserve(postingsByGram.size() + 1);
+		for (const auto& [gram, entryIds] : postingsByGram)
+		{
+			grams.push_back({ gram, static_cast<uint32_t>(postings.size()) });
+			postings.insert(postings.end(), entryIds.begin(), entryIds.end());
+		}
+		if (postings.size() >= std::numeric_limits<uint32_t>::max())
+		{
+			throw std::invalid_argument("The translation memory is too large to compile.");
+		}
+		const size_t postingCount = postings.size();
+		grams.push_back({ 0, static_cast<uint32_t>(postingCount) });
+		if (postings.size() % 2 != 0)
+		{
+			postings.push_back(0);
+		}
+
+		// 3. Strings.
+		std::vector<uint64_t> offsets;
+		offsets.reserve(2 * static_cast<size_t>(entryCount) + 1);
+		std::string strings;
+		for (const auto& [source, target] : unique)
+		{
+			offsets.push_back(strings.size());
+			strings.append(source);
+			offsets.push_back(strings.size());
+			strings.append(target);
+		}
+		offsets.push_back(strings.size());
+
+		Header header{};
+		std::memcpy(header.magic, magic, sizeof(magic));
+		header.version = formatVersion;
+		header.entryCount = entryCount;
+		header.gramCount = static_cast<uint32_t>(grams.size() - 1);
+		header.postingCount = postingCount;
+		header.stringBytes = strings.size();
+
+		std::string bytes;
+		append(bytes, &header, 1);
+		append(bytes, exact.data(), exact.size());
+		append(bytes, lengths.data(), lengths.size());
+		append(bytes, gramCounts.data(), gramCounts.size());
+		append(bytes, grams.data(), grams.size());
+		append(bytes, postings.data(), postings.size());
+		append(bytes, offsets.data(), offsets.size());
+		bytes.append(strings);
+		return bytes;
+	}
+
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "MmapModelReader.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    struct TranslationMemoryMatch
+    {
+        std::string source;
+        std::string target;
+        // 1 for an exact match; otherwise 1 - edit distance / length of the longer text.
+        float score = 0;
+    };
+
+    struct TranslationMemoryStatistics
+    {
+        size_t entries = 0;
+        size_t lookups = 0;
+        size_t exactHits = 0;
+        size_t nearHits = 0;
+    };
+
+    // Source/target pairs stored in one file (<name>.ct2tm) and read through a memory
+    // mapping, so opening a large memory reads nothing up front and every process shares
+    // its pages.
+    //
+    // Sources are compared after TranslationCache::normalize. Exact matches go through a
+    // sorted hash table; near matches through an inverted index of character trigrams:
+    // the entries sharing the most trigrams with the query are scored by edit distance
+    // (UTF-16 code units), and the best one at or above the requested score wins.
+    //
+    // Pairs added at run time are kept in memory, indexed the same way, and shadow a
+    // stored pair with the same source until save() writes everything back.
+    //
+    // Layout, all integers little endian:
+    //   Header
+    //   ExactSlot exact[entryCount]             by source hash
+    //   uint32    lengths[entryCount]           source length in UTF-16 code units
+    //   uint32    gramCounts[entryCount]        distinct trigrams of the source
+    //   GramSlot  grams[gramCount + 1]          by trigram, with an end sentinel
+    //   uint32    postings[postingCount]        entry ids, padded to 8 bytes
+    //   uint64    offsets[2 * entryCount + 1]   source i, then target i, in strings
+    //   char      strings[stringBytes]
+    class TranslationMemory
+    {
+    public:
+        static constexpr const char* extension = ".ct2tm";
+
+        // Opens the memory stored at path, or starts an empty one if the file does not
+        // exist yet. Throws std::runtime_error if the file is not a translation memory.
+        explicit TranslationMemory(std::string path);
+
+        TranslationMemory(const TranslationMemory&) = delete;
+        TranslationMemory& operator=(const TranslationMemory&) = delete;
+
+        const std::string& path() const { return m_path; }
+
+        // Best match for text scoring at least minScore. A minScore of 1 only looks for
+        // an exact match.
+        std::optional<TranslationMemoryMatch> find(const std::string& text, float minScore) const;
+
+        // Adds a pair, or replaces the target of a source already in the memory.
+        // Throws std::invalid_argument if the source is empty once normalized.
+        void add(const std::string& source, const std::string& target);
+
+        // Writes every pair to the file, replacing it atomically, and maps the new file.
+        // Throws std::runtime_error if the file cannot be written.
+        void save();
+
+        TranslationMemoryStatistics statistics() const;
+
+        // Builds the file contents for these (normalized source, target) pairs. A source
+        // given twice keeps its last target.
+        static std::string compile(const std::vector<std::pair<std::string, std::string>>& entries);
+
+    private:
+        // On-disk records, defined with the format in the .cpp.
+        struct ExactSlot;
+        struct GramSlot;
+
+        struct Added
+        {
+            std::string source;
+            std::string target;
+            std::u16string units;
+            uint32_t gramCount = 0;
+        };
+
+        // Points the views below at m_file, which must hold a valid memory.
+        void mapViews();
+        std::string_view storedSource(size_t entry) const;
+        std::string_view storedTarget(size_t entry) const;
+        // Stored entry with this normalized source, if any. Locked by the caller.
+        std::optional<size_t> findStored(std::string_view source, uint64_t hash) const;
+
+        const std::string m_path;
+
+        mutable std::shared_mutex m_mutex;
+        std::shared_ptr<const MappedFile> m_file;
+        const ExactSlot* m_exact = nullptr;
+        const uint32_t* m_lengths = nullptr;
+        const uint32_t* m_gramCounts = nullptr;
+        const GramSlot* m_grams = nullptr;
+        const uint32_t* m_postings = nullptr;
+        const uint64_t* m_offsets = nullptr;
+        const char* m_strings = nullptr;
+        size_t m_entryCount = 0;
+        size_t m_gramCount = 0;
+
+        std::vector<Added> m_added;
+        // Source hash -> indices into m_added.
+        std::unordered_multimap<uint64_t, size_t> m_addedBySource;
+        // Trigram -> indices into m_added.
+        std::unordered_map<uint32_t, std::vector<uint32_t>> m_addedGrams;
+        // Stored entries replaced by an added one.
+        size_t m_shadowed = 0;
+
+        mutable std::atomic<size_t> m_lookups{ 0 };
+        mutable std::atomic<size_t> m_exactHits{ 0 };
+        mutable std::atomic<size_t> m_nearHits{ 0 };
+    };
+
+}
@@ -0,0 +1,167 @@
+#include "TranslationStream.h"
+
+#include <algorithm>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// UTF-8 encoding of U+FFFD, produced by SentencePiece for incomplete byte sequences.
+		constexpr char replacementCharacter[] = "\xEF\xBF\xBD";
+
+		bool endsWithIncompleteCharacter(const std::string& text)
+		{
+			constexpr size_t length = sizeof(replacementCharacter) - 1;
+			return text.size() >= length && text.compare(text.size() - length, length, replacementCharacter) == 0;
+		}
+
+		// Reports the prefix shared by all live beams of the (single) example being decoded.
+		class BeamAgreement : public ctranslate2::LogitsProcessor
+		{
+		public:
+			explicit BeamAgreement(TranslationStream& stream)
+				: m_stream(stream)
+			{
+			}
+
+			void apply(ctranslate2::dim_t,
+			           ctranslate2::StorageView&,
+			           ctranslate2::DisableTokens&,
+			           const ctranslate2::StorageView& sequences,
+			           const std::vector<ctranslate2::dim_t>&,
+			           const std::vector<std::vector<size_t>>* prefix) override
+			{
+				// The sequences hold the tokens selected in the previous steps, one row per beam.
+				if (sequences.empty() || sequences.rank() != 2 || sequences.dtype() != ctranslate2::DataType::INT32)
+				{
+					return;
+				}
+
+				const ctranslate2::StorageView hostSequences = sequences.to(ctranslate2::Device::CPU);
+				const ctranslate2::dim_t rows = hostSequences.dim(0);
+				const ctranslate2::dim_t columns = hostSequences.dim(1);
+				const int32_t* data = hostSequences.data<int32_t>();
+
+				// A forced target prefix is part of the sequences but not new output.
+				const ctranslate2::dim_t begin = prefix && !prefix->empty() ? static_cast<ctranslate2::dim_t>(prefix->front().size()) : 0;
+
+				ctranslate2::dim_t agreed = columns;
+				for (ctranslate2::dim_t row = 1; row < rows; ++row)
+				{
+					ctranslate2::dim_t column = begin;
+					while (column < agreed && data[row * columns + column] == data[column])
+					{
+						++column;
+					}
+					agreed = column;
+				}
+
+				if (agreed > begin)
+				{
+					m_stream.advance(std::vector<size_t>(data + begin, data + agreed));
+				}
+			}
+
+		private:
+			TranslationStream& m_stream;
+		};
+	}
+
+	IncrementalDetokenizer::IncrementalDetokenizer(const TokenizerService& tokenizer)
+		: m_tokenizer(tokenizer)
+	{
+	}
+
+	std::string IncrementalDetokenizer::push(const std::vector<std::string>& pieces)
+	{
+		m_pieces.insert(m_pieces.end(), pieces.begin(), pieces.end());
+		if (m_readOffset == m_pieces.size())
+		{
+			return std::string();
+		}
+
+		const auto begin = m_pieces.begin();
+		const std::string previous = m_tokenizer.decode(std::vector<std::string>(begin + m_prefixOffset, begin + m_readOffset));
+		const std::string current = m_tokenizer.decode(std::vector<std::string>(begin + m_prefixOffset, m_pieces.end()));
+
+		// On the first push the window is everything, so previous is empty and the
+		// whole decoding is new text.
+		if (current.size() <= previous.size()
+			|| current.compare(0, previous.size(), previous) != 0
+			|| endsWithIncompleteCharacter(current))
+		{
+			return std::string();
+		}
+
+		std::string delta = current.substr(previous.size());
+		m_prefixOffset = m_readOffset;
+		m_readOffset = m_pieces.size();
+		m_text += delta;
+		return delta;
+	}
+
+	TranslationStream::TranslationStream(const ctranslate2::models::SequenceToSequenceModel& model,
+	                                     const TokenizerService& tokenizer,
+	                                     PartialTranslationCallback onPartial)
+		: m_model(model)
+		, m_detokenizer(tokenizer)
+		, m_onPartial(std::move(onPartial))
+	{
+	}
+
+	void TranslationStream::attach(ctranslate2::DecodingOptions& options)
+	{
+		if (options.beam_size <= 1)
+		{
+			auto previous = std::move(options.callback);
+			options.callback = [this, previous = std::move(previous)](ctranslate2::DecodingStepResult step)
+			{
+				std::vector<size_t> ids = m_ids;
+				ids.push_back(step.token_id);
+				advance(ids);
+				return previous ? previous(std::move(step)) : false;
+			};
+		}
+		else
+		{
+			options.logits_processors.emplace_back(std::make_shared<BeamAgreement>(*this));
+		}
+	}
+
+	void TranslationStream::pushPrefix(const std::vector<size_t>& prefixIds)
+	{
+		emit(prefixIds, 0);
+	}
+
+	void TranslationStream::advance(const std::vector<size_t>& stableIds)
+	{
+		if (stableIds.size() <= m_ids.size())
+		{
+			return;
+		}
+
+		const size_t begin = m_ids.size();
+		m_ids = stableIds;
+		emit(stableIds, begin);
+	}
+
+	void TranslationStream::emit(const std::vector<size_t>& ids, size_t begin)
+	{
+		const auto& vocabulary = m_model.get_target_vocabulary();
+		const size_t eosId = vocabulary.eos_id();
+
+		std::vector<std::string> pieces;
+		for (size_t i = begin; i < ids.size(); ++i)
+		{
+			if (ids[i] != eosId)
+			{
+				pieces.push_back(vocabulary.to_token(ids[i]));
+			}
+		}
+
+		if (!m_detokenizer.push(pieces).empty() && m_onPartial)
+		{
+			m_onPartial(m_detokenizer.text());
+		}
+	}
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ctranslate2/decoding.h>
+#include <ctranslate2/models/sequence_to_sequence.h>
+
+#include "TokenizerService.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // Receives the whole translation decoded so far, each time it grows.
+    using PartialTranslationCallback = std::function<void(const std::string& partialText)>;
+
+    // Turns a growing list of target pieces into growing UTF-8 text.
+    //
+    // Decoding piece by piece is wrong for SentencePiece: the leading "\xE2\x96\x81" of the first
+    // piece is dropped and byte-fallback pieces only form a character once all its bytes
+    // are there. So every push decodes a small window that starts one piece before the
+    // unread pieces and only emits the part that extends the window's previous decoding.
+    // While the window ends in an incomplete character (decoded as U+FFFD) nothing is emitted.
+    class IncrementalDetokenizer
+    {
+    public:
+        explicit IncrementalDetokenizer(const TokenizerService& tokenizer);
+
+        // Appends pieces and returns the newly completed text, possibly empty.
+        std::string push(const std::vector<std::string>& pieces);
+
+        const std::string& text() const { return m_text; }
+
+    private:
+        const TokenizerService& m_tokenizer;
+        std::vector<std::string> m_pieces;
+        size_t m_prefixOffset = 0;
+        size_t m_readOffset = 0;
+        std::string m_text;
+    };
+
+    // Connects a decoding run to a partial translation callback.
+    //
+    // Greedy search reports every selected token through DecodingOptions::callback.
+    // Beam search has no such hook, so a logits processor looks at the live beams at every
+    // step and forwards the prefix that all of them agree on; no live beam can still
+    // change that prefix. The stream must outlive the decoding run it is attached to.
+    class TranslationStream
+    {
+    public:
+        TranslationStream(const ctranslate2::models::SequenceToSequenceModel& model,
+                          const TokenizerService& tokenizer,
+                          PartialTranslationCallback onPartial);
+
+        // Installs the callback or logits processor matching options.beam_size.
+        void attach(ctranslate2::DecodingOptions& options);
+
+        // Reports a forced target prefix before decoding starts. The decoder does not
+        // report prefix tokens itself, so advance only ever sees the tokens after it.
+        void pushPrefix(const std::vector<size_t>& prefixIds);
+
+        // Feeds the ids of the hypothesis prefix that can no longer change, not counting
+        // the ids given to pushPrefix.
+        void advance(const std::vector<size_t>& stableIds);
+
+    private:
+        void emit(const std::vector<size_t>& ids, size_t begin);
+
+        const ctranslate2::models::SequenceToSequenceModel& m_model;
+        IncrementalDetokenizer m_detokenizer;
+        PartialTranslationCallback m_onPartial;
+        std::vector<size_t> m_ids;
+    };
+
+}
@@ -0,0 +1,88 @@
+#include "TranslatorConfig.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		// Intra-op parallelism of a Marian-sized model stops paying off around here;
+		// more cores are better spent on another replica.
+		constexpr size_t maxUsefulThreadsPerReplica = 8;
+	}
+
+	size_t TranslatorConfig::detectedCores()
+	{
+		return std::max<size_t>(1, std::thread::hardware_concurrency());
+	}
+
+	TranslatorConfig TranslatorConfig::resolved() const
+	{
+		const size_t cores = detectedCores();
+		TranslatorConfig config = *this;
+
+		if (config.replicas == 0)
+		{
+			// A palette query is latency-bound; only big machines get a second replica so
+			// that a pivot stage or a batch does not queue behind the interactive query.
+			config.replicas = cores >= 2 * maxUsefulThreadsPerReplica ? 2 : 1;
+		}
+		if (config.threadsPerReplica == 0)
+		{
+			config.threadsPerReplica = std::clamp<size_t>(cores / config.replicas, 1, maxUsefulThreadsPerReplica);
+		}
+		if (!config.computeType)
+		{
+			config.computeType = ctranslate2::ComputeType::INT8;
+		}
+
+		if (config.replicas > cores)
+		{
+			throw std::invalid_argument("replicas (" + std::to_string(config.replicas) + ") exceeds the "
+				+ std::to_string(cores) + " available cores.");
+		}
+		if (config.replicas * config.threadsPerReplica > 2 * cores)
+		{
+			throw std::invalid_argument("replicas x threadsPerReplica (" + std::to_string(config.replicas * config.threadsPerReplica)
+				+ ") oversubscribes the " + std::to_string(cores) + " available cores.");
+		}
+		if (config.maxQueuedBatches < -1)
+		{
+			throw std::invalid_argument("maxQueuedBatches must be -1 (unbounded), 0 (automatic) or positive.");
+		}
+		if (config.cpuCoreOffset < -1)
+		{
+			throw std::invalid_argument("cpuCoreOffset must be -1 (no pinning) or a core index.");
+		}
+		if (config.cpuCoreOffset >= 0
+			&& static_cast<size_t>(config.cpuCoreOffset) + config.replicas * config.threadsPerReplica > cores)
+		{
+			throw std::invalid_argument("cpuCoreOffset + replicas x threadsPerReplica exceeds the "
+				+ std::to_string(cores) + " available cores.");
+		}
+		return config;
+	}
+
+	ctranslate2::ReplicaPoolConfig TranslatorConfig::poolConfig() const
+	{
+		ctranslate2::ReplicaPoolConfig config;
+		config.num_threads_per_replica = threadsPerReplica;
+		// Only Fifo posts requests straight to the pool. The other modes bound their own
+		// queues and must never block a replica thread posting its next pull job.
+		config.max_queued_batches = scheduling == SchedulingMode::Fifo ? maxQueuedBatches : -1;
+		config.cpu_core_offset = cpuCoreOffset;
+		return config;
+	}
+
+	std::string TranslatorConfig::toString() const
+	{
+		return std::to_string(replicas) + " replica(s) x " + std::to_string(threadsPerReplica) + " thread(s), "
+			+ (computeType ? ctranslate2::compute_type_to_str(*computeType) : std::string("automatic compute type"))
+			+ ", queue " + std::to_string(maxQueuedBatches)
+			+ ", core offset " + std::to_string(cpuCoreOffset)
+			+ (useVocabularyMap ? ", vmap" : "")
+			+ (scheduling == SchedulingMode::Priority ? "" : std::string(", ") + schedulingModeName(scheduling));
+	}
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <ctranslate2/replica_pool.h>
+#include <ctranslate2/types.h>
+
+#include "RequestScheduler.h"
+#include "TranslationCache.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    // Runtime shape of one translator: how many model replicas run side by side, how
+    // many intra-op threads each one uses, and how the weights are computed.
+    //
+    // Fewer replicas with more threads give the lowest latency for a single query;
+    // more replicas with fewer threads give more throughput for concurrent queries.
+    // Zero means "derive from the machine" (see resolved()).
+    struct TranslatorConfig
+    {
+        size_t replicas = 0;
+        size_t threadsPerReplica = 0;
+        // Batches waiting for a replica before post() blocks. 0 lets CTranslate2 pick
+        // (4 per replica), -1 is unbounded. Except in Fifo scheduling, only bulk and
+        // background requests count and wait; keystroke queries never block.
+        long maxQueuedBatches = 0;
+        // First core replica threads are pinned to, or -1 to not pin them.
+        int cpuCoreOffset = -1;
+        // Unset means the tuned profile's compute type, or int8 without one.
+        std::optional<ctranslate2::ComputeType> computeType;
+        // Memory budget of the translation cache; 0 disables caching (benchmarks).
+        size_t cacheCapacityBytes = TranslationCache::defaultCapacityBytes;
+        // Take the profile saved by AutoTuner for this model and machine, when there is
+        // one: its layout when replicas and threadsPerReplica are both automatic, its
+        // compute type when computeType is unset, and its beam size and batch budget.
+        bool useTunedProfile = true;
+        // Decode with the model's vocabulary map (vmap.txt, see VocabularyMapBuilder): the
+        // output layer only scores the target candidates of each input. Ignored when the
+        // model directory has no map.
+        bool useVocabularyMap = false;
+        // How queued requests reach the replicas: by class (keystroke queries before
+        // batches before calibration), with work stealing for many small requests on
+        // many replicas, or in submission order (see RequestScheduler).
+        SchedulingMode scheduling = SchedulingMode::Priority;
+
+        // Number of logical cores, as seen by the standard library (at least 1).
+        static size_t detectedCores();
+
+        // Returns a copy with every automatic value filled in for this machine and
+        // throws std::invalid_argument for a configuration that cannot run here.
+        TranslatorConfig resolved() const;
+
+        ctranslate2::ReplicaPoolConfig poolConfig() const;
+
+        std::string toString() const;
+    };
+
+}
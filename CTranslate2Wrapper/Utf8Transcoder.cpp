@@ -0,0 +1,231 @@
+#include "Utf8Transcoder.h"
+
+#include <cstdint>
+#include <string>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTF8_TRANSCODER_SSE2 1
+#endif
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		constexpr char16_t replacementCharacter = 0xFFFD;
+
+		bool isHighSurrogate(char16_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+		bool isLowSurrogate(char16_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+
+		void putReplacementUtf8(char* out, size_t& o)
+		{
+			out[o++] = static_cast<char>(0xEF);
+			out[o++] = static_cast<char>(0xBF);
+			out[o++] = static_cast<char>(0xBD);
+		}
+	}
+
+	TranscodeResult utf16ToUtf8(const char16_t* in, size_t length, char* out)
+	{
+		TranscodeResult result;
+		size_t i = 0;
+		size_t o = 0;
+		while (i < length)
+		{
+#ifdef UTF8_TRANSCODER_SSE2
+			// 16 code units below 0x80 at a time: narrow them with one saturating pack.
+			const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+			while (i + 16 <= length)
+			{
+				const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+				const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+				const __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiBits);
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+				{
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), _mm_packus_epi16(low, high));
+				i += 16;
+				o += 16;
+			}
+			if (i == length)
+			{
+				break;
+			}
+#endif
+
+			const char16_t c = in[i];
+			if (c < 0x80)
+			{
+				out[o++] = static_cast<char>(c);
+				++i;
+			}
+			else if (c < 0x800)
+			{
+				out[o++] = static_cast<char>(0xC0 | (c >> 6));
+				out[o++] = static_cast<char>(0x80 | (c & 0x3F));
+				++i;
+			}
+			else if (isHighSurrogate(c) && i + 1 < length && isLowSurrogate(in[i + 1]))
+			{
+				const uint32_t codePoint = 0x10000 + ((static_cast<uint32_t>(c) - 0xD800) << 10) + (in[i + 1] - 0xDC00);
+				out[o++] = static_cast<char>(0xF0 | (codePoint >> 18));
+				out[o++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+				out[o++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				out[o++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				i += 2;
+			}
+			else if (isHighSurrogate(c) || isLowSurrogate(c))
+			{
+				putReplacementUtf8(out, o);
+				result.valid = false;
+				++i;
+			}
+			else
+			{
+				out[o++] = static_cast<char>(0xE0 | (c >> 12));
+				out[o++] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+				out[o++] = static_cast<char>(0x80 | (c & 0x3F));
+				++i;
+			}
+		}
+		result.length = o;
+		return result;
+	}
+
+	TranscodeResult utf8ToUtf16(const char* in, size_t length, char16_t* out)
+	{
+		const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+		TranscodeResult result;
+		size_t i = 0;
+		size_t o = 0;
+		while (i < length)
+		{
+#ifdef UTF8_TRANSCODER_SSE2
+			// 16 ASCII bytes at a time: widen them by interleaving with zeros.
+			const __m128i zero = _mm_setzero_si128();
+			while (i + 16 <= length)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+				if (_mm_movemask_epi8(chunk) != 0)
+				{
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), _mm_unpacklo_epi8(chunk, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + o + 8), _mm_unpackhi_epi8(chunk, zero));
+				i += 16;
+				o += 16;
+			}
+			if (i == length)
+			{
+				break;
+			}
+#endif
+
+			const unsigned char lead = bytes[i];
+			if (lead < 0x80)
+			{
+				out[o++] = lead;
+				++i;
+				continue;
+			}
+
+			// Well-formed sequences per the Unicode standard (table 3-7): the allowed range
+			// of the second byte depends on the lead byte, which excludes overlong forms,
+			// surrogates and code points above U+10FFFF.
+			size_t continuations;
+			uint32_t codePoint;
+			unsigned char lower = 0x80;
+			unsigned char upper = 0xBF;
+			if (lead >= 0xC2 && lead <= 0xDF)
+			{
+				continuations = 1;
+				codePoint = lead & 0x1F;
+			}
+			else if (lead >= 0xE0 && lead <= 0xEF)
+			{
+				continuations = 2;
+				codePoint = lead & 0x0F;
+				if (lead == 0xE0)
+					lower = 0xA0;
+				else if (lead == 0xED)
+					upper = 0x9F;
+			}
+			else if (lead >= 0xF0 && lead <= 0xF4)
+			{
+				continuations = 3;
+				codePoint = lead & 0x07;
+				if (lead == 0xF0)
+					lower = 0x90;
+				else if (lead == 0xF4)
+					upper = 0x8F;
+			}
+			else
+			{
+				out[o++] = replacementCharacter;
+				result.valid = false;
+				++i;
+				continue;
+			}
+
+			size_t consumed = 1;
+			for (; consumed <= continuations && i + consumed < length; ++consumed)
+			{
+				const unsigned char next = bytes[i + consumed];
+				if (next < lower || next > upper)
+				{
+					break;
+				}
+				codePoint = (codePoint << 6) | (next & 0x3F);
+				lower = 0x80;
+				upper = 0xBF;
+			}
+
+			if (consumed <= continuations)
+			{
+				// One replacement for the lead byte and the continuations that were valid so far.
+				out[o++] = replacementCharacter;
+				result.valid = false;
+				i += consumed;
+				continue;
+			}
+
+			i += consumed;
+			if (codePoint >= 0x10000)
+			{
+				codePoint -= 0x10000;
+				out[o++] = static_cast<char16_t>(0xD800 + (codePoint >> 10));
+				out[o++] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+			}
+			else
+			{
+				out[o++] = static_cast<char16_t>(codePoint);
+			}
+		}
+		result.length = o;
+		return result;
+	}
+
+	std::string_view utf16ToUtf8Scratch(const char16_t* in, size_t length)
+	{
+		// Only grows, so steady-state calls neither allocate nor clear memory.
+		thread_local std::string buffer;
+		if (buffer.size() < maxUtf8Length(length))
+		{
+			buffer.resize(maxUtf8Length(length));
+		}
+		const TranscodeResult result = utf16ToUtf8(in, length, buffer.data());
+		return std::string_view(buffer.data(), result.length);
+	}
+
+	std::u16string_view utf8ToUtf16Scratch(std::string_view in)
+	{
+		thread_local std::u16string buffer;
+		if (buffer.size() < maxUtf16Length(in.size()))
+		{
+			buffer.resize(maxUtf16Length(in.size()));
+		}
+		const TranscodeResult result = utf8ToUtf16(in.data(), in.size(), buffer.data());
+		return std::u16string_view(buffer.data(), result.length);
+	}
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace CTranslate2Wrapper::Native {
+
+    // UTF-16 <-> UTF-8 conversion for the managed boundary, without the Win32 API.
+    //
+    // ASCII runs, by far the most common input of the palette, are converted 16 code
+    // units at a time with SSE2; everything else goes through a validating scalar
+    // decoder. Invalid input (unpaired surrogates, malformed or overlong UTF-8,
+    // surrogate code points encoded in UTF-8) is replaced by U+FFFD, one per maximal
+    // invalid subpart, like WideCharToMultiByte/MultiByteToWideChar do by default.
+    struct TranscodeResult
+    {
+        // Code units written to the output.
+        size_t length = 0;
+        // False if some input had to be replaced.
+        bool valid = true;
+    };
+
+    // Upper bounds of the output size, for sizing the buffers below.
+    constexpr size_t maxUtf8Length(size_t utf16Length) { return utf16Length * 3; }
+    constexpr size_t maxUtf16Length(size_t utf8Length) { return utf8Length; }
+
+    // out must hold maxUtf8Length(length) bytes.
+    TranscodeResult utf16ToUtf8(const char16_t* in, size_t length, char* out);
+    // out must hold maxUtf16Length(length) code units.
+    TranscodeResult utf8ToUtf16(const char* in, size_t length, char16_t* out);
+
+    // Same, into a buffer owned by the calling thread and reused by its next call, so
+    // converting a string allocates nothing once the buffer is large enough. The view
+    // is valid until the thread's next call of the same function.
+    std::string_view utf16ToUtf8Scratch(const char16_t* in, size_t length);
+    std::u16string_view utf8ToUtf16Scratch(std::string_view in);
+
+}
@@ -0,0 +1,228 @@
+#include "VocabularyMapBuilder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace CTranslate2Wrapper::Native {
+
+	namespace {
+		std::string joinPath(const std::string& directory, const std::string& name)
+		{
+			if (directory.empty() || directory.back() == '/' || directory.back() == '\\')
+			{
+				return directory + name;
+			}
+			return directory + "/" + name;
+		}
+
+		struct Candidate
+		{
+			uint32_t target;
+			double score;
+		};
+	}
+
+	VocabularyMapBuilder::VocabularyMapBuilder(std::shared_ptr<const TokenizerService> tokenizer, const VocabularyMapOptions& options)
+		: m_tokenizer(std::move(tokenizer))
+		, m_options(options)
+	{
+		if (!m_tokenizer)
+		{
+			throw std::invalid_argument("VocabularyMapBuilder needs the model's tokenizer.");
+		}
+		if (m_options.maxNgram == 0)
+		{
+			throw std::invalid_argument("The vocabulary map needs n-grams of at least one piece.");
+		}
+	}
+
+	uint32_t VocabularyMapBuilder::targetIndex(const std::string& piece)
+	{
+		const auto [it, inserted] = m_targetIndex.emplace(piece, static_cast<uint32_t>(m_targetPieces.size()));
+		if (inserted)
+		{
+			m_targetPieces.push_back(piece);
+			m_targetCounts.push_back(0);
+		}
+		return it->second;
+	}
+
+	void VocabularyMapBuilder::addPair(const std::string& source, const std::string& target)
+	{
+		std::vector<std::string> sourcePieces = m_tokenizer->encode(source);
+		std::vector<std::string> targetPieces;
+		m_tokenizer->target().Encode(target, &targetPieces);
+		if (sourcePieces.empty() || targetPieces.empty())
+		{
+			return;
+		}
+		// The translator appends it to every input, so it is part of the n-grams CTranslate2 looks up.
+		sourcePieces.push_back("</s>");
+
+		// Each piece and n-gram counts once per sentence pair.
+		std::vector<uint32_t> targets;
+		targets.reserve(targetPieces.size());
+		for (const std::string& piece : targetPieces)
+		{
+			targets.push_back(targetIndex(piece));
+		}
+		std::sort(targets.begin(), targets.end());
+		targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+		for (const uint32_t target : targets)
+		{
+			++m_targetCounts[target];
+		}
+
+		std::unordered_set<std::string> ngrams;
+		for (size_t begin = 0; begin < sourcePieces.size(); ++begin)
+		{
+			std::string ngram;
+			for (size_t length = 1; length <= m_options.maxNgram && begin + length <= sourcePieces.size(); ++length)
+			{
+				if (length > 1)
+				{
+					ngram += ' ';
+				}
+				ngram += sourcePieces[begin + length - 1];
+				ngrams.insert(ngram);
+			}
+		}
+
+		for (const std::string& ngram : ngrams)
+		{
+			SourceEntry& entry = m_sources[ngram];
+			++entry.count;
+			for (const uint32_t target : targets)
+			{
+				++entry.cooccurrences[target];
+			}
+		}
+		++m_pairs;
+	}
+
+	void VocabularyMapBuilder::write(std::ostream& out, const ctranslate2::Vocabulary* targetVocabulary) const
+	{
+		const auto known = [targetVocabulary](const std::string& piece)
+		{
+			return !targetVocabulary || targetVocabulary->contains(piece);
+		};
+
+		// 1. Fixed candidates: the most frequent target pieces. An empty key marks them.
+		std::vector<uint32_t> byFrequency(m_targetPieces.size());
+		for (uint32_t i = 0; i < byFrequency.size(); ++i)
+		{
+			byFrequency[i] = i;
+		}
+		std::stable_sort(byFrequency.begin(), byFrequency.end(),
+			[this](uint32_t a, uint32_t b) { return m_targetCounts[a] > m_targetCounts[b]; });
+
+		std::unordered_set<uint32_t> fixed;
+		out << '\t';
+		for (const uint32_t target : byFrequency)
+		{
+			if (fixed.size() >= m_options.frequentTargets)
+			{
+				break;
+			}
+			if (!known(m_targetPieces[target]))
+			{
+				continue;
+			}
+			out << (fixed.empty() ? "" : " ") << m_targetPieces[target];
+			fixed.insert(target);
+		}
+		out << '\n';
+
+		// 2. One line per source n-gram, candidates ranked by Dice coefficient. Sorted by
+		//    key so the file is stable across runs.
+		const std::map<std::string, const SourceEntry*> sources = [this]
+		{
+			std::map<std::string, const SourceEntry*> sorted;
+			for (const auto& [ngram, entry] : m_sources)
+			{
+				sorted.emplace(ngram, &entry);
+			}
+			return sorted;
+		}();
+
+		std::vector<Candidate> candidates;
+		for (const auto& [ngram, entry] : sources)
+		{
+			const bool unigram = ngram.find(' ') == std::string::npos;
+			const size_t limit = unigram ? m_options.candidatesPerUnigram : m_options.candidatesPerNgram;
+
+			candidates.clear();
+			for (const auto& [target, count] : entry->cooccurrences)
+			{
+				if (count < m_options.minCooccurrences || fixed.count(target) || !known(m_targetPieces[target]))
+				{
+					continue;
+				}
+				const double dice = 2.0 * count / (entry->count + m_targetCounts[target]);
+				candidates.push_back({ target, dice });
+			}
+			if (candidates.empty())
+			{
+				continue;
+			}
+
+			const size_t kept = std::min(limit, candidates.size());
+			std::partial_sort(candidates.begin(), candidates.begin() + kept, candidates.end(),
+				[this](const Candidate& a, const Candidate& b)
+				{
+					return a.score != b.score ? a.score > b.score : m_targetPieces[a.target] < m_targetPieces[b.target];
+				});
+
+			out << ngram << '\t';
+			for (size_t i = 0; i < kept; ++i)
+			{
+				out << (i == 0 ? "" : " ") << m_targetPieces[candidates[i].target];
+			}
+			out << '\n';
+		}
+	}
+
+	void VocabularyMapBuilder::install(const std::string& modelDir) const
+	{
+		const std::string path = joinPath(modelDir, fileName);
+		const std::string temporaryPath = path + ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary);
+			if (!file)
+			{
+				throw std::runtime_error("Failed to write the vocabulary map '" + temporaryPath + "'.");
+			}
+			const ctranslate2::Vocabulary vocabulary = loadTargetVocabulary(modelDir);
+			write(file, &vocabulary);
+			if (!file.flush())
+			{
+				throw std::runtime_error("Failed to write the vocabulary map '" + temporaryPath + "'.");
+			}
+		}
+
+		// rename() does not replace an existing file on Windows.
+		std::remove(path.c_str());
+		if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+		{
+			throw std::runtime_error("Failed to install the vocabulary map '" + path + "'.");
+		}
+	}
+
+	ctranslate2::Vocabulary VocabularyMapBuilder::loadTargetVocabulary(const std::string& modelDir)
+	{
+		for (const char* name : { "shared_vocabulary.json", "target_vocabulary.json" })
+		{
+			std::ifstream file(joinPath(modelDir, name));
+			if (file)
+			{
+				return ctranslate2::Vocabulary::from_json_file(file);
+			}
+		}
+		throw std::runtime_error("No target vocabulary found in '" + modelDir + "'.");
+	}
+
+}
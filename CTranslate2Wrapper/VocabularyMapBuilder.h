@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ctranslate2/vocabulary.h>
+
+#include "TokenizerService.h"
+
+namespace CTranslate2Wrapper::Native {
+
+    struct VocabularyMapOptions
+    {
+        // Longest source n-gram (in SentencePiece pieces) that gets its own candidates.
+        size_t maxNgram = 2;
+        size_t candidatesPerUnigram = 24;
+        size_t candidatesPerNgram = 8;
+        // Most frequent target pieces, always scored (punctuation, particles, ...).
+        size_t frequentTargets = 256;
+        // Pairs seen together in fewer sentences are treated as noise.
+        uint32_t minCooccurrences = 2;
+    };
+
+    // Builds the vmap.txt of a model directory from a sentence-aligned parallel corpus.
+    //
+    // Every source n-gram is associated with the target pieces that co-occur with it in
+    // the same sentence pair, ranked by Dice coefficient. The first line lists the pieces
+    // that are always candidates. This is the format ctranslate2::VocabularyMap loads:
+    //
+    //     <source n-gram> \t candidate1 candidate2 ... candidateN
+    class VocabularyMapBuilder
+    {
+    public:
+        static constexpr const char* fileName = "vmap.txt";
+
+        VocabularyMapBuilder(std::shared_ptr<const TokenizerService> tokenizer,
+                             const VocabularyMapOptions& options = {});
+
+        // Adds one sentence pair of raw text; both sides are tokenized with the model's
+        // SentencePiece models.
+        void addPair(const std::string& source, const std::string& target);
+        size_t pairs() const { return m_pairs; }
+
+        // Candidates not in targetVocabulary (when given) are dropped.
+        void write(std::ostream& out, const ctranslate2::Vocabulary* targetVocabulary = nullptr) const;
+
+        // Writes <modelDir>/vmap.txt, replacing an existing one only once the new file is
+        // complete. The model has to be reloaded to use it.
+        void install(const std::string& modelDir) const;
+
+        // Target vocabulary of a converted model directory (shared_vocabulary.json or
+        // target_vocabulary.json).
+        static ctranslate2::Vocabulary loadTargetVocabulary(const std::string& modelDir);
+
+    private:
+        struct SourceEntry
+        {
+            uint32_t count = 0;
+            std::unordered_map<uint32_t, uint32_t> cooccurrences;
+        };
+
+        uint32_t targetIndex(const std::string& piece);
+
+        const std::shared_ptr<const TokenizerService> m_tokenizer;
+        const VocabularyMapOptions m_options;
+        size_t m_pairs = 0;
+
+        // Target pieces are interned; counts are per sentence pair, not per occurrence.
+        std::unordered_map<std::string, uint32_t> m_targetIndex;
+        std::vector<std::string> m_targetPieces;
+        std::vector<uint32_t> m_targetCounts;
+        std::unordered_map<std::string, SourceEntry> m_sources;
+    };
+
+}
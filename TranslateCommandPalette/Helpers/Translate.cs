@@ -49,11 +49,12 @@ namespace TranslateCommandPalette.Helpers
             Debug.WriteLine($"  MulEn: {normMulEnPath}");
             Debug.WriteLine($"  EnZh: {normEnZhPath}");
 
+            // Both models load in parallel on native background threads, so the palette is not
+            // blocked at activation. A query only waits for the model(s) its route needs.
             try
             {
                 Debug.WriteLine("Loading MulEn translator...");
-                mulEnTranslator = new(normMulEnPath);
-                Debug.WriteLine("MulEn translator loaded successfully");
+                mulEnTranslator = new(normMulEnPath, loadInBackground: true);
             }
             catch (Exception ex)
             {
@@ -64,8 +65,9 @@ namespace TranslateCommandPalette.Helpers
             try
             {
                 Debug.WriteLine("Loading EnZh translator...");
-                EnTargetTranslator = new(normEnZhPath);
-                Debug.WriteLine("EnZh translator loaded successfully");
+                EnTargetTranslator = new(normEnZhPath, loadInBackground: true);
+                // Incremental typing: reuse the previous keystroke's translation as a draft
+                EnTargetTranslator.SpeculativeDrafts = true;
             }
             catch (Exception ex)
             {
@@ -73,18 +75,90 @@ namespace TranslateCommandPalette.Helpers
                 mulEnTranslator?.Dispose(); // Clean up the first translator if second fails
                 throw new InvalidOperationException($"Failed to load EnZh model from '{normEnZhPath}': {ex.Message}", ex);
             }
+
+            _ = Task.Run(() => LogLoadTimings("MulEn", mulEnTranslator));
+            _ = Task.Run(() => LogLoadTimings("EnZh", EnTargetTranslator));
+        }
+
+        private static void LogLoadTimings(string name, Translator translator)
+        {
+            try
+            {
+                translator.WaitUntilReady(-1);
+                var timings = translator.GetLoadTimings();
+                Debug.WriteLine($"{name} translator loaded in {timings.TotalMilliseconds:F0} ms (model {timings.ModelMilliseconds:F0} ms, tokenizer {timings.TokenizerMilliseconds:F0} ms)");
+                Debug.WriteLine($"{name} translator runs with {translator.GetConfig()} ({TranslatorConfig.DetectedCores} cores detected)");
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"Failed to load {name} translator: {ex.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Translates <paramref name="text"/> into Chinese, picking the route from the detected language:
+        /// English goes straight to en→zh, other languages go through the mul→en→zh pivot and text that
+        /// is already Chinese is returned as is, without running a model.
+        /// An identification below <see cref="LanguageIdentifier.ConfidenceThreshold"/> (a few words,
+        /// or text no language explains clearly) keeps the direct en→zh route, the cheapest one.
+        /// </summary>
+        public Task<string> GetTranslation(string text, CancellationToken cancellationToken = default, Action<string>? onPartial = null)
+        {
+            var identification = LanguageIdentifier.Identify(text);
+            Debug.WriteLine($"Detected language: {identification.Language} ({identification.Confidence:F2})");
+
+            if (identification.Confidence < LanguageIdentifier.ConfidenceThreshold)
+            {
+                return GetTargetTranslation(text, cancellationToken, onPartial);
+            }
+            return identification.Language switch
+            {
+                "zh" => Task.FromResult(text),
+                "en" or "und" => GetTargetTranslation(text, cancellationToken, onPartial),
+                _ => GetPivotTranslation(text, cancellationToken),
+            };
+        }
+
+        /// <summary>
+        /// Translates <paramref name="text"/> into the target language.
+        /// When <paramref name="onPartial"/> is given, it receives the translation decoded so far
+        /// while the model is still running (on a background thread).
+        /// </summary>
+        public async Task<string> GetTargetTranslation(string text, CancellationToken cancellationToken = default, Action<string>? onPartial = null)
+        {
+            try
+            {
+                return await Task.Run(() =>
+                {
+                    // Pasted paragraphs and word lists are split into sentences natively and
+                    // translated as one batch. A superseded keystroke stops the native decoding
+                    // loop at its next step
+                    using var cancellation = new CancellationHandle();
+                    using var registration = cancellationToken.Register(cancellation.Cancel);
+                    return onPartial is null
+                        ? EnTargetTranslator.Translate(text, cancellation)
+                        : EnTargetTranslator.TranslateStreaming(text, partial => onPartial(partial), cancellation);
+                }, cancellationToken);
+            }
+            catch (OperationCanceledException)
+            {
+                return "@Canceled";
+            }
         }
 
-        // TODO: Add language detection and support multilang
-        public async Task<string> GetTargetTranslation(string text, CancellationToken cancellationToken = default)
+        /// <summary>
+        /// Translates non-English <paramref name="text"/> into the target language through English:
+        /// mul→en feeds en→zh inside the native wrapper, one sentence at a time.
+        /// </summary>
+        public async Task<string> GetPivotTranslation(string text, CancellationToken cancellationToken = default)
         {
             try
             {
                 return await Task.Run(() =>
                 {
-                    var result = EnTargetTranslator.Translate(text);
-                    cancellationToken.ThrowIfCancellationRequested();
-                    return result;
+                    using var cancellation = new CancellationHandle();
+                    using var registration = cancellationToken.Register(cancellation.Cancel);
+                    return mulEnTranslator.TranslatePivot(EnTargetTranslator, text, cancellation);
                 }, cancellationToken);
             }
             catch (OperationCanceledException)
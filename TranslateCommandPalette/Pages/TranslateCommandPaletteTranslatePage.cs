@@ -130,16 +130,29 @@ internal sealed partial class TranslateCommandPaletteTranslatePage : DynamicList
                 _cts = new CancellationTokenSource();
                 var token = _cts.Token;
 
-                string translated = await translate.GetTargetTranslation(newSearch, token).ConfigureAwait(false);
+                // Prepare results
+                var youdaoUrl = $"https://dict.youdao.com/result?word={Uri.EscapeDataString(newSearch)}&lang=en";
+
+                // Show the translation as it is being decoded
+                void ShowPartial(string partial)
+                {
+                    if (token.IsCancellationRequested || thisTick != _lastQueryTick)
+                    {
+                        return;
+                    }
+
+                    _results.Clear();
+                    _results.Add(new ListItem(new OpenUrl(youdaoUrl)) { Title = partial });
+                    RaiseItemsChanged(0);
+                }
+
+                string translated = await translate.GetTranslation(newSearch, token, ShowPartial).ConfigureAwait(false);
 
                 if (translated == "@Canceled" || token.IsCancellationRequested)
                 {
                     return; // User typed again
                 }
 
-                // Prepare results
-                var youdaoUrl = $"https://dict.youdao.com/result?word={Uri.EscapeDataString(newSearch)}&lang=en";
-
                 _results.Clear();
                 _results.Add(new ListItem(new OpenUrl(youdaoUrl)) { Title = translated });
 